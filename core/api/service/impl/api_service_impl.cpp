@@ -12,6 +12,7 @@
 #include "api/jrpc/jrpc_server.hpp"
 #include "api/jrpc/value_converter.hpp"
 #include "api/service/impl/rpc_thread_pool.hpp"
+#include "api/service/impl/rpc_worker_pool.hpp"
 #include "api/transport/listener.hpp"
 #include "application/app_state_manager.hpp"
 #include "blockchain/block_tree.hpp"
@@ -136,7 +137,8 @@ namespace kagome::api {
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<storage::trie::TrieStorage> trie_storage,
       std::shared_ptr<runtime::Core> core,
-      std::shared_ptr<RpcThreadPool> rpc_thread_pool)
+      std::shared_ptr<RpcThreadPool> rpc_thread_pool,
+      std::shared_ptr<RpcWorkerPool> rpc_worker_pool)
       : listeners_(std::move(listeners)),
         server_(std::move(server)),
         logger_{log::createLogger("ApiService", "api")},
@@ -147,8 +149,10 @@ namespace kagome::api {
                               .chain = std::move(chain_sub_engine),
                               .ext = std::move(ext_sub_engine)},
         extrinsic_event_key_repo_{std::move(extrinsic_event_key_repo)},
-        rpc_thread_pool_{std::move(rpc_thread_pool)} {
+        rpc_thread_pool_{std::move(rpc_thread_pool)},
+        rpc_worker_pool_{std::move(rpc_worker_pool)} {
     BOOST_ASSERT(block_tree_);
+    BOOST_ASSERT(rpc_worker_pool_);
     BOOST_ASSERT(trie_storage_);
     BOOST_ASSERT(core_);
     BOOST_ASSERT(
@@ -489,6 +493,22 @@ namespace kagome::api {
 
   void ApiServiceImpl::onSessionRequest(std::string_view request,
                                         std::shared_ptr<Session> session) {
+    auto method = RpcWorkerPool::method(request);
+    auto executed = rpc_worker_pool_->execute(
+        method,
+        [wp{weak_from_this()}, request{std::string{request}}, session]() {
+          if (auto self = wp.lock()) {
+            self->processRequest(request, session);
+          }
+        });
+    if (not executed) {
+      SL_DEBUG(logger_, "RPC request {} rejected, queue is full", method);
+      session->respond(RpcWorkerPool::busyResponse(request));
+    }
+  }
+
+  void ApiServiceImpl::processRequest(std::string request,
+                                      const std::shared_ptr<Session> &session) {
     auto thread_session_auto_release = [](void *) {
       threaded_info.releaseSessionId();
     };
@@ -506,11 +526,10 @@ namespace kagome::api {
 
     // TODO(kamilsa): remove that string replacement when
     // https://github.com/soramitsu/kagome/issues/572 resolved
-    std::string str_request(request);
-    boost::replace_first(str_request, "\"params\":null", "\"params\":[null]");
+    boost::replace_first(request, "\"params\":null", "\"params\":[null]");
 
     // process new request
-    server_->processData(str_request,
+    server_->processData(request,
                          session->isUnsafeAllowed(),
                          [&](std::string_view response) mutable {
                            // process response
@@ -28,6 +28,7 @@ namespace kagome::api {
   class JRpcServer;
   class Listener;
   class RpcThreadPool;
+  class RpcWorkerPool;
 }  // namespace kagome::api
 namespace kagome::application {
   class AppStateManager;
@@ -123,7 +124,8 @@ namespace kagome::api {
                    std::shared_ptr<blockchain::BlockTree> block_tree,
                    std::shared_ptr<storage::trie::TrieStorage> trie_storage,
                    std::shared_ptr<runtime::Core> core,
-                   std::shared_ptr<RpcThreadPool> rpc_thread_pool);
+                   std::shared_ptr<RpcThreadPool> rpc_thread_pool,
+                   std::shared_ptr<RpcWorkerPool> rpc_worker_pool);
 
     ~ApiServiceImpl() override = default;
 
@@ -182,6 +184,8 @@ namespace kagome::api {
 
     void onSessionRequest(std::string_view request,
                           std::shared_ptr<Session> session);
+    void processRequest(std::string request,
+                        const std::shared_ptr<Session> &session);
     void onSessionClose(Session::SessionId id, SessionType);
     void onStorageEvent(SubscriptionSetId set_id,
                         SessionPtr &session,
@@ -245,5 +249,6 @@ namespace kagome::api {
         extrinsic_event_key_repo_;
 
     std::shared_ptr<RpcThreadPool> rpc_thread_pool_;
+    std::shared_ptr<RpcWorkerPool> rpc_worker_pool_;
   };
 }  // namespace kagome::api
@@ -0,0 +1,221 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/service/impl/rpc_worker_pool.hpp"
+
+#include <algorithm>
+
+#include <boost/asio/post.hpp>
+
+#define RAPIDJSON_NO_SIZETYPEDEFINE
+namespace rapidjson {
+  typedef ::std::size_t SizeType;
+}
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "application/app_configuration.hpp"
+#include "metrics/histogram_timer.hpp"
+
+namespace kagome::api {
+  namespace {
+    constexpr auto kDurationMetric = "kagome_rpc_request_duration_seconds";
+    constexpr auto kRejectedMetric = "kagome_rpc_requests_rejected_total";
+
+    /// https://github.com/paritytech/jsonrpsee SERVER_IS_BUSY_CODE
+    constexpr int kBusyErrorCode = -32009;
+
+    constexpr std::string_view kLaneNames[]{
+        "fast",
+        "default",
+        "runtime",
+    };
+
+    constexpr std::string_view kFastMethods[]{
+        "chain_getBlockHash",
+        "chain_getFinalizedHead",
+        "chain_getHead",
+        "chain_getHeader",
+        "rpc_methods",
+        "system_chain",
+        "system_chainType",
+        "system_health",
+        "system_localPeerId",
+        "system_name",
+        "system_peers",
+        "system_properties",
+        "system_syncState",
+        "system_version",
+    };
+
+    constexpr std::string_view kRuntimeMethods[]{
+        "author_submitExtrinsic",
+        "childstate_getKeys",
+        "childstate_getKeysPaged",
+        "payment_queryFeeDetails",
+        "payment_queryInfo",
+        "state_call",
+        "state_getKeys",
+        "state_getKeysPaged",
+        "state_getKeysPagedAt",
+        "state_getMetadata",
+        "state_getPairs",
+        "state_getReadProof",
+        "state_getRuntimeVersion",
+        "state_queryStorage",
+        "state_queryStorageAt",
+        "state_traceBlock",
+        "system_accountNextIndex",
+        "system_dryRun",
+    };
+
+    bool contains(const auto &methods, std::string_view method) {
+      return std::ranges::find(methods, method) != std::end(methods);
+    }
+  }  // namespace
+
+  RpcWorkerPool::RpcWorkerPool(std::shared_ptr<Watchdog> watchdog,
+                               const application::AppConfiguration &app_config)
+      : ThreadPool(std::move(watchdog),
+                   "rpc_worker",
+                   std::max<size_t>(app_config.rpcThreads(), 1),
+                   std::nullopt),
+        state_{std::make_shared<State>()} {
+    auto threads = std::max<size_t>(app_config.rpcThreads(), 1);
+    state_->max_queued = app_config.rpcMaxQueuedRequests();
+    state_->default_limit = threads;
+    state_->runtime_limit = std::max<size_t>(threads / 2, 1);
+    state_->io = io_context();
+
+    metrics_registry_->registerHistogramFamily(
+        kDurationMetric, "Time from receiving to completing RPC requests");
+    metrics_registry_->registerCounterFamily(
+        kRejectedMetric, "Number of RPC requests rejected by full queues");
+    auto buckets = metrics::exponentialBuckets(0.001, 4, 9);
+    for (size_t i = 0; i < std::size(kLaneNames); ++i) {
+      std::map<std::string, std::string> labels{
+          {"lane", std::string{kLaneNames[i]}},
+      };
+      state_->metrics[i] = {
+          metrics_registry_->registerHistogramMetric(
+              kDurationMetric, buckets, labels),
+          metrics_registry_->registerCounterMetric(kRejectedMetric, labels),
+      };
+    }
+  }
+
+  RpcWorkerPool::Lane RpcWorkerPool::lane(std::string_view method) {
+    if (contains(kFastMethods, method)
+        or method.find("subscribe") != std::string_view::npos
+        or method.find("AndWatch") != std::string_view::npos
+        or method.find("unwatch") != std::string_view::npos) {
+      return Lane::Fast;
+    }
+    if (contains(kRuntimeMethods, method)) {
+      return Lane::Runtime;
+    }
+    return Lane::Default;
+  }
+
+  bool RpcWorkerPool::execute(std::string_view method, Task task) {
+    auto lane = RpcWorkerPool::lane(method);
+    auto &metrics = state_->metrics[static_cast<size_t>(lane)];
+    Queued queued{std::move(task), Clock::now()};
+    if (lane == Lane::Fast) {
+      // subscriptions keep their order with notifications of the session
+      queued.task();
+      metrics.duration->observe(
+          std::chrono::duration<double>(Clock::now() - queued.time).count());
+      return true;
+    }
+    std::lock_guard lock{state_->mutex};
+    // default methods share threads, runtime methods are limited separately
+    std::string key{lane == Lane::Runtime ? method : std::string_view{}};
+    auto it = state_->queues.find(key);
+    if (it == state_->queues.end()) {
+      auto limit = lane == Lane::Runtime ? state_->runtime_limit
+                                         : state_->default_limit;
+      it = state_->queues.emplace(std::move(key), Queue{lane, limit}).first;
+    }
+    auto &queue = it->second;
+    if (queue.running < queue.limit) {
+      ++queue.running;
+      post(state_, queue, std::move(queued));
+      return true;
+    }
+    if (queue.tasks.size() >= state_->max_queued) {
+      metrics.rejected->inc();
+      return false;
+    }
+    queue.tasks.emplace_back(std::move(queued));
+    return true;
+  }
+
+  void RpcWorkerPool::post(std::shared_ptr<State> state,
+                           Queue &queue,
+                           Queued queued) {
+    auto io = state->io.lock();
+    if (not io) {
+      return;
+    }
+    // queues are never erased, so the reference outlives the task
+    boost::asio::post(
+        *io, [state, &queue, queued{std::move(queued)}]() mutable {
+          queued.task();
+          state->metrics[static_cast<size_t>(queue.lane)].duration->observe(
+              std::chrono::duration<double>(Clock::now() - queued.time)
+                  .count());
+          std::lock_guard lock{state->mutex};
+          if (queue.tasks.empty()) {
+            --queue.running;
+            return;
+          }
+          auto next = std::move(queue.tasks.front());
+          queue.tasks.pop_front();
+          post(state, queue, std::move(next));
+        });
+  }
+
+  std::string RpcWorkerPool::method(std::string_view request) {
+    rapidjson::Document document;
+    document.Parse(request.data(), request.size());
+    if (document.HasParseError() or not document.IsObject()) {
+      return {};
+    }
+    auto it = document.FindMember("method");
+    if (it == document.MemberEnd() or not it->value.IsString()) {
+      return {};
+    }
+    return {it->value.GetString(), it->value.GetStringLength()};
+  }
+
+  std::string RpcWorkerPool::busyResponse(std::string_view request) {
+    rapidjson::Document document;
+    document.Parse(request.data(), request.size());
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer{buffer};
+    writer.StartObject();
+    writer.Key("jsonrpc");
+    writer.String("2.0");
+    writer.Key("id");
+    if (not document.HasParseError() and document.IsObject()
+        and document.HasMember("id")) {
+      document["id"].Accept(writer);
+    } else {
+      writer.Null();
+    }
+    writer.Key("error");
+    writer.StartObject();
+    writer.Key("code");
+    writer.Int(kBusyErrorCode);
+    writer.Key("message");
+    writer.String("Server is busy, try again later");
+    writer.EndObject();
+    writer.EndObject();
+    return {buffer.GetString(), buffer.GetSize()};
+  }
+}  // namespace kagome::api
@@ -0,0 +1,100 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+#include "metrics/metrics.hpp"
+#include "utils/thread_pool.hpp"
+#include "utils/watchdog.hpp"
+
+namespace kagome::application {
+  class AppConfiguration;
+}  // namespace kagome::application
+
+namespace kagome::api {
+  /**
+   * Executes RPC requests outside of the RPC IO thread, so slow requests
+   * don't delay other requests and sessions.
+   * Cheap requests and subscriptions are executed inline in the IO thread.
+   * Other requests are queued per lane, runtime calls are additionally limited
+   * per method, so one expensive method can't occupy all threads.
+   * Requests over the queue limit are rejected.
+   */
+  class RpcWorkerPool final : public ThreadPool {
+   public:
+    enum class Lane : uint8_t {
+      /// executed inline in the IO thread
+      Fast,
+      Default,
+      /// calls runtime or iterates storage
+      Runtime,
+    };
+
+    using Task = std::function<void()>;
+
+    RpcWorkerPool(std::shared_ptr<Watchdog> watchdog,
+                  const application::AppConfiguration &app_config);
+
+    static Lane lane(std::string_view method);
+
+    /**
+     * Executes or queues the task of the method request
+     * @return false if the queue of the method is full
+     */
+    bool execute(std::string_view method, Task task);
+
+    /**
+     * @return method of the request, or empty string for batch or invalid
+     * request
+     */
+    static std::string method(std::string_view request);
+
+    /// error response to the rejected request
+    static std::string busyResponse(std::string_view request);
+
+   private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Queued {
+      Task task;
+      Clock::time_point time;
+    };
+
+    struct Queue {
+      Lane lane;
+      size_t limit;
+      size_t running = 0;
+      std::deque<Queued> tasks;
+    };
+
+    struct Metrics {
+      metrics::Histogram *duration;
+      metrics::Counter *rejected;
+    };
+
+    /// shared with queued tasks
+    struct State {
+      std::mutex mutex;
+      std::unordered_map<std::string, Queue> queues;
+      size_t max_queued;
+      size_t default_limit;
+      size_t runtime_limit;
+      std::weak_ptr<boost::asio::io_context> io;
+      std::array<Metrics, 3> metrics;
+    };
+
+    static void post(std::shared_ptr<State> state, Queue &queue, Queued task);
+
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    std::shared_ptr<State> state_;
+  };
+}  // namespace kagome::api
@@ -7,6 +7,7 @@
 #include "api/service/state/impl/state_api_impl.hpp"
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -17,6 +18,7 @@
 #include "common/monadic_utils.hpp"
 #include "runtime/executor.hpp"
 #include "storage/trie/on_read.hpp"
+#include "storage/trie/trie_diff.hpp"
 
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::api, StateApiImpl::Error, e) {
   using E = kagome::api::StateApiImpl::Error;
@@ -41,6 +43,7 @@ namespace kagome::api {
   StateApiImpl::StateApiImpl(
       std::shared_ptr<blockchain::BlockHeaderRepository> block_repo,
       std::shared_ptr<const storage::trie::TrieStorage> trie_storage,
+      std::shared_ptr<storage::trie::TrieSerializer> serializer,
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<runtime::Core> runtime_core,
       std::shared_ptr<runtime::Metadata> metadata,
@@ -48,6 +51,7 @@ namespace kagome::api {
       LazySPtr<api::ApiService> api_service)
       : header_repo_{std::move(block_repo)},
         storage_{std::move(trie_storage)},
+        serializer_{std::move(serializer)},
         block_tree_{std::move(block_tree)},
         runtime_core_{std::move(runtime_core)},
         api_service_{std::move(api_service)},
@@ -55,6 +59,7 @@ namespace kagome::api {
         executor_{std::move(executor)} {
     BOOST_ASSERT(nullptr != header_repo_);
     BOOST_ASSERT(nullptr != storage_);
+    BOOST_ASSERT(nullptr != serializer_);
     BOOST_ASSERT(nullptr != block_tree_);
     BOOST_ASSERT(nullptr != runtime_core_);
     BOOST_ASSERT(nullptr != metadata_);
@@ -151,26 +156,50 @@ namespace kagome::api {
       }
     }
 
+    // a key requested twice is reported once, in order of first occurrence
+    std::vector<common::Buffer> unique_keys;
+    std::set<common::BufferView> seen_keys;
+    for (auto &key : keys) {
+      if (seen_keys.emplace(key).second) {
+        unique_keys.emplace_back(key);
+      }
+    }
+
     std::vector<StorageChangeSet> changes;
-    std::map<common::BufferView, std::optional<common::Buffer>> last_values;
 
     // TODO(Harrm): #2105 optimize it to use a lazy generator instead of
     // returning the whole vector with block ids
     OUTCOME_TRY(range, block_tree_->getChainByBlocks(from, to));
-    for (auto &block : range) {
+    if (range.empty()) {
+      return changes;
+    }
+    OUTCOME_TRY(first_header, header_repo_->getBlockHeader(range.front()));
+    OUTCOME_TRY(batch, storage_->getEphemeralBatchAt(first_header.state_root));
+    StorageChangeSet first{range.front(), {}};
+    for (auto &key : unique_keys) {
+      OUTCOME_TRY(opt_get, batch->tryGet(key));
+      auto opt_value = common::map_optional(
+          std::move(opt_get),
+          [](common::BufferOrView &&r) { return r.intoBuffer(); });
+      first.changes.push_back(StorageChangeSet::Change{key, opt_value});
+    }
+    if (not first.changes.empty()) {
+      changes.emplace_back(std::move(first));
+    }
+
+    // next blocks are compared with previous ones, so only changed paths of
+    // the trie are read
+    auto prev_root = first_header.state_root;
+    for (auto &block : std::span{range}.subspan(1)) {
       OUTCOME_TRY(header, header_repo_->getBlockHeader(block));
-      OUTCOME_TRY(batch, storage_->getEphemeralBatchAt(header.state_root));
+      OUTCOME_TRY(diff,
+                  storage::trie::diffTries(
+                      *serializer_, prev_root, header.state_root, unique_keys));
+      prev_root = header.state_root;
       StorageChangeSet change{block, {}};
-      for (auto &key : keys) {
-        OUTCOME_TRY(opt_get, batch->tryGet(key));
-        auto opt_value = common::map_optional(
-            std::move(opt_get),
-            [](common::BufferOrView &&r) { return r.intoBuffer(); });
-        auto it = last_values.find(key);
-        if (it == last_values.end() || it->second != opt_value) {
-          change.changes.push_back(StorageChangeSet::Change{key, opt_value});
-        }
-        last_values[key] = std::move(opt_value);
+      for (auto &[key, value] : diff) {
+        change.changes.push_back(
+            StorageChangeSet::Change{common::Buffer{key}, std::move(value)});
       }
       if (!change.changes.empty()) {
         changes.emplace_back(std::move(change));
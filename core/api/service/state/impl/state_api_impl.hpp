@@ -19,6 +19,10 @@ namespace kagome::runtime {
   class Executor;
 }
 
+namespace kagome::storage::trie {
+  class TrieSerializer;
+}
+
 namespace kagome::api {
 
   class StateApiImpl final : public StateApi {
@@ -34,6 +38,7 @@ namespace kagome::api {
 
     StateApiImpl(std::shared_ptr<blockchain::BlockHeaderRepository> block_repo,
                  std::shared_ptr<const storage::trie::TrieStorage> trie_storage,
+                 std::shared_ptr<storage::trie::TrieSerializer> serializer,
                  std::shared_ptr<blockchain::BlockTree> block_tree,
                  std::shared_ptr<runtime::Core> runtime_core,
                  std::shared_ptr<runtime::Metadata> metadata,
@@ -91,6 +96,7 @@ namespace kagome::api {
    private:
     std::shared_ptr<blockchain::BlockHeaderRepository> header_repo_;
     std::shared_ptr<const storage::trie::TrieStorage> storage_;
+    std::shared_ptr<storage::trie::TrieSerializer> serializer_;
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<runtime::Core> runtime_core_;
 
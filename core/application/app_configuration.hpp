@@ -32,11 +32,64 @@ namespace kagome::application {
     uint16_t times;
   };
 
+  struct TrieCommitBenchmarkConfig {
+    uint32_t keys;
+    uint16_t times;
+    uint32_t threads;
+    std::optional<filesystem::path> output;
+  };
+
+  struct StorageBenchmarkConfig {
+    uint32_t keys;
+    uint16_t times;
+    std::optional<filesystem::path> output;
+  };
+
+  struct RuntimeBenchmarkConfig {
+    uint16_t times;
+    std::optional<filesystem::path> output;
+  };
+
+  struct HostBenchmarkConfig {
+    uint16_t times;
+    std::optional<filesystem::path> output;
+  };
+
+  struct ParachainBenchmarkConfig {
+    uint32_t validators;
+    uint32_t pov_size;
+    /// run for the range of validator counts and PoV sizes instead
+    bool sweep;
+    uint16_t times;
+    std::optional<filesystem::path> output;
+  };
+
+  struct ApprovalBenchmarkConfig {
+    uint32_t validators;
+    uint32_t threads;
+    uint16_t times;
+    std::optional<filesystem::path> traffic;
+    std::optional<filesystem::path> output;
+  };
+
+  struct NetworkBenchmarkConfig {
+    uint32_t peers;
+    uint16_t times;
+    std::optional<filesystem::path> output;
+  };
+
   struct PrecompileWasmConfig {
     std::vector<filesystem::path> parachains;
   };
 
-  using BenchmarkConfigSection = std::variant<BlockBenchmarkConfig>;
+  using BenchmarkConfigSection = std::variant<BlockBenchmarkConfig,
+                                              TrieCommitBenchmarkConfig,
+                                              StorageBenchmarkConfig,
+                                              RuntimeBenchmarkConfig,
+                                              HostBenchmarkConfig,
+                                              ParachainBenchmarkConfig,
+                                              ApprovalBenchmarkConfig,
+                                              NetworkBenchmarkConfig>;
 
   /**
    * Parse and store application config.
@@ -165,6 +218,16 @@ namespace kagome::application {
      */
     virtual uint32_t maxWsConnections() const = 0;
 
+    /**
+     * @return number of threads executing RPC requests
+     */
+    virtual uint32_t rpcThreads() const = 0;
+
+    /**
+     * @return max number of RPC requests of one method waiting for execution
+     */
+    virtual uint32_t rpcMaxQueuedRequests() const = 0;
+
     /**
      * @return Kademlia random walk interval
      */
@@ -219,6 +282,12 @@ namespace kagome::application {
      */
     virtual SyncMethod syncMethod() const = 0;
 
+    /**
+     * @return max number of blocks submitted for import during full sync
+     * before the first of them is applied, 1 means sequential import
+     */
+    virtual uint32_t importPipelineDepth() const = 0;
+
     enum class RuntimeExecutionMethod {
       Compile,
       Interpret,
@@ -241,6 +310,12 @@ namespace kagome::application {
      */
     virtual bool purgeWavmCache() const = 0;
 
+    /**
+     * @return number of idle instances of the best block runtime to keep
+     * instantiated ahead of calls, 0 disables pre-warming
+     */
+    virtual uint32_t runtimeInstancesPrewarm() const = 0;
+
     virtual uint32_t parachainRuntimeInstanceCacheSize() const = 0;
 
     virtual uint32_t parachainPrecompilationThreadNum() const = 0;
@@ -271,6 +346,11 @@ namespace kagome::application {
      */
     virtual bool disableSecureMode() const = 0;
 
+    /**
+     * Whether to count calls, time and bytes of host API functions.
+     */
+    virtual bool profileHostApi() const = 0;
+
     enum class OffchainWorkerMode { WhenValidating, Always, Never };
     /**
      * @return enum constant of the mode of run offchain workers
@@ -303,6 +383,24 @@ namespace kagome::application {
      */
     virtual uint32_t dbCacheSize() const = 0;
 
+    /**
+     * @return max number of decoded trie nodes kept in memory, 0 disables
+     * the cache
+     */
+    virtual uint32_t trieNodeCacheSize() const = 0;
+
+    /**
+     * @return number of threads encoding the trie on commit, 1 means
+     * sequential commit
+     */
+    virtual uint32_t trieCommitThreads() const = 0;
+
+    /**
+     * @return true if storage reads are served from the flat key/value copy
+     * of the state when possible
+     */
+    virtual bool enableFlatState() const = 0;
+
     /**
      * Optional phrase to use dev account (e.g. Alice and Bob)
      */
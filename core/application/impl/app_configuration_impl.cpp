@@ -7,11 +7,14 @@
 #include "application/impl/app_configuration_impl.hpp"
 
 #include <boost/program_options/value_semantic.hpp>
+#include <algorithm>
+#include <array>
 #include <charconv>
 #include <limits>
 #include <regex>
 #include <string>
 
+#include <fmt/ranges.h>
 #include <fmt/std.h>
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
@@ -78,6 +81,8 @@ namespace {
   const uint16_t def_rpc_port = 9944;
   const uint16_t def_openmetrics_http_port = 9615;
   const uint32_t def_ws_max_connections = 500;
+  const uint32_t def_rpc_threads = 4;
+  const uint32_t def_rpc_max_queued_requests = 256;
   const uint16_t def_p2p_port = 30363;
   const bool def_dev_mode = false;
   const kagome::network::Roles def_roles = [] {
@@ -110,6 +115,10 @@ namespace {
   const auto def_wasm_interpreter = "Binaryen";
 #endif
   const uint32_t def_db_cache_size = 1024;
+  const uint32_t def_trie_node_cache_size = 1 << 16;
+  const uint32_t def_trie_commit_threads = 1;
+  const uint32_t def_import_pipeline_depth = 1;
+  const uint16_t def_benchmark_repeat = 10;
   const uint32_t def_parachain_runtime_instance_cache_size = 100;
 
   /**
@@ -280,6 +289,8 @@ namespace kagome::application {
         node_name_(randomNodeName()),
         node_version_(buildVersion()),
         max_ws_connections_(def_ws_max_connections),
+        rpc_threads_(def_rpc_threads),
+        rpc_max_queued_requests_(def_rpc_max_queued_requests),
         random_walk_interval_(def_random_walk_interval),
         sync_method_{def_sync_method},
         runtime_exec_method_{def_runtime_exec_method},
@@ -289,6 +300,9 @@ namespace kagome::application {
         enable_offchain_indexing_{def_enable_offchain_indexing},
         recovery_state_{def_block_to_recover},
         db_cache_size_{def_db_cache_size},
+        trie_node_cache_size_{def_trie_node_cache_size},
+        trie_commit_threads_{def_trie_commit_threads},
+        import_pipeline_depth_{def_import_pipeline_depth},
         state_pruning_depth_{} {}
 
   fs::path AppConfigurationImpl::chainSpecPath() const {
@@ -470,6 +484,8 @@ namespace kagome::application {
       }
     }
     load_u32(val, "db-cache", db_cache_size_);
+    load_u32(val, "trie-node-cache", trie_node_cache_size_);
+    load_u32(val, "trie-commit-threads", trie_commit_threads_);
   }
 
   void AppConfigurationImpl::parse_network_segment(
@@ -481,6 +497,8 @@ namespace kagome::application {
     load_str(val, "rpc-host", rpc_host_);
     load_u16(val, "rpc-port", rpc_port_);
     load_u32(val, "ws-max-connections", max_ws_connections_);
+    load_u32(val, "rpc-threads", rpc_threads_);
+    load_u32(val, "rpc-max-queued-requests", rpc_max_queued_requests_);
     load_str(val, "prometheus-host", openmetrics_http_host_);
     load_u16(val, "prometheus-port", openmetrics_http_port_);
     load_str(val, "name", node_name_);
@@ -786,11 +804,25 @@ namespace kagome::application {
     if (argc > 0 && argv[0] == "benchmark"sv) {
       command = "benchmark";
 
-      if (argc > 1 && argv[1] == "block"sv) {
-        subcommand = "block";
+      constexpr std::array kBenchmarkTypes{
+          "block"sv,
+          "trie-commit"sv,
+          "storage"sv,
+          "runtime"sv,
+          "host"sv,
+          "parachain"sv,
+          "approval"sv,
+          "network"sv,
+      };
+      if (argc > 1
+          and std::ranges::find(kBenchmarkTypes, argv[1])
+                  != kBenchmarkTypes.end()) {
+        subcommand = argv[1];
       } else {
         SL_ERROR(logger_, "Usage: kagome benchmark BENCHMARK_TYPE");
-        SL_ERROR(logger_, "The only supported BENCHMARK_TYPE is 'block'");
+        SL_ERROR(logger_,
+                 "Supported BENCHMARK_TYPEs are {}",
+                 fmt::join(kBenchmarkTypes, ", "));
         return false;
       }
     }
@@ -828,6 +860,9 @@ namespace kagome::application {
         ("tmp", "Use temporary storage path")
         ("database", po::value<std::string>()->default_value("rocksdb"), "Database backend to use [rocksdb]")
         ("db-cache", po::value<uint32_t>()->default_value(def_db_cache_size), "Limit the memory the database cache can use <MiB>")
+        ("trie-node-cache", po::value<uint32_t>()->default_value(def_trie_node_cache_size), "Number of decoded trie nodes to keep in memory, 0 to disable")
+        ("trie-commit-threads", po::value<uint32_t>()->default_value(def_trie_commit_threads), "Number of threads encoding changed trie nodes on commit, 1 for sequential commit")
+        ("enable-flat-state", po::bool_switch(), "Serve storage reads from a flat key/value copy of the state, built in background")
         ("enable-offchain-indexing", po::value<bool>(), "enable Offchain Indexing API, which allow block import to write to offchain DB)")
         ("recovery", po::value<std::string>(), "recovers block storage to state after provided block presented by number or hash, and stop after that")
         ("state-pruning", po::value<std::string>()->default_value("archive"), "state pruning policy. 'archive', 'prune-discarded', or the number of finalized blocks to keep.")
@@ -847,6 +882,8 @@ namespace kagome::application {
         ("rpc-host", po::value<std::string>(), "address for RPC over HTTP and Websocket")
         ("rpc-port", po::value<uint16_t>(), "port for RPC over HTTP and Websocket")
         ("ws-max-connections", po::value<uint32_t>(), "maximum number of WS RPC server connections")
+        ("rpc-threads", po::value<uint32_t>()->default_value(def_rpc_threads), "number of threads executing RPC requests")
+        ("rpc-max-queued-requests", po::value<uint32_t>()->default_value(def_rpc_max_queued_requests), "max number of RPC requests of one method waiting for execution, requests over the limit are rejected")
         ("prometheus-host", po::value<std::string>(), "address for OpenMetrics over HTTP")
         ("prometheus-port", po::value<uint16_t>(), "port for OpenMetrics over HTTP")
         ("out-peers", po::value<uint32_t>()->default_value(def_out_peers), "number of outgoing connections we're trying to maintain")
@@ -874,11 +911,17 @@ namespace kagome::application {
         ("dev-with-wipe", "if needed to wipe base path (only for dev mode)")
         ("sync", po::value<std::string>()->default_value(def_full_sync),
           "choose the desired sync method (Full, Fast). Full is used by default.")
+        ("import-pipeline-depth", po::value<uint32_t>()->default_value(def_import_pipeline_depth),
+          "Number of blocks submitted for import at once during full sync, headers of queued blocks are prevalidated while the first one executes")
         ("wasm-execution", po::value<std::string>()->default_value(def_wasm_execution),
           fmt::format("choose the desired wasm execution method ({})", execution_methods_str).c_str())
         ("wasm-interpreter", po::value<std::string>()->default_value(def_wasm_interpreter),
           fmt::format("choose the desired wasm interpreter ({})", interpreters_str).c_str())
         ("purge-wavm-cache", "purge WAVM runtime cache")
+        ("runtime-instances-prewarm", po::value<uint32_t>()->default_value(0),
+          "Number of instances of the best block runtime to instantiate in advance, 0 disables pre-warming")
+        ("profile-host-api", po::bool_switch(),
+          "count calls, time and bytes of host API functions per runtime call, exported as metrics")
         ("parachain-runtime-instance-cache-size",
           po::value<uint32_t>()->default_value(def_parachain_runtime_instance_cache_size),
           "Number of parachain runtime instances to keep cached")
@@ -900,7 +943,15 @@ namespace kagome::application {
     benchmark_desc.add_options()
       ("from", po::value<uint32_t>(), "set the initial block for block execution benchmark")
       ("to", po::value<uint32_t>(), "set the final block for block execution benchmark")
-      ("repeat", po::value<uint16_t>(), "set the repetition number for block execution benchmark")
+      ("repeat", po::value<uint16_t>(), "set the repetition number, required for block and trie commit benchmarks")
+      ("keys", po::value<uint32_t>()->default_value(100000), "set the number of changed keys for trie commit and storage benchmarks")
+      ("threads", po::value<uint32_t>()->default_value(std::thread::hardware_concurrency()), "set the number of threads for parallel trie commit and approval benchmarks")
+      ("validators", po::value<uint32_t>()->default_value(1000), "set the number of validators for parachain and approval benchmarks")
+      ("traffic", po::value<std::string>(), "replay approval traffic recorded to the file, record it there if the file doesn't exist")
+      ("pov-size", po::value<uint32_t>()->default_value(5 * 1024 * 1024), "set the PoV size in bytes for parachain benchmark")
+      ("sweep", po::bool_switch(), "run parachain benchmark for 10-1000 validators and 1KB-10MB PoV sizes")
+      ("peers", po::value<uint32_t>()->default_value(500), "set the number of peers for network benchmark")
+      ("output", po::value<std::string>(), "write benchmark results as JSON to the file instead of stdout")
       ;
 
     po::options_description db_editor_desc("kagome db-editor - to view help message for db editor");
@@ -1111,6 +1162,12 @@ namespace kagome::application {
     }
     find_argument<uint32_t>(
         vm, "db-cache", [&](uint32_t val) { db_cache_size_ = val; });
+    find_argument<uint32_t>(vm, "trie-node-cache", [&](uint32_t val) {
+      trie_node_cache_size_ = val;
+    });
+    find_argument<uint32_t>(vm, "trie-commit-threads", [&](uint32_t val) {
+      trie_commit_threads_ = val;
+    });
 
     std::vector<std::string> boot_nodes;
     find_argument<std::vector<std::string>>(
@@ -1355,6 +1412,14 @@ namespace kagome::application {
       max_ws_connections_ = val;
     });
 
+    find_argument<uint32_t>(vm, "rpc-threads", [&](uint32_t val) {
+      rpc_threads_ = std::max<uint32_t>(val, 1);
+    });
+
+    find_argument<uint32_t>(vm, "rpc-max-queued-requests", [&](uint32_t val) {
+      rpc_max_queued_requests_ = val;
+    });
+
     find_argument<uint32_t>(vm, "random-walk-interval", [&](uint32_t val) {
       random_walk_interval_ = val;
     });
@@ -1409,6 +1474,10 @@ namespace kagome::application {
       return false;
     }
 
+    find_argument<uint32_t>(vm, "import-pipeline-depth", [&](uint32_t val) {
+      import_pipeline_depth_ = std::max<uint32_t>(val, 1);
+    });
+
     bool exec_method_value_error = false;
     find_argument<std::string>(
         vm,
@@ -1483,6 +1552,11 @@ namespace kagome::application {
       }
     }
 
+    if (auto arg = find_argument<uint32_t>(vm, "runtime-instances-prewarm");
+        arg.has_value()) {
+      runtime_instances_prewarm_ = *arg;
+    }
+
     if (auto arg = find_argument<uint32_t>(
             vm, "parachain-runtime-instance-cache-size");
         arg.has_value()) {
@@ -1518,6 +1592,10 @@ namespace kagome::application {
       disable_secure_mode_ = true;
     }
 
+    if (find_argument(vm, "profile-host-api")) {
+      profile_host_api_ = true;
+    }
+
     bool offchain_worker_value_error = false;
     find_argument<std::string>(
         vm,
@@ -1544,6 +1622,10 @@ namespace kagome::application {
       subcommand_ = Subcommand::ChainInfo;
     });
 
+    auto repeat_opt = find_argument<uint16_t>(vm, "repeat");
+    std::optional<filesystem::path> output_opt;
+    find_argument<std::string>(
+        vm, "output", [&](const std::string &val) { output_opt = val; });
     if (command == "benchmark" && subcommand == "block") {
       auto from_opt = find_argument<uint32_t>(vm, "from");
       if (!from_opt) {
@@ -1555,7 +1637,6 @@ namespace kagome::application {
         SL_ERROR(logger_, "Required argument --to is not provided");
         return false;
       }
-      auto repeat_opt = find_argument<uint16_t>(vm, "repeat");
       if (!repeat_opt) {
         SL_ERROR(logger_, "Required argument --repeat is not provided");
         return false;
@@ -1566,6 +1647,66 @@ namespace kagome::application {
           .times = *repeat_opt,
       };
     }
+    if (command == "benchmark" && subcommand == "trie-commit") {
+      if (!repeat_opt) {
+        SL_ERROR(logger_, "Required argument --repeat is not provided");
+        return false;
+      }
+      benchmark_config_ = TrieCommitBenchmarkConfig{
+          .keys = find_argument<uint32_t>(vm, "keys").value(),
+          .times = *repeat_opt,
+          .threads = find_argument<uint32_t>(vm, "threads").value(),
+          .output = output_opt,
+      };
+    }
+    if (command == "benchmark" && subcommand == "storage") {
+      benchmark_config_ = StorageBenchmarkConfig{
+          .keys = find_argument<uint32_t>(vm, "keys").value(),
+          .times = repeat_opt.value_or(def_benchmark_repeat),
+          .output = output_opt,
+      };
+    }
+    if (command == "benchmark" && subcommand == "runtime") {
+      benchmark_config_ = RuntimeBenchmarkConfig{
+          .times = repeat_opt.value_or(def_benchmark_repeat),
+          .output = output_opt,
+      };
+    }
+    if (command == "benchmark" && subcommand == "host") {
+      benchmark_config_ = HostBenchmarkConfig{
+          .times = repeat_opt.value_or(def_benchmark_repeat),
+          .output = output_opt,
+      };
+    }
+    if (command == "benchmark" && subcommand == "parachain") {
+      benchmark_config_ = ParachainBenchmarkConfig{
+          .validators = find_argument<uint32_t>(vm, "validators").value(),
+          .pov_size = find_argument<uint32_t>(vm, "pov-size").value(),
+          .sweep = find_argument(vm, "sweep"),
+          .times = repeat_opt.value_or(def_benchmark_repeat),
+          .output = output_opt,
+      };
+    }
+    if (command == "benchmark" && subcommand == "approval") {
+      std::optional<filesystem::path> traffic_opt;
+      find_argument<std::string>(
+          vm, "traffic", [&](const std::string &val) { traffic_opt = val; });
+      benchmark_config_ = ApprovalBenchmarkConfig{
+          .validators = find_argument<uint32_t>(vm, "validators").value(),
+          .threads = find_argument<uint32_t>(vm, "threads").value(),
+          .times = repeat_opt.value_or(def_benchmark_repeat),
+          .traffic = std::move(traffic_opt),
+          .output = output_opt,
+      };
+    }
+
+    if (command == "benchmark" && subcommand == "network") {
+      benchmark_config_ = NetworkBenchmarkConfig{
+          .peers = find_argument<uint32_t>(vm, "peers").value(),
+          .times = repeat_opt.value_or(def_benchmark_repeat),
+          .output = output_opt,
+      };
+    }
 
     bool has_recovery = false;
     find_argument<std::string>(vm, "recovery", [&](const std::string &val) {
@@ -1609,6 +1750,10 @@ namespace kagome::application {
 
     blocks_pruning_ = find_argument<uint32_t>(vm, "blocks-pruning");
 
+    if (find_argument(vm, "enable-flat-state")) {
+      enable_flat_state_ = true;
+    }
+
     if (find_argument(vm, "precompile-relay")) {
       precompile_wasm_.emplace();
     }
@@ -127,6 +127,12 @@ namespace kagome::application {
     uint32_t maxWsConnections() const override {
       return max_ws_connections_;
     }
+    uint32_t rpcThreads() const override {
+      return rpc_threads_;
+    }
+    uint32_t rpcMaxQueuedRequests() const override {
+      return rpc_max_queued_requests_;
+    }
     std::chrono::seconds getRandomWalkInterval() const override {
       return std::chrono::seconds(random_walk_interval_);
     }
@@ -158,6 +164,9 @@ namespace kagome::application {
     SyncMethod syncMethod() const override {
       return sync_method_;
     }
+    uint32_t importPipelineDepth() const override {
+      return import_pipeline_depth_;
+    }
     RuntimeExecutionMethod runtimeExecMethod() const override {
       return runtime_exec_method_;
     }
@@ -167,6 +176,9 @@ namespace kagome::application {
     bool purgeWavmCache() const override {
       return purge_wavm_cache_;
     }
+    uint32_t runtimeInstancesPrewarm() const override {
+      return runtime_instances_prewarm_;
+    }
     uint32_t parachainRuntimeInstanceCacheSize() const override {
       return parachain_runtime_instance_cache_size_;
     }
@@ -196,6 +208,15 @@ namespace kagome::application {
     uint32_t dbCacheSize() const override {
       return db_cache_size_;
     }
+    uint32_t trieNodeCacheSize() const override {
+      return trie_node_cache_size_;
+    }
+    uint32_t trieCommitThreads() const override {
+      return trie_commit_threads_;
+    }
+    bool enableFlatState() const override {
+      return enable_flat_state_;
+    }
     std::optional<size_t> statePruningDepth() const override {
       return state_pruning_depth_;
     }
@@ -235,6 +256,9 @@ namespace kagome::application {
     bool disableSecureMode() const override {
       return disable_secure_mode_;
     }
+    bool profileHostApi() const override {
+      return profile_host_api_;
+    }
     std::optional<PrecompileWasmConfig> precompileWasm() const override {
       return precompile_wasm_;
     }
@@ -363,6 +387,8 @@ namespace kagome::application {
     std::string node_name_;
     std::string node_version_;
     uint32_t max_ws_connections_;
+    uint32_t rpc_threads_;
+    uint32_t rpc_max_queued_requests_;
     uint32_t random_walk_interval_;
     SyncMethod sync_method_;
     RuntimeExecutionMethod runtime_exec_method_;
@@ -374,6 +400,10 @@ namespace kagome::application {
     std::optional<primitives::BlockId> recovery_state_;
     StorageBackend storage_backend_ = StorageBackend::RocksDB;
     uint32_t db_cache_size_;
+    uint32_t trie_node_cache_size_;
+    uint32_t trie_commit_threads_;
+    uint32_t import_pipeline_depth_;
+    bool enable_flat_state_ = false;
     std::optional<size_t> state_pruning_depth_;
     bool prune_discarded_states_ = false;
     bool enable_thorough_pruning_ = false;
@@ -382,6 +412,7 @@ namespace kagome::application {
     std::string node_wss_pem_;
     std::optional<BenchmarkConfigSection> benchmark_config_;
     AllowUnsafeRpc allow_unsafe_rpc_ = AllowUnsafeRpc::kAuto;
+    uint32_t runtime_instances_prewarm_ = 0;
     uint32_t parachain_runtime_instance_cache_size_ = 100;
     uint32_t parachain_precompilation_thread_num_ =
         std::thread::hardware_concurrency() / 2;
@@ -391,6 +422,7 @@ namespace kagome::application {
     size_t pvf_max_workers_{
         std::max<size_t>(std::thread::hardware_concurrency(), 1)};
     bool disable_secure_mode_{false};
+    bool profile_host_api_{false};
     std::optional<PrecompileWasmConfig> precompile_wasm_;
   };
 
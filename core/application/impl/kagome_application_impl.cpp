@@ -61,6 +61,8 @@ namespace kagome::application {
     kagome::telemetry::setTelemetryService(injector_.injectTelemetryService());
 
     injector_.kademliaRandomWalk();
+    injector_.runtimeInstancesPrewarm();
+    injector_.runtimeUpgradePrecompiler();
     injector_.injectAddressPublisher();
     injector_.injectTimeline();
 
@@ -0,0 +1,357 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmark/approval_benchmark.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <random>
+
+#include <fmt/format.h>
+#include <libp2p/common/final_action.hpp>
+
+#include "common/worker_thread_pool.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "crypto/sr25519/sr25519_provider_impl.hpp"
+#include "network/types/collator_messages_vstaging.hpp"
+#include "parachain/approval/state.hpp"
+#include "parachain/approval/verify_message.hpp"
+#include "scale/tie.hpp"
+#include "utils/lru.hpp"
+#include "utils/parallel_for.hpp"
+#include "utils/read_file.hpp"
+#include "utils/write_file.hpp"
+
+OUTCOME_CPP_DEFINE_CATEGORY(kagome::benchmark, ApprovalBenchmark::Error, e) {
+  switch (e) {
+    using E = kagome::benchmark::ApprovalBenchmark::Error;
+    case E::INVALID_MESSAGE:
+      return "Recorded approval traffic contains invalid message";
+  }
+  return "Unknown ApprovalBenchmark error";
+}
+
+namespace kagome::benchmark {
+
+  namespace {
+    /// Messages of one relay block with session data needed to check them
+    struct ApprovalTraffic {
+      SCALE_TIE(8);
+
+      /// assignment and approval keys of validators
+      std::vector<crypto::Sr25519PublicKey> validators;
+      common::Buffer relay_vrf_story;
+      uint32_t n_delay_tranches;
+      uint32_t zeroth_delay_tranche_width;
+      parachain::SessionIndex session;
+      std::vector<parachain::CandidateHash> candidates;
+      std::vector<network::vstaging::Assignment> assignments;
+      std::vector<network::vstaging::IndirectSignedApprovalVoteV2> approvals;
+    };
+
+    /// Candidate per backing group of 5 validators
+    constexpr uint32_t kValidatorsPerCore = 5;
+
+    template <typename Blob>
+    Blob randomBlob(std::mt19937_64 &random) {
+      Blob blob;
+      std::ranges::generate(
+          blob, [&] { return static_cast<uint8_t>(random()); });
+      return blob;
+    }
+
+    outcome::result<ApprovalTraffic> generateTraffic(uint32_t validators) {
+      crypto::Sr25519ProviderImpl sr25519;
+      std::mt19937_64 random{validators};
+      ApprovalTraffic traffic{
+          .validators = {},
+          .relay_vrf_story = {},
+          .n_delay_tranches = 89,
+          .zeroth_delay_tranche_width = 0,
+          .session = 1,
+          .candidates = {},
+          .assignments = {},
+          .approvals = {},
+      };
+      ::RelayVRFStory story;
+      traffic.relay_vrf_story.resize(sizeof(story.data));
+      std::ranges::generate(traffic.relay_vrf_story,
+                            [&] { return static_cast<uint8_t>(random()); });
+      std::memcpy(
+          story.data, traffic.relay_vrf_story.data(), sizeof(story.data));
+
+      const auto cores = std::max<uint32_t>(1, validators / kValidatorsPerCore);
+      for (uint32_t core = 0; core < cores; ++core) {
+        traffic.candidates.emplace_back(
+            randomBlob<parachain::CandidateHash>(random));
+      }
+      auto block_hash = randomBlob<primitives::BlockHash>(random);
+
+      for (parachain::ValidatorIndex validator = 0; validator < validators;
+           ++validator) {
+        crypto::SecureBuffer<> seed_buf(crypto::Sr25519Seed::size());
+        std::ranges::generate(
+            seed_buf, [&] { return static_cast<uint8_t>(random()); });
+        OUTCOME_TRY(seed, crypto::Sr25519Seed::from(std::move(seed_buf)));
+        OUTCOME_TRY(keypair, sr25519.generateKeypair(seed, {}));
+        traffic.validators.emplace_back(keypair.public_key);
+
+        const parachain::CoreIndex core = validator % cores;
+        scale::BitVec bits;
+        bits.bits.resize(core + 1);
+        bits.bits[core] = true;
+
+        common::Blob<crypto::constants::sr25519::KEYPAIR_SIZE> keypair_buf;
+        std::ranges::copy(keypair.secret_key.unsafeBytes(),
+                          keypair_buf.begin());
+        std::ranges::copy(
+            keypair.public_key,
+            keypair_buf.begin() + crypto::Sr25519SecretKey::size());
+        VRFCOutput cert_output;
+        VRFCProof cert_proof;
+        uint32_t tranche{};
+        sr25519_relay_vrf_delay_assignments_cert(
+            keypair_buf.data(),
+            traffic.n_delay_tranches,
+            traffic.zeroth_delay_tranche_width,
+            &story,
+            core,
+            &cert_output,
+            &cert_proof,
+            &tranche);
+        crypto::VRFOutput vrf;
+        std::copy_n(cert_output.data,
+                    crypto::constants::sr25519::vrf::OUTPUT_SIZE,
+                    vrf.output.begin());
+        std::copy_n(cert_proof.data,
+                    crypto::constants::sr25519::vrf::PROOF_SIZE,
+                    vrf.proof.begin());
+        traffic.assignments.emplace_back(network::vstaging::Assignment{
+            .indirect_assignment_cert =
+                {
+                    .block_hash = block_hash,
+                    .validator = validator,
+                    .cert =
+                        {
+                            .kind =
+                                parachain::approval::RelayVRFDelay{
+                                    .core_index = core,
+                                },
+                            .vrf = vrf,
+                        },
+                },
+            .candidate_bitfield = bits,
+        });
+
+        OUTCOME_TRY(signature,
+                    sr25519.sign(keypair,
+                                 parachain::approval::approvalSigningPayload(
+                                     {traffic.candidates[core]},
+                                     traffic.session)));
+        traffic.approvals.emplace_back(
+            network::vstaging::IndirectSignedApprovalVoteV2{
+                .payload =
+                    {
+                        .payload =
+                            {
+                                .block_hash = block_hash,
+                                .candidate_indices = bits,
+                            },
+                        .ix = validator,
+                    },
+                .signature = signature,
+            });
+      }
+      return traffic;
+    }
+
+    /// Checks done by approval distribution on worker threads
+    outcome::result<std::vector<std::function<bool()>>> makeChecks(
+        const ApprovalTraffic &traffic,
+        const crypto::Sr25519Provider &sr25519) {
+      using ApprovalBenchmarkError = ApprovalBenchmark::Error;
+      ::RelayVRFStory story;
+      if (traffic.relay_vrf_story.size() != sizeof(story.data)) {
+        return ApprovalBenchmarkError::INVALID_MESSAGE;
+      }
+      std::memcpy(
+          story.data, traffic.relay_vrf_story.data(), sizeof(story.data));
+
+      std::vector<std::function<bool()>> checks;
+      for (auto &assignment : traffic.assignments) {
+        auto &cert = assignment.indirect_assignment_cert;
+        auto delay =
+            boost::get<parachain::approval::RelayVRFDelay>(&cert.cert.kind);
+        if (delay == nullptr or cert.validator >= traffic.validators.size()) {
+          return ApprovalBenchmarkError::INVALID_MESSAGE;
+        }
+        parachain::approval::DelayAssignmentCheck check{
+            .assignment_key =
+                runtime::AssignmentId{traffic.validators[cert.validator]},
+            .vrf = cert.cert.vrf,
+            .relay_vrf_story = story,
+            .core_index = delay->core_index,
+            .n_delay_tranches = traffic.n_delay_tranches,
+            .zeroth_delay_tranche_width = traffic.zeroth_delay_tranche_width,
+        };
+        checks.emplace_back([check] {
+          return parachain::approval::verifyDelayAssignment(check)
+              .has_value();
+        });
+      }
+      for (auto &approval : traffic.approvals) {
+        std::vector<parachain::CandidateHash> candidates;
+        OUTCOME_TRY(parachain::approval::iter_ones(
+            approval.payload.payload.candidate_indices,
+            [&](size_t index) -> outcome::result<void> {
+              if (index >= traffic.candidates.size()) {
+                return ApprovalBenchmarkError::INVALID_MESSAGE;
+              }
+              candidates.emplace_back(traffic.candidates[index]);
+              return outcome::success();
+            }));
+        if (approval.payload.ix >= traffic.validators.size()) {
+          return ApprovalBenchmarkError::INVALID_MESSAGE;
+        }
+        const auto &validator = traffic.validators[approval.payload.ix];
+        checks.emplace_back([&sr25519,
+                             &validator,
+                             candidates{std::move(candidates)},
+                             session = traffic.session,
+                             &signature = approval.signature] {
+          return parachain::approval::verifyApprovalSignature(
+              sr25519, validator, candidates, session, signature);
+        });
+      }
+      return checks;
+    }
+  }  // namespace
+
+  ApprovalBenchmark::ApprovalBenchmark(Config config)
+      : logger_{log::createLogger("ApprovalBenchmark", "benchmark")},
+        config_{std::move(config)} {}
+
+  outcome::result<void> ApprovalBenchmark::run(BenchmarkReport &report) {
+    common::Buffer recorded;
+    if (config_.traffic and filesystem::exists(*config_.traffic)) {
+      SL_INFO(logger_, "Replay traffic from {}", config_.traffic->string());
+      OUTCOME_TRY(readFile(recorded, *config_.traffic));
+    } else {
+      SL_INFO(logger_,
+              "Generate traffic of {} validators",
+              config_.validators);
+      OUTCOME_TRY(traffic, generateTraffic(config_.validators));
+      OUTCOME_TRY(encoded, scale::encode(traffic));
+      recorded = common::Buffer{std::move(encoded)};
+      if (config_.traffic) {
+        OUTCOME_TRY(writeFile(*config_.traffic, recorded));
+      }
+    }
+
+    OUTCOME_TRY(traffic, scale::decode<ApprovalTraffic>(recorded));
+    const auto messages = traffic.assignments.size() + traffic.approvals.size();
+    auto suffix = fmt::format("{}-validators", traffic.validators.size());
+    OUTCOME_TRY(report.measure(name(),
+                               "decode/" + suffix,
+                               config_.times,
+                               messages,
+                               [&]() -> outcome::result<void> {
+                                 OUTCOME_TRY(scale::decode<ApprovalTraffic>(
+                                     recorded));
+                                 return outcome::success();
+                               }));
+
+    crypto::Sr25519ProviderImpl sr25519;
+    OUTCOME_TRY(checks, makeChecks(traffic, sr25519));
+    auto run_checks = [&](size_t begin, size_t end) {
+      auto valid = true;
+      for (auto i = begin; i < end; ++i) {
+        valid = checks[i]() and valid;
+      }
+      return valid;
+    };
+
+    // single approval thread, as before checks were moved to worker pool
+    OUTCOME_TRY(report.measure(name(),
+                               "check-sequential/" + suffix,
+                               config_.times,
+                               messages,
+                               [&]() -> outcome::result<void> {
+                                 if (not run_checks(0, checks.size())) {
+                                   return Error::INVALID_MESSAGE;
+                                 }
+                                 return outcome::success();
+                               }));
+
+    const size_t threads = std::max<uint32_t>(1, config_.threads);
+    // checking thread takes messages too, the pool lends the rest
+    auto watchdog = std::make_shared<Watchdog>(std::chrono::milliseconds{1});
+    auto pool = std::make_shared<common::WorkerThreadPool>(
+        watchdog, std::max<size_t>(threads - 1, 1));
+    // pool threads exit only after the watchdog is stopped
+    ::libp2p::common::FinalAction stop_pool([&] {
+      watchdog->stop();
+      pool.reset();
+    });
+    OUTCOME_TRY(report.measure(
+        name(),
+        fmt::format("check-parallel/{}-threads/{}", threads, suffix),
+        config_.times,
+        messages,
+        [&]() -> outcome::result<void> {
+          std::atomic_bool valid = true;
+          parallelFor(*pool, checks.size(), threads, [&](size_t i) {
+            if (not checks[i]()) {
+              valid = false;
+            }
+          });
+          if (not valid) {
+            return Error::INVALID_MESSAGE;
+          }
+          return outcome::success();
+        }));
+
+    // gossip delivers every message from several peers, duplicates are
+    // found by hash of message and not checked again
+    constexpr size_t kCopies = 2;
+    crypto::HasherImpl hasher;
+    std::vector<common::Buffer> encoded_messages;
+    for (auto &assignment : traffic.assignments) {
+      OUTCOME_TRY(encoded, scale::encode(assignment));
+      encoded_messages.emplace_back(std::move(encoded));
+    }
+    for (auto &approval : traffic.approvals) {
+      OUTCOME_TRY(encoded, scale::encode(approval));
+      encoded_messages.emplace_back(std::move(encoded));
+    }
+    OUTCOME_TRY(report.measure(
+        name(),
+        "check-deduplicated/" + suffix,
+        config_.times,
+        kCopies * messages,
+        [&]() -> outcome::result<void> {
+          Lru<common::Hash256, bool> checked{kCopies * messages + 1};
+          for (size_t copy = 0; copy < kCopies; ++copy) {
+            for (size_t i = 0; i < checks.size(); ++i) {
+              auto key = hasher.blake2b_256(encoded_messages[i]);
+              if (auto valid = checked.get(key)) {
+                if (not valid->get()) {
+                  return Error::INVALID_MESSAGE;
+                }
+                continue;
+              }
+              if (not checked.put(key, checks[i]())) {
+                return Error::INVALID_MESSAGE;
+              }
+            }
+          }
+          return outcome::success();
+        }));
+    return outcome::success();
+  }
+
+}  // namespace kagome::benchmark
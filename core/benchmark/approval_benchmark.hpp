@@ -0,0 +1,51 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <optional>
+
+#include "benchmark/benchmark_scenario.hpp"
+#include "filesystem/common.hpp"
+#include "log/logger.hpp"
+
+namespace kagome::benchmark {
+
+  /**
+   * Replays approval-distribution traffic of one relay block, a delay
+   * assignment and an approval of every validator, through the checks of
+   * approval distribution on one thread and on a pool of threads.
+   * Traffic is generated and recorded to file if the file doesn't exist.
+   */
+  class ApprovalBenchmark : public BenchmarkScenario {
+   public:
+    enum class Error {
+      INVALID_MESSAGE,
+    };
+
+    struct Config {
+      uint32_t validators;
+      uint32_t threads;
+      uint16_t times;
+      std::optional<filesystem::path> traffic;
+    };
+
+    explicit ApprovalBenchmark(Config config);
+
+    std::string_view name() const override {
+      return "approval";
+    }
+
+    outcome::result<void> run(BenchmarkReport &report) override;
+
+   private:
+    log::Logger logger_;
+    Config config_;
+  };
+
+}  // namespace kagome::benchmark
+
+OUTCOME_HPP_DECLARE_ERROR(kagome::benchmark, ApprovalBenchmark::Error);
@@ -0,0 +1,132 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmark/benchmark_report.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+#include <boost/assert.hpp>
+
+#define RAPIDJSON_NO_SIZETYPEDEFINE
+namespace rapidjson {
+  typedef ::std::size_t SizeType;
+}
+#include <rapidjson/document.h>
+#include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/prettywriter.h>
+
+namespace kagome::benchmark {
+
+  BenchmarkStats BenchmarkStats::of(
+      std::vector<std::chrono::nanoseconds> samples, size_t ops) {
+    BOOST_ASSERT(not samples.empty());
+    BOOST_ASSERT(ops != 0);
+    std::ranges::sort(samples);
+    auto per_op = [&](std::chrono::nanoseconds duration) {
+      return Duration{duration} / ops;
+    };
+    auto percentile = [&](size_t p) {
+      auto rank = (samples.size() * p + 99) / 100;
+      return per_op(samples[std::max<size_t>(rank, 1) - 1]);
+    };
+    auto total = std::accumulate(
+        samples.begin(), samples.end(), std::chrono::nanoseconds{0});
+    return BenchmarkStats{
+        .samples = samples.size(),
+        .ops = ops,
+        .min = per_op(samples.front()),
+        .avg = per_op(total) / samples.size(),
+        .p50 = percentile(50),
+        .p90 = percentile(90),
+        .p99 = percentile(99),
+        .max = per_op(samples.back()),
+    };
+  }
+
+  BenchmarkReport::BenchmarkReport(std::string version)
+      : logger_{log::createLogger("BenchmarkReport", "benchmark")},
+        version_{std::move(version)} {}
+
+  void BenchmarkReport::add(std::string_view scenario,
+                            std::string name,
+                            std::vector<std::chrono::nanoseconds> samples,
+                            size_t ops) {
+    if (samples.empty()) {
+      return;
+    }
+    auto &entry = entries_.emplace_back(Entry{
+        std::string{scenario},
+        std::move(name),
+        BenchmarkStats::of(std::move(samples), ops),
+    });
+    SL_INFO(logger_,
+            "{}/{}: {} runs of {} ops, per op min {:.0f} ns, p50 {:.0f} ns, "
+            "p99 {:.0f} ns, max {:.0f} ns",
+            entry.scenario,
+            entry.name,
+            entry.stats.samples,
+            entry.stats.ops,
+            entry.stats.min.count(),
+            entry.stats.p50.count(),
+            entry.stats.p99.count(),
+            entry.stats.max.count());
+  }
+
+  std::string BenchmarkReport::toJson() const {
+    rapidjson::Document document;
+    document.SetObject();
+    auto &allocator = document.GetAllocator();
+    auto str_val = [&](std::string_view str) {
+      return rapidjson::Value(str.data(), str.size(), allocator);
+    };
+    document.AddMember("version", str_val(version_), allocator);
+    document.AddMember("unit", "ns", allocator);
+
+    rapidjson::Value results{rapidjson::kArrayType};
+    for (auto &[scenario, name, stats] : entries_) {
+      rapidjson::Value result{rapidjson::kObjectType};
+      result.AddMember("scenario", str_val(scenario), allocator);
+      result.AddMember("name", str_val(name), allocator);
+      result.AddMember("samples", stats.samples, allocator);
+      result.AddMember("ops", stats.ops, allocator);
+      result.AddMember("min", stats.min.count(), allocator);
+      result.AddMember("avg", stats.avg.count(), allocator);
+      result.AddMember("p50", stats.p50.count(), allocator);
+      result.AddMember("p90", stats.p90.count(), allocator);
+      result.AddMember("p99", stats.p99.count(), allocator);
+      result.AddMember("max", stats.max.count(), allocator);
+      results.PushBack(result, allocator);
+    }
+    document.AddMember("results", results, allocator);
+
+    std::stringstream out;
+    rapidjson::OStreamWrapper stream = out;
+    rapidjson::PrettyWriter writer(stream);
+    document.Accept(writer);
+    return out.str();
+  }
+
+  outcome::result<void> BenchmarkReport::write(
+      const std::optional<filesystem::path> &path) const {
+    auto json = toJson();
+    if (not path) {
+      std::cout << json << std::endl;
+      return outcome::success();
+    }
+    std::ofstream file{*path};
+    file << json << std::endl;
+    if (not file) {
+      return std::errc::io_error;
+    }
+    SL_INFO(logger_, "Benchmark results are written to {}", path->native());
+    return outcome::success();
+  }
+
+}  // namespace kagome::benchmark
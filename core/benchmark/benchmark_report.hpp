@@ -0,0 +1,99 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "filesystem/common.hpp"
+#include "log/logger.hpp"
+#include "outcome/outcome.hpp"
+
+namespace kagome::benchmark {
+
+  /**
+   * Summary of repeated runs of a measured operation, durations are per
+   * single operation
+   */
+  struct BenchmarkStats {
+    using Duration = std::chrono::duration<double, std::nano>;
+
+    /// nearest-rank percentiles of sorted samples
+    static BenchmarkStats of(std::vector<std::chrono::nanoseconds> samples,
+                             size_t ops);
+
+    size_t samples;
+    size_t ops;
+    Duration min;
+    Duration avg;
+    Duration p50;
+    Duration p90;
+    Duration p99;
+    Duration max;
+  };
+
+  /**
+   * Collects results of benchmark scenarios, prints them as they arrive and
+   * writes them as JSON, so results can be compared between releases
+   */
+  class BenchmarkReport {
+   public:
+    struct Entry {
+      std::string scenario;
+      std::string name;
+      BenchmarkStats stats;
+    };
+
+    explicit BenchmarkReport(std::string version);
+
+    /**
+     * Runs `f` `times` times and records durations of the runs
+     * @param ops number of operations performed by a single run of `f`
+     */
+    template <typename F>
+    outcome::result<void> measure(std::string_view scenario,
+                                  std::string name,
+                                  uint16_t times,
+                                  size_t ops,
+                                  const F &f) {
+      std::vector<std::chrono::nanoseconds> samples;
+      samples.reserve(times);
+      for (uint16_t i = 0; i < times; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        OUTCOME_TRY(f());
+        samples.emplace_back(std::chrono::steady_clock::now() - start);
+      }
+      add(scenario, std::move(name), std::move(samples), ops);
+      return outcome::success();
+    }
+
+    void add(std::string_view scenario,
+             std::string name,
+             std::vector<std::chrono::nanoseconds> samples,
+             size_t ops = 1);
+
+    const std::vector<Entry> &entries() const {
+      return entries_;
+    }
+
+    std::string toJson() const;
+
+    /**
+     * Writes JSON to the file, or to stdout if path is not provided
+     */
+    outcome::result<void> write(
+        const std::optional<filesystem::path> &path) const;
+
+   private:
+    log::Logger logger_;
+    std::string version_;
+    std::vector<Entry> entries_;
+  };
+
+}  // namespace kagome::benchmark
@@ -0,0 +1,28 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <string_view>
+
+#include "benchmark/benchmark_report.hpp"
+
+namespace kagome::benchmark {
+
+  /**
+   * A named set of measurements run by `kagome benchmark <name>`, results are
+   * collected into the report
+   */
+  class BenchmarkScenario {
+   public:
+    virtual ~BenchmarkScenario() = default;
+
+    virtual std::string_view name() const = 0;
+
+    virtual outcome::result<void> run(BenchmarkReport &report) = 0;
+  };
+
+}  // namespace kagome::benchmark
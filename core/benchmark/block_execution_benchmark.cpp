@@ -13,6 +13,7 @@
 
 #include "blockchain/block_tree.hpp"
 #include "primitives/runtime_dispatch_info.hpp"
+#include "runtime/common/host_api_profiler.hpp"
 #include "runtime/module_repository.hpp"
 #include "runtime/runtime_api/core.hpp"
 #include "storage/trie/trie_storage.hpp"
@@ -300,6 +301,7 @@ namespace kagome::benchmark {
           primitives::BlockInfo{block_hashes[i], blocks[i].header.number}});
     }
     auto duration_stat_it = duration_stats.begin();
+    runtime::HostApiProfiler::reset();
     for (size_t block_i = 0; block_i < blocks.size(); block_i++) {
       OUTCOME_TRY(module_repo_->getInstanceAt(
           primitives::BlockInfo{block_hashes[block_i],
@@ -345,6 +347,26 @@ namespace kagome::benchmark {
               * 100.0);
     }
 
+    if (runtime::HostApiProfiler::enabled()) {
+      auto entries = runtime::HostApiProfiler::snapshot();
+      uint64_t total_ns = 0;
+      for (auto &entry : entries) {
+        total_ns += entry.stats.nanoseconds;
+      }
+      fmt::print("Host API calls, by time spent:\n");
+      for (auto &[runtime_call, method, stats] : entries) {
+        fmt::print("{} {}: {} calls, {}, {} bytes ({:.2f} %)\n",
+                   runtime_call,
+                   method,
+                   stats.calls,
+                   pretty_duration{std::chrono::nanoseconds{stats.nanoseconds}},
+                   stats.bytes,
+                   static_cast<double>(stats.nanoseconds)
+                       / static_cast<double>(std::max<uint64_t>(total_ns, 1))
+                       * 100.0);
+      }
+    }
+
     return outcome::success();
   }
 
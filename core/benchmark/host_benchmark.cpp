@@ -0,0 +1,188 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmark/host_benchmark.hpp"
+
+#include <algorithm>
+#include <random>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include "crypto/ed25519/ed25519_provider_impl.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "crypto/sr25519/sr25519_provider_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_impl.hpp"
+
+OUTCOME_CPP_DEFINE_CATEGORY(kagome::benchmark, HostBenchmark::Error, e) {
+  switch (e) {
+    using E = kagome::benchmark::HostBenchmark::Error;
+    case E::SIGNATURE_MISMATCH:
+      return "Signature produced by the benchmark was not verified";
+  }
+  return "Unknown HostBenchmark error";
+}
+
+namespace kagome::benchmark {
+
+  namespace {
+    common::Buffer randomBuffer(std::mt19937_64 &random, size_t size) {
+      common::Buffer buffer(size, 0);
+      std::ranges::generate(
+          buffer, [&] { return static_cast<uint8_t>(random()); });
+      return buffer;
+    }
+
+    template <typename Seed>
+    outcome::result<Seed> randomSeed(std::mt19937_64 &random) {
+      crypto::SecureBuffer<> seed(Seed::size());
+      std::ranges::generate(
+          seed, [&] { return static_cast<uint8_t>(random()); });
+      return Seed::from(std::move(seed));
+    }
+  }  // namespace
+
+  HostBenchmark::HostBenchmark(Config config)
+      : logger_{log::createLogger("HostBenchmark", "benchmark")},
+        config_{config} {}
+
+  outcome::result<void> HostBenchmark::run(BenchmarkReport &report) {
+    OUTCOME_TRY(hashing(report));
+    OUTCOME_TRY(signatures(report));
+    OUTCOME_TRY(storageOps(report));
+    return outcome::success();
+  }
+
+  outcome::result<void> HostBenchmark::hashing(BenchmarkReport &report) {
+    crypto::HasherImpl hasher;
+    std::mt19937_64 random{0};
+    for (size_t size : {32, 1024}) {
+      auto data = randomBuffer(random, size);
+      auto measure = [&](std::string_view hash, const auto &f) {
+        auto run = [&]() -> outcome::result<void> {
+          for (size_t i = 0; i < kOps; ++i) {
+            ::benchmark::DoNotOptimize(f(data));
+          }
+          return outcome::success();
+        };
+        return report.measure(
+            name(), fmt::format("{}/{}", hash, size), config_.times, kOps, run);
+      };
+      OUTCOME_TRY(measure("blake2b_256", [&](common::BufferView in) {
+        return hasher.blake2b_256(in);
+      }));
+      OUTCOME_TRY(measure("twox_128", [&](common::BufferView in) {
+        return hasher.twox_128(in);
+      }));
+      OUTCOME_TRY(measure("keccak_256", [&](common::BufferView in) {
+        return hasher.keccak_256(in);
+      }));
+      OUTCOME_TRY(measure("sha2_256", [&](common::BufferView in) {
+        return hasher.sha2_256(in);
+      }));
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> HostBenchmark::signatures(BenchmarkReport &report) {
+    // verification is slower than hashing by orders of magnitude
+    constexpr size_t kVerifyOps = kOps / 10;
+    std::mt19937_64 random{1};
+    auto message = randomBuffer(random, 32);
+
+    crypto::Sr25519ProviderImpl sr25519;
+    OUTCOME_TRY(sr25519_seed, randomSeed<crypto::Sr25519Seed>(random));
+    OUTCOME_TRY(sr25519_keypair, sr25519.generateKeypair(sr25519_seed, {}));
+    OUTCOME_TRY(sr25519_signature, sr25519.sign(sr25519_keypair, message));
+    OUTCOME_TRY(report.measure(
+        name(),
+        "sr25519_verify",
+        config_.times,
+        kVerifyOps,
+        [&]() -> outcome::result<void> {
+          for (size_t i = 0; i < kVerifyOps; ++i) {
+            OUTCOME_TRY(valid,
+                        sr25519.verify(sr25519_signature,
+                                       message,
+                                       sr25519_keypair.public_key));
+            if (not valid) {
+              return Error::SIGNATURE_MISMATCH;
+            }
+          }
+          return outcome::success();
+        }));
+
+    crypto::Ed25519ProviderImpl ed25519{
+        std::make_shared<crypto::HasherImpl>()};
+    OUTCOME_TRY(ed25519_seed, randomSeed<crypto::Ed25519Seed>(random));
+    OUTCOME_TRY(ed25519_keypair, ed25519.generateKeypair(ed25519_seed, {}));
+    OUTCOME_TRY(ed25519_signature, ed25519.sign(ed25519_keypair, message));
+    OUTCOME_TRY(report.measure(
+        name(),
+        "ed25519_verify",
+        config_.times,
+        kVerifyOps,
+        [&]() -> outcome::result<void> {
+          for (size_t i = 0; i < kVerifyOps; ++i) {
+            OUTCOME_TRY(valid,
+                        ed25519.verify(ed25519_signature,
+                                       message,
+                                       ed25519_keypair.public_key));
+            if (not valid) {
+              return Error::SIGNATURE_MISMATCH;
+            }
+          }
+          return outcome::success();
+        }));
+    return outcome::success();
+  }
+
+  outcome::result<void> HostBenchmark::storageOps(BenchmarkReport &report) {
+    std::mt19937_64 random{2};
+    auto trie = storage::trie::PolkadotTrieImpl::createEmpty();
+    std::vector<common::Buffer> keys;
+    keys.reserve(kStorageKeys);
+    for (size_t i = 0; i < kStorageKeys; ++i) {
+      auto &key = keys.emplace_back(randomBuffer(random, 32));
+      OUTCOME_TRY(trie->put(key, randomBuffer(random, 32)));
+    }
+    std::vector<common::Buffer> new_keys;
+    for (size_t i = 0; i < kOps; ++i) {
+      new_keys.emplace_back(randomBuffer(random, 32));
+    }
+    auto value = randomBuffer(random, 32);
+
+    std::vector<std::chrono::nanoseconds> gets, sets, clears;
+    for (uint16_t run = 0; run < config_.times; ++run) {
+      std::ranges::shuffle(keys, random);
+
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < kOps; ++i) {
+        OUTCOME_TRY(stored, trie->tryGet(keys[i]));
+        ::benchmark::DoNotOptimize(stored);
+      }
+      gets.emplace_back(std::chrono::steady_clock::now() - start);
+
+      start = std::chrono::steady_clock::now();
+      for (auto &key : new_keys) {
+        OUTCOME_TRY(trie->put(key, common::BufferView{value}));
+      }
+      sets.emplace_back(std::chrono::steady_clock::now() - start);
+
+      // new keys are removed, so every run starts with the same trie
+      start = std::chrono::steady_clock::now();
+      for (auto &key : new_keys) {
+        OUTCOME_TRY(trie->remove(key));
+      }
+      clears.emplace_back(std::chrono::steady_clock::now() - start);
+    }
+    report.add(name(), "storage_get", std::move(gets), kOps);
+    report.add(name(), "storage_set", std::move(sets), kOps);
+    report.add(name(), "storage_clear", std::move(clears), kOps);
+    return outcome::success();
+  }
+
+}  // namespace kagome::benchmark
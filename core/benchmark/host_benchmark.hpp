@@ -0,0 +1,52 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "benchmark/benchmark_scenario.hpp"
+#include "log/logger.hpp"
+
+namespace kagome::benchmark {
+
+  /**
+   * Microbenchmarks of primitives behind host functions: hashing, signature
+   * verification and storage operations on an in-memory trie
+   */
+  class HostBenchmark : public BenchmarkScenario {
+   public:
+    enum class Error {
+      SIGNATURE_MISMATCH,
+    };
+
+    struct Config {
+      uint16_t times;
+    };
+
+    /// operations per measured run
+    static constexpr size_t kOps = 1000;
+    /// keys in the trie of storage operations
+    static constexpr size_t kStorageKeys = 100000;
+
+    explicit HostBenchmark(Config config);
+
+    std::string_view name() const override {
+      return "host";
+    }
+
+    outcome::result<void> run(BenchmarkReport &report) override;
+
+   private:
+    outcome::result<void> hashing(BenchmarkReport &report);
+    outcome::result<void> signatures(BenchmarkReport &report);
+    outcome::result<void> storageOps(BenchmarkReport &report);
+
+    log::Logger logger_;
+    Config config_;
+  };
+
+}  // namespace kagome::benchmark
+
+OUTCOME_HPP_DECLARE_ERROR(kagome::benchmark, HostBenchmark::Error);
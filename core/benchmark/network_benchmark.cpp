@@ -0,0 +1,186 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmark/network_benchmark.hpp"
+
+#include <fmt/format.h>
+#include <libp2p/connection/stream.hpp>
+#include <libp2p/peer/peer_id.hpp>
+
+#include "network/impl/stream_engine.hpp"
+#include "network/types/block_announce.hpp"
+
+OUTCOME_CPP_DEFINE_CATEGORY(kagome::benchmark, NetworkBenchmark::Error, e) {
+  switch (e) {
+    using E = kagome::benchmark::NetworkBenchmark::Error;
+    case E::BYTES_MISMATCH:
+      return "Bytes written to peer streams differ from the broadcast size";
+  }
+  return "Unknown NetworkBenchmark error";
+}
+
+namespace kagome::benchmark {
+
+  namespace {
+    using libp2p::connection::Stream;
+    using libp2p::peer::PeerId;
+
+    /// Stream of a peer with an instant connection, counts written bytes
+    struct NullStream final : Stream {
+      explicit NullStream(PeerId peer_id) : peer_id{std::move(peer_id)} {}
+
+      void read(BytesOut out, size_t bytes, ReadCallbackFunc cb) override {
+        cb(std::make_error_code(std::errc::not_supported));
+      }
+      void readSome(BytesOut out, size_t bytes, ReadCallbackFunc cb) override {
+        cb(std::make_error_code(std::errc::not_supported));
+      }
+      void deferReadCallback(outcome::result<size_t> res,
+                             ReadCallbackFunc cb) override {
+        cb(res);
+      }
+
+      void writeSome(BytesIn in, size_t bytes, WriteCallbackFunc cb) override {
+        written += bytes;
+        cb(bytes);
+      }
+      void deferWriteCallback(std::error_code ec,
+                              WriteCallbackFunc cb) override {
+        cb(ec);
+      }
+
+      bool isClosedForRead() const override {
+        return false;
+      }
+      bool isClosedForWrite() const override {
+        return false;
+      }
+      bool isClosed() const override {
+        return false;
+      }
+      void close(VoidResultHandlerFunc cb) override {
+        cb(outcome::success());
+      }
+      void reset() override {}
+      void adjustWindowSize(uint32_t new_size,
+                            VoidResultHandlerFunc cb) override {
+        cb(outcome::success());
+      }
+      outcome::result<bool> isInitiator() const override {
+        return true;
+      }
+      outcome::result<PeerId> remotePeerId() const override {
+        return peer_id;
+      }
+      outcome::result<libp2p::multi::Multiaddress> localMultiaddr()
+          const override {
+        return std::make_error_code(std::errc::not_supported);
+      }
+      outcome::result<libp2p::multi::Multiaddress> remoteMultiaddr()
+          const override {
+        return std::make_error_code(std::errc::not_supported);
+      }
+
+      PeerId peer_id;
+      size_t written = 0;
+    };
+
+    /// Protocol whose streams are added to StreamEngine directly
+    struct NullProtocol final : network::ProtocolBase {
+      const network::ProtocolName &protocolName() const override {
+        return name;
+      }
+      bool start() override {
+        return true;
+      }
+      void onIncomingStream(std::shared_ptr<Stream>) override {}
+      void newOutgoingStream(
+          const PeerId &,
+          std::function<void(outcome::result<std::shared_ptr<Stream>>)> &&cb)
+          override {
+        cb(std::make_error_code(std::errc::not_supported));
+      }
+
+      network::ProtocolName name{"/benchmark/1"};
+    };
+
+    /// announce of a block with BABE pre-runtime and seal digests
+    network::BlockAnnounce blockAnnounce() {
+      primitives::BlockHeader header{.number = 1};
+      header.digest.emplace_back(primitives::PreRuntime{
+          {primitives::kBabeEngineId,
+           common::Buffer{std::vector<uint8_t>(21, 1)}}});
+      header.digest.emplace_back(primitives::Seal{
+          {primitives::kBabeEngineId,
+           common::Buffer{std::vector<uint8_t>(64, 2)}}});
+      return network::BlockAnnounce{
+          .header = std::move(header),
+          .state = network::BlockState::Best,
+          .data = std::vector<uint8_t>{},
+      };
+    }
+  }  // namespace
+
+  NetworkBenchmark::NetworkBenchmark(Config config)
+      : logger_{log::createLogger("NetworkBenchmark", "benchmark")},
+        config_{config} {}
+
+  outcome::result<void> NetworkBenchmark::run(BenchmarkReport &report) {
+    auto protocol = std::make_shared<NullProtocol>();
+    // reputation is changed only when an outgoing stream can't be opened
+    auto engine = std::make_shared<network::StreamEngine>(nullptr);
+    std::vector<std::shared_ptr<NullStream>> streams;
+    for (uint32_t i = 0; i < config_.peers; ++i) {
+      auto key = fmt::format("benchmark-peer-{}", i);
+      OUTCOME_TRY(peer_id,
+                  PeerId::fromPublicKey(libp2p::crypto::ProtobufKey{
+                      std::vector<uint8_t>(key.begin(), key.end())}));
+      auto &stream =
+          streams.emplace_back(std::make_shared<NullStream>(peer_id));
+      engine->addOutgoing(stream, protocol);
+    }
+
+    auto msg = std::make_shared<network::BlockAnnounce>(blockAnnounce());
+    OUTCOME_TRY(encoded, network::ScaleMessageReadWriter::encode(*msg));
+    SL_INFO(logger_,
+            "Broadcast of {} bytes to {} peers",
+            encoded->size(),
+            config_.peers);
+    auto suffix = fmt::format("{}-peers", config_.peers);
+
+    OUTCOME_TRY(report.measure(name(),
+                               "broadcast/" + suffix,
+                               config_.times,
+                               1,
+                               [&]() -> outcome::result<void> {
+                                 engine->broadcast(protocol, msg);
+                                 return outcome::success();
+                               }));
+    for (auto &stream : streams) {
+      if (stream->written != encoded->size() * config_.times) {
+        return Error::BYTES_MISMATCH;
+      }
+    }
+
+    // writes through a reader-writer per peer, which encodes the message for
+    // each of them, for comparison
+    OUTCOME_TRY(report.measure(
+        name(),
+        "write-per-peer/" + suffix,
+        config_.times,
+        1,
+        [&]() -> outcome::result<void> {
+          for (auto &stream : streams) {
+            auto read_writer =
+                std::make_shared<network::ScaleMessageReadWriter>(stream);
+            read_writer->write(*msg, [](auto &&) {});
+          }
+          return outcome::success();
+        }));
+    return outcome::success();
+  }
+
+}  // namespace kagome::benchmark
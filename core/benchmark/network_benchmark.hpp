@@ -0,0 +1,44 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "benchmark/benchmark_scenario.hpp"
+#include "log/logger.hpp"
+
+namespace kagome::benchmark {
+
+  /**
+   * Measures gossip fan-out of StreamEngine: a block announce is broadcast
+   * to peers with streams that complete writes immediately
+   */
+  class NetworkBenchmark : public BenchmarkScenario {
+   public:
+    enum class Error {
+      BYTES_MISMATCH,
+    };
+
+    struct Config {
+      uint32_t peers;
+      uint16_t times;
+    };
+
+    explicit NetworkBenchmark(Config config);
+
+    std::string_view name() const override {
+      return "network";
+    }
+
+    outcome::result<void> run(BenchmarkReport &report) override;
+
+   private:
+    log::Logger logger_;
+    Config config_;
+  };
+
+}  // namespace kagome::benchmark
+
+OUTCOME_HPP_DECLARE_ERROR(kagome::benchmark, NetworkBenchmark::Error);
@@ -0,0 +1,135 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmark/parachain_benchmark.hpp"
+
+#include <algorithm>
+#include <random>
+
+#include <fmt/format.h>
+#include <libp2p/common/final_action.hpp>
+
+#include "common/worker_thread_pool.hpp"
+#include "parachain/availability/chunks.hpp"
+#include "parachain/availability/proof.hpp"
+
+OUTCOME_CPP_DEFINE_CATEGORY(kagome::benchmark, ParachainBenchmark::Error, e) {
+  switch (e) {
+    using E = kagome::benchmark::ParachainBenchmark::Error;
+    case E::RECOVERED_DATA_MISMATCH:
+      return "Data recovered from erasure chunks differs from the original";
+  }
+  return "Unknown ParachainBenchmark error";
+}
+
+namespace kagome::benchmark {
+
+  const std::vector<uint32_t> ParachainBenchmark::kSweepValidators{
+      10, 100, 300, 500, 1000};
+  const std::vector<uint32_t> ParachainBenchmark::kSweepPovSizes{
+      1 << 10, 64 << 10, 1 << 20, 5 << 20, 10 << 20};
+
+  ParachainBenchmark::ParachainBenchmark(Config config)
+      : logger_{log::createLogger("ParachainBenchmark", "benchmark")},
+        config_{std::move(config)} {}
+
+  outcome::result<void> ParachainBenchmark::run(BenchmarkReport &report) {
+    // same pool as the node hashes chunks on
+    auto watchdog = std::make_shared<Watchdog>(std::chrono::milliseconds{1});
+    auto pool = std::make_shared<common::WorkerThreadPool>(
+        watchdog, std::max(3u, std::thread::hardware_concurrency()) - 1);
+    // pool threads exit only after the watchdog is stopped
+    ::libp2p::common::FinalAction stop_pool([&] {
+      watchdog->stop();
+      pool.reset();
+    });
+    for (auto validators : config_.validators) {
+      for (auto pov_size : config_.pov_sizes) {
+        OUTCOME_TRY(runFor(report, *pool, validators, pov_size));
+      }
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> ParachainBenchmark::runFor(BenchmarkReport &report,
+                                                   const ThreadPool &pool,
+                                                   uint32_t validators,
+                                                   uint32_t pov_size) {
+    std::mt19937_64 random{pov_size};
+    runtime::AvailableData data;
+    data.pov.payload.resize(pov_size);
+    std::ranges::generate(data.pov.payload,
+                          [&] { return static_cast<uint8_t>(random()); });
+    OUTCOME_TRY(encoded, scale::encode(data));
+    auto suffix = fmt::format("{}-validators/{}-bytes", validators, pov_size);
+
+    OUTCOME_TRY(chunks, parachain::toChunks(validators, data));
+    OUTCOME_TRY(report.measure(name(),
+                               "erasure-encode/" + suffix,
+                               config_.times,
+                               1,
+                               [&]() -> outcome::result<void> {
+                                 OUTCOME_TRY(parachain::toChunks(
+                                     validators, data));
+                                 return outcome::success();
+                               }));
+
+    auto root = parachain::makeTrieProof(chunks, pool);
+    OUTCOME_TRY(report.measure(name(),
+                               "chunk-proofs/" + suffix,
+                               config_.times,
+                               1,
+                               [&]() -> outcome::result<void> {
+                                 auto copy = chunks;
+                                 parachain::makeTrieProof(copy, pool);
+                                 return outcome::success();
+                               }));
+    OUTCOME_TRY(report.measure(name(),
+                               "chunk-verify/" + suffix,
+                               config_.times,
+                               chunks.size(),
+                               [&]() -> outcome::result<void> {
+                                 for (auto &chunk : chunks) {
+                                   OUTCOME_TRY(parachain::checkTrieProof(
+                                       chunk, root));
+                                 }
+                                 return outcome::success();
+                               }));
+
+    OUTCOME_TRY(min_chunks, parachain::minChunks(validators));
+    auto recover = [&](std::string_view kind,
+                       std::vector<network::ErasureChunk> subset,
+                       auto &&from_chunks) {
+      return report.measure(
+          name(),
+          fmt::format("erasure-recover-{}/{}", kind, suffix),
+          config_.times,
+          1,
+          [&]() -> outcome::result<void> {
+            OUTCOME_TRY(recovered, from_chunks(validators, subset));
+            OUTCOME_TRY(recovered_encoded, scale::encode(recovered));
+            if (recovered_encoded != encoded) {
+              return Error::RECOVERED_DATA_MISMATCH;
+            }
+            return outcome::success();
+          });
+    };
+    // systematic recovery needs the first chunks, regular one may use any
+    OUTCOME_TRY(recover(
+        "systematic",
+        {chunks.begin(), chunks.begin() + min_chunks},
+        [](size_t n_validators, const auto &subset) {
+          return parachain::fromSystematicChunks(n_validators, subset);
+        }));
+    OUTCOME_TRY(recover("regular",
+                        {chunks.end() - min_chunks, chunks.end()},
+                        [](size_t n_validators, const auto &subset) {
+                          return parachain::fromChunks(n_validators, subset);
+                        }));
+    return outcome::success();
+  }
+
+}  // namespace kagome::benchmark
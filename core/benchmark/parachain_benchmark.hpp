@@ -0,0 +1,61 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "benchmark/benchmark_scenario.hpp"
+#include "log/logger.hpp"
+
+namespace kagome {
+  class ThreadPool;
+}  // namespace kagome
+
+namespace kagome::benchmark {
+
+  /**
+   * Measures availability work of a validator on a synthetic PoV: erasure
+   * coding, chunk Merkle proofs and recovery of available data.
+   * Runs for each combination of validator count and PoV size.
+   */
+  class ParachainBenchmark : public BenchmarkScenario {
+   public:
+    enum class Error {
+      RECOVERED_DATA_MISMATCH,
+    };
+
+    struct Config {
+      std::vector<uint32_t> validators;
+      std::vector<uint32_t> pov_sizes;
+      uint16_t times;
+    };
+
+    /// Validator counts and PoV sizes of `--sweep`
+    static const std::vector<uint32_t> kSweepValidators;
+    static const std::vector<uint32_t> kSweepPovSizes;
+
+    explicit ParachainBenchmark(Config config);
+
+    std::string_view name() const override {
+      return "parachain";
+    }
+
+    outcome::result<void> run(BenchmarkReport &report) override;
+
+   private:
+    outcome::result<void> runFor(BenchmarkReport &report,
+                                 const ThreadPool &pool,
+                                 uint32_t validators,
+                                 uint32_t pov_size);
+
+    log::Logger logger_;
+    Config config_;
+  };
+
+}  // namespace kagome::benchmark
+
+OUTCOME_HPP_DECLARE_ERROR(kagome::benchmark, ParachainBenchmark::Error);
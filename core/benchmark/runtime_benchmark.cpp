@@ -0,0 +1,114 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmark/runtime_benchmark.hpp"
+
+#include <fmt/format.h>
+#include <libp2p/common/final_action.hpp>
+
+#include "application/app_configuration.hpp"
+#include "blockchain/block_tree.hpp"
+#include "runtime/common/uncompress_code_if_needed.hpp"
+#include "runtime/module.hpp"
+#include "runtime/module_factory.hpp"
+#include "runtime/runtime_api/core.hpp"
+#include "runtime/runtime_code_provider.hpp"
+#include "utils/mkdirs.hpp"
+
+namespace kagome::benchmark {
+
+  RuntimeBenchmark::RuntimeBenchmark(
+      const application::AppConfiguration &app_config,
+      std::shared_ptr<const blockchain::BlockTree> block_tree,
+      std::shared_ptr<runtime::RuntimeCodeProvider> code_provider,
+      std::shared_ptr<runtime::ModuleFactory> module_factory,
+      std::shared_ptr<runtime::Core> core_api)
+      : logger_{log::createLogger("RuntimeBenchmark", "benchmark")},
+        config_{.times = 1},
+        block_tree_{std::move(block_tree)},
+        code_provider_{std::move(code_provider)},
+        module_factory_{std::move(module_factory)},
+        core_api_{std::move(core_api)} {
+    BOOST_ASSERT(block_tree_ != nullptr);
+    BOOST_ASSERT(code_provider_ != nullptr);
+    BOOST_ASSERT(module_factory_ != nullptr);
+    BOOST_ASSERT(core_api_ != nullptr);
+    if (auto config = app_config.getBenchmarkConfig()) {
+      if (auto runtime_config =
+              std::get_if<application::RuntimeBenchmarkConfig>(&*config)) {
+        config_.times = runtime_config->times;
+      }
+    }
+  }
+
+  outcome::result<void> RuntimeBenchmark::run(BenchmarkReport &report) {
+    auto best = block_tree_->bestBlock();
+    OUTCOME_TRY(header, block_tree_->getBlockHeader(best.hash));
+    OUTCOME_TRY(code_zstd, code_provider_->getCodeAt(header.state_root));
+    OUTCOME_TRY(code, runtime::uncompressCodeIfNeeded(*code_zstd));
+    auto backend = module_factory_->compilerType().value_or("interpreter");
+    SL_INFO(logger_,
+            "Runtime of block {}, {} bytes, {} backend",
+            best,
+            code.size(),
+            backend);
+
+    auto dir = filesystem::temp_directory_path()
+             / filesystem::unique_path("kagome-benchmark-%%%%-%%%%");
+    OUTCOME_TRY(mkdirs(dir));
+    ::libp2p::common::FinalAction remove_dir([&] {
+      std::error_code ec;
+      filesystem::remove_all(dir, ec);
+    });
+    auto path = dir / "runtime";
+
+    OUTCOME_TRY(report.measure(name(),
+                               fmt::format("compile/{}", backend),
+                               config_.times,
+                               1,
+                               [&]() -> outcome::result<void> {
+                                 OUTCOME_TRY(
+                                     module_factory_->compile(path, code));
+                                 return outcome::success();
+                               }));
+
+    std::shared_ptr<runtime::Module> module;
+    OUTCOME_TRY(report.measure(name(),
+                               fmt::format("load/{}", backend),
+                               config_.times,
+                               1,
+                               [&]() -> outcome::result<void> {
+                                 BOOST_OUTCOME_TRY(
+                                     module,
+                                     module_factory_->loadCompiled(path));
+                                 return outcome::success();
+                               }));
+    if (module == nullptr) {
+      return outcome::success();
+    }
+
+    OUTCOME_TRY(report.measure(name(),
+                               fmt::format("instantiate/{}", backend),
+                               config_.times,
+                               1,
+                               [&]() -> outcome::result<void> {
+                                 OUTCOME_TRY(module->instantiate());
+                                 return outcome::success();
+                               }));
+
+    // the call includes getting a pooled instance and resetting its memory
+    OUTCOME_TRY(report.measure(name(),
+                               fmt::format("call-version/{}", backend),
+                               config_.times,
+                               1,
+                               [&]() -> outcome::result<void> {
+                                 OUTCOME_TRY(core_api_->version(best.hash));
+                                 return outcome::success();
+                               }));
+    return outcome::success();
+  }
+
+}  // namespace kagome::benchmark
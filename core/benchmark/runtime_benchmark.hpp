@@ -0,0 +1,62 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "benchmark/benchmark_scenario.hpp"
+#include "log/logger.hpp"
+
+namespace kagome::application {
+  class AppConfiguration;
+}  // namespace kagome::application
+
+namespace kagome::blockchain {
+  class BlockTree;
+}  // namespace kagome::blockchain
+
+namespace kagome::runtime {
+  class Core;
+  class ModuleFactory;
+  class RuntimeCodeProvider;
+}  // namespace kagome::runtime
+
+namespace kagome::benchmark {
+
+  /**
+   * Measures compilation, instantiation and call overhead of the runtime of
+   * the best block with the configured wasm execution backend
+   */
+  class RuntimeBenchmark : public BenchmarkScenario {
+   public:
+    struct Config {
+      uint16_t times;
+    };
+
+    RuntimeBenchmark(
+        const application::AppConfiguration &app_config,
+        std::shared_ptr<const blockchain::BlockTree> block_tree,
+        std::shared_ptr<runtime::RuntimeCodeProvider> code_provider,
+        std::shared_ptr<runtime::ModuleFactory> module_factory,
+        std::shared_ptr<runtime::Core> core_api);
+
+    std::string_view name() const override {
+      return "runtime";
+    }
+
+    outcome::result<void> run(BenchmarkReport &report) override;
+
+   private:
+    log::Logger logger_;
+    Config config_;
+    std::shared_ptr<const blockchain::BlockTree> block_tree_;
+    std::shared_ptr<runtime::RuntimeCodeProvider> code_provider_;
+    std::shared_ptr<runtime::ModuleFactory> module_factory_;
+    std::shared_ptr<runtime::Core> core_api_;
+  };
+
+}  // namespace kagome::benchmark
@@ -0,0 +1,98 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmark/storage_benchmark.hpp"
+
+#include <algorithm>
+#include <random>
+
+#include <libp2p/common/final_action.hpp>
+
+#include "storage/rocksdb/rocksdb.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/polkadot_trie/trie_error.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+
+namespace kagome::benchmark {
+  StorageBenchmark::StorageBenchmark(Config config)
+      : logger_{log::createLogger("StorageBenchmark", "benchmark")},
+        config_{std::move(config)} {}
+
+  outcome::result<void> StorageBenchmark::run(BenchmarkReport &report) {
+    rocksdb::Options options;
+    options.create_if_missing = true;
+    OUTCOME_TRY(db, storage::RocksDb::create(config_.db_path, options));
+    ::libp2p::common::FinalAction remove_db([&] {
+      db.reset();
+      std::error_code ec;
+      filesystem::remove_all(config_.db_path, ec);
+    });
+    SL_INFO(logger_, "Benchmark database at {}", config_.db_path.native());
+
+    auto factory = std::make_shared<storage::trie::PolkadotTrieFactoryImpl>();
+    auto codec = std::make_shared<storage::trie::PolkadotCodec>();
+    storage::trie::TrieSerializerImpl serializer{
+        factory,
+        codec,
+        std::make_shared<storage::trie::TrieStorageBackendImpl>(db)};
+
+    // every run writes its own pseudo-random keys, so commits are not no-ops
+    auto make_entries = [&](uint64_t seed) {
+      std::mt19937_64 random{seed};
+      std::vector<std::pair<common::Buffer, common::Buffer>> entries;
+      entries.reserve(config_.keys);
+      for (uint32_t i = 0; i < config_.keys; ++i) {
+        common::Buffer key;
+        for (auto j = 0; j < 4; ++j) {
+          key.putUint64(random());
+        }
+        common::Buffer value(32 + random() % 64, 0);
+        std::ranges::generate(
+            value, [&] { return static_cast<uint8_t>(random()); });
+        entries.emplace_back(std::move(key), std::move(value));
+      }
+      return entries;
+    };
+
+    std::vector<std::chrono::nanoseconds> puts, commits, gets;
+    for (uint16_t i = 0; i < config_.times; ++i) {
+      auto entries = make_entries(i);
+
+      auto start = std::chrono::steady_clock::now();
+      auto trie = factory->createEmpty();
+      for (auto &[key, value] : entries) {
+        OUTCOME_TRY(trie->put(key, common::BufferView{value}));
+      }
+      puts.emplace_back(std::chrono::steady_clock::now() - start);
+
+      start = std::chrono::steady_clock::now();
+      OUTCOME_TRY(root, serializer.storeTrie(*trie, config_.version));
+      commits.emplace_back(std::chrono::steady_clock::now() - start);
+      trie.reset();
+
+      // nodes are loaded from the database by the fresh trie
+      std::ranges::shuffle(entries, std::mt19937_64{i});
+      start = std::chrono::steady_clock::now();
+      OUTCOME_TRY(stored, serializer.retrieveTrie(root, nullptr));
+      for (auto &[key, value] : entries) {
+        OUTCOME_TRY(stored_value, stored->get(key));
+        if (stored_value != value) {
+          return storage::trie::TrieError::NO_VALUE;
+        }
+      }
+      gets.emplace_back(std::chrono::steady_clock::now() - start);
+      SL_VERBOSE(logger_, "Run {} of {} keys, state {}", i, config_.keys, root);
+    }
+
+    report.add(name(), "trie-put", std::move(puts), config_.keys);
+    report.add(name(), "trie-commit", std::move(commits), config_.keys);
+    report.add(name(), "trie-get", std::move(gets), config_.keys);
+    return outcome::success();
+  }
+
+}  // namespace kagome::benchmark
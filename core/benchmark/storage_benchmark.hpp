@@ -0,0 +1,41 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "benchmark/benchmark_scenario.hpp"
+#include "log/logger.hpp"
+#include "storage/trie/types.hpp"
+
+namespace kagome::benchmark {
+
+  /**
+   * Measures trie writes, commits and reads of committed keys against a
+   * RocksDB database created in a temporary directory
+   */
+  class StorageBenchmark : public BenchmarkScenario {
+   public:
+    struct Config {
+      uint32_t keys;
+      uint16_t times;
+      filesystem::path db_path;
+      storage::trie::StateVersion version = storage::trie::StateVersion::V1;
+    };
+
+    explicit StorageBenchmark(Config config);
+
+    std::string_view name() const override {
+      return "storage";
+    }
+
+    outcome::result<void> run(BenchmarkReport &report) override;
+
+   private:
+    log::Logger logger_;
+    Config config_;
+  };
+
+}  // namespace kagome::benchmark
@@ -0,0 +1,118 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmark/trie_commit_benchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+#include <fmt/format.h>
+#include <libp2p/common/final_action.hpp>
+
+#include "common/worker_thread_pool.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+
+OUTCOME_CPP_DEFINE_CATEGORY(kagome::benchmark, TrieCommitBenchmark::Error, e) {
+  switch (e) {
+    using E = kagome::benchmark::TrieCommitBenchmark::Error;
+    case E::ROOT_MISMATCH:
+      return "Parallel trie commit produced a different root hash";
+  }
+  return "Unknown TrieCommitBenchmark error";
+}
+
+namespace kagome::benchmark {
+  using storage::trie::PolkadotTrie;
+  using storage::trie::RootHash;
+
+  TrieCommitBenchmark::TrieCommitBenchmark(Config config)
+      : logger_{log::createLogger("TrieCommitBenchmark", "benchmark")},
+        config_{config} {}
+
+  outcome::result<void> TrieCommitBenchmark::run(BenchmarkReport &report) {
+    auto factory = std::make_shared<storage::trie::PolkadotTrieFactoryImpl>();
+    auto codec = std::make_shared<storage::trie::PolkadotCodec>();
+    const auto parallel_threads = std::max<uint32_t>(config_.threads, 2);
+    // committing thread encodes too, the pool lends the rest
+    auto watchdog = std::make_shared<Watchdog>(std::chrono::milliseconds{1});
+    auto pool = std::make_shared<common::WorkerThreadPool>(
+        watchdog, parallel_threads - 1);
+    // pool threads exit only after the watchdog is stopped
+    ::libp2p::common::FinalAction stop_pool([&] {
+      watchdog->stop();
+      pool.reset();
+    });
+
+    // the same pseudo-random diff for every run
+    auto make_trie = [&]() -> outcome::result<std::shared_ptr<PolkadotTrie>> {
+      std::mt19937_64 random{config_.keys};
+      auto trie = factory->createEmpty();
+      for (uint32_t i = 0; i < config_.keys; ++i) {
+        common::Buffer key;
+        for (auto j = 0; j < 4; ++j) {
+          key.putUint64(random());
+        }
+        common::Buffer value(32 + random() % 64, 0);
+        std::ranges::generate(
+            value, [&] { return static_cast<uint8_t>(random()); });
+        OUTCOME_TRY(trie->put(key, std::move(value)));
+      }
+      return trie;
+    };
+
+    std::optional<RootHash> expected_root;
+    auto measure = [&](size_t threads) -> outcome::result<void> {
+      std::vector<std::chrono::nanoseconds> durations;
+      for (uint16_t i = 0; i < config_.times; ++i) {
+        OUTCOME_TRY(trie, make_trie());
+        storage::trie::TrieSerializerImpl serializer{
+            factory,
+            codec,
+            std::make_shared<storage::trie::TrieStorageBackendImpl>(
+                std::make_shared<storage::InMemorySpacedStorage>()),
+            nullptr,
+            pool,
+            threads};
+        auto start = std::chrono::steady_clock::now();
+        OUTCOME_TRY(root, serializer.storeTrie(*trie, config_.version));
+        durations.emplace_back(std::chrono::steady_clock::now() - start);
+        if (not expected_root) {
+          expected_root = root;
+        } else if (root != *expected_root) {
+          SL_ERROR(logger_,
+                   "Root {} differs from {} with {} threads",
+                   root,
+                   *expected_root,
+                   threads);
+          return Error::ROOT_MISMATCH;
+        }
+        SL_VERBOSE(logger_,
+                   "Commit of {} keys with {} threads, {} ns",
+                   config_.keys,
+                   threads,
+                   durations.back().count());
+      }
+      report.add(
+          name(),
+          fmt::format("commit/{}-keys/{}-threads", config_.keys, threads),
+          std::move(durations));
+      return outcome::success();
+    };
+
+    if (config_.times == 0) {
+      return outcome::success();
+    }
+    OUTCOME_TRY(measure(1));
+    OUTCOME_TRY(measure(parallel_threads));
+    return outcome::success();
+  }
+
+}  // namespace kagome::benchmark
@@ -0,0 +1,49 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "benchmark/benchmark_scenario.hpp"
+#include "log/logger.hpp"
+#include "storage/trie/types.hpp"
+
+namespace kagome::benchmark {
+
+  /**
+   * Compares sequential and parallel trie commit on a synthetic state diff
+   * stored to an in-memory backend
+   */
+  class TrieCommitBenchmark : public BenchmarkScenario {
+   public:
+    enum class Error {
+      ROOT_MISMATCH,
+    };
+
+    struct Config {
+      uint32_t keys;
+      uint16_t times;
+      uint32_t threads;
+      storage::trie::StateVersion version = storage::trie::StateVersion::V1;
+    };
+
+    explicit TrieCommitBenchmark(Config config);
+
+    std::string_view name() const override {
+      return "trie-commit";
+    }
+
+    outcome::result<void> run(BenchmarkReport &report) override;
+
+   private:
+    log::Logger logger_;
+    Config config_;
+  };
+
+}  // namespace kagome::benchmark
+
+OUTCOME_HPP_DECLARE_ERROR(kagome::benchmark, TrieCommitBenchmark::Error);
@@ -16,6 +16,16 @@ namespace kagome::consensus::babe {
 
     virtual outcome::result<void> validateHeader(
         const primitives::BlockHeader &header) const = 0;
+
+    /**
+     * Checks seal and VRF of a header, whose parent is not applied yet, using
+     * epoch data known at the applied ancestor. Successful checks are
+     * remembered, so that `validateHeader` skips them if epoch data matches.
+     * @param ancestor header of applied ancestor
+     */
+    virtual void prevalidateHeader(
+        const primitives::BlockHeader &header,
+        const primitives::BlockHeader &ancestor) const = 0;
   };
 
 }  // namespace kagome::consensus::babe
@@ -40,6 +40,7 @@
 #include "runtime/runtime_api/babe_api.hpp"
 #include "runtime/runtime_api/offchain_worker_api.hpp"
 #include "storage/changes_trie/impl/storage_changes_tracker_impl.hpp"
+#include "storage/trie/flat_state.hpp"
 #include "storage/trie/serialization/ordered_trie_hash.hpp"
 #include "telemetry/service.hpp"
 
@@ -86,6 +87,7 @@ namespace kagome::consensus::babe {
       std::shared_ptr<authorship::Proposer> proposer,
       primitives::events::StorageSubscriptionEnginePtr storage_sub_engine,
       primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+      std::shared_ptr<storage::trie::FlatState> flat_state,
       std::shared_ptr<network::BlockAnnounceTransmitter> announce_transmitter,
       std::shared_ptr<runtime::BabeApi> babe_api,
       std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api,
@@ -110,6 +112,7 @@ namespace kagome::consensus::babe {
         proposer_(std::move(proposer)),
         storage_sub_engine_(std::move(storage_sub_engine)),
         chain_sub_engine_(std::move(chain_sub_engine)),
+        flat_state_(std::move(flat_state)),
         announce_transmitter_(std::move(announce_transmitter)),
         babe_api_(std::move(babe_api)),
         offchain_worker_api_(std::move(offchain_worker_api)),
@@ -266,6 +269,11 @@ namespace kagome::consensus::babe {
     return validating_->validateHeader(block_header);
   }
 
+  void Babe::prevalidateHeader(const primitives::BlockHeader &block_header,
+                               const primitives::BlockHeader &ancestor) const {
+    validating_->prevalidateHeader(block_header, ancestor);
+  }
+
   outcome::result<void> Babe::reportEquivocation(
       const primitives::BlockHash &first_hash,
       const primitives::BlockHash &second_hash) const {
@@ -618,6 +626,17 @@ namespace kagome::consensus::babe {
     changes_tracker->onBlockAdded(
         block_info.hash, storage_sub_engine_, chain_sub_engine_);
 
+    if (flat_state_ != nullptr) {
+      auto changes = changes_tracker->mainTrieChanges();
+      auto parent = block_tree_->getBlockHeader(block.header.parent_hash);
+      if (changes and parent) {
+        flat_state_->onBlockExecuted(block.header.number,
+                                     parent.value().state_root,
+                                     block.header.state_root,
+                                     std::move(*changes));
+      }
+    }
+
     telemetry_->notifyBlockImported(block_info, telemetry::BlockOrigin::kOwn);
     telemetry_->pushBlockStats();
 
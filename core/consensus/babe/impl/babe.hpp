@@ -84,6 +84,10 @@ namespace kagome::storage::changes_trie {
   class StorageChangesTrackerImpl;
 }
 
+namespace kagome::storage::trie {
+  class FlatState;
+}
+
 namespace kagome::consensus::babe {
 
   /// BABE protocol, used for block production in the Polkadot consensus.
@@ -117,6 +121,7 @@ namespace kagome::consensus::babe {
         std::shared_ptr<authorship::Proposer> proposer,
         primitives::events::StorageSubscriptionEnginePtr storage_sub_engine,
         primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+        std::shared_ptr<storage::trie::FlatState> flat_state,
         std::shared_ptr<network::BlockAnnounceTransmitter> announce_transmitter,
         std::shared_ptr<runtime::BabeApi> babe_api,
         std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api,
@@ -143,6 +148,10 @@ namespace kagome::consensus::babe {
     outcome::result<void> validateHeader(
         const primitives::BlockHeader &block_header) const override;
 
+    void prevalidateHeader(
+        const primitives::BlockHeader &block_header,
+        const primitives::BlockHeader &ancestor) const override;
+
     outcome::result<void> reportEquivocation(
         const primitives::BlockHash &first,
         const primitives::BlockHash &second) const override;
@@ -188,6 +197,7 @@ namespace kagome::consensus::babe {
     std::shared_ptr<authorship::Proposer> proposer_;
     primitives::events::StorageSubscriptionEnginePtr storage_sub_engine_;
     primitives::events::ChainSubscriptionEnginePtr chain_sub_engine_;
+    std::shared_ptr<storage::trie::FlatState> flat_state_;
     std::shared_ptr<network::BlockAnnounceTransmitter> announce_transmitter_;
     std::shared_ptr<runtime::BabeApi> babe_api_;
     std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api_;
@@ -169,6 +169,60 @@ namespace kagome::consensus::babe {
     return outcome::success();
   }
 
+  void BabeBlockValidatorImpl::prevalidateHeader(
+      const primitives::BlockHeader &block_header,
+      const primitives::BlockHeader &ancestor) const {
+    auto res = [&]() -> outcome::result<void> {
+      if (not block_header.hash_opt or ancestor.number == 0) {
+        return outcome::success();
+      }
+      auto ancestor_info = ancestor.blockInfo();
+      OUTCOME_TRY(ancestor_babe_header, babe::getBabeBlockHeader(ancestor));
+      OUTCOME_TRY(
+          ancestor_epoch,
+          slots_util_.get()->slotToEpoch(*ancestor.parentInfo(),
+                                         ancestor_babe_header.slot_number));
+      OUTCOME_TRY(babe_header, babe::getBabeBlockHeader(block_header));
+      OUTCOME_TRY(epoch_number,
+                  slots_util_.get()->slotToEpoch(ancestor_info,
+                                                 babe_header.slot_number));
+      // config of the parent is known at the ancestor only if the header is
+      // in the epoch of the ancestor or in the next one
+      if (epoch_number > ancestor_epoch + 1) {
+        return outcome::success();
+      }
+      OUTCOME_TRY(config_ptr,
+                  config_repo_->config(ancestor_info, epoch_number));
+      auto &config = *config_ptr;
+      if (babe_header.authority_index >= config.authorities.size()) {
+        return ValidationError::NO_VALIDATOR;
+      }
+      auto &authority_id = config.authorities[babe_header.authority_index].id;
+      auto threshold = calculateThreshold(config.leadership_rate,
+                                          config.authorities,
+                                          babe_header.authority_index);
+      OUTCOME_TRY(validateHeader(
+          block_header, epoch_number, authority_id, threshold, config));
+      prevalidated_.exclusiveAccess([&](auto &prevalidated) {
+        prevalidated.put(block_header.hash(),
+                         SealCheck{
+                             .epoch_number = epoch_number,
+                             .authority_id = authority_id,
+                             .randomness = config.randomness,
+                             .threshold = threshold,
+                         });
+      });
+      return outcome::success();
+    }();
+    // error is reported by `validateHeader` when the block is applied
+    if (res.has_error()) {
+      SL_TRACE(log_,
+               "Prevalidation of block {} failed: {}",
+               block_header.hash(),
+               res.error());
+    }
+  }
+
   outcome::result<void> BabeBlockValidatorImpl::validateHeader(
       const primitives::BlockHeader &header,
       const EpochNumber epoch_number,
@@ -204,6 +258,32 @@ namespace kagome::consensus::babe {
       }
     }
 
+    SealCheck check{
+        .epoch_number = epoch_number,
+        .authority_id = authority_id,
+        .randomness = babe_config.randomness,
+        .threshold = threshold,
+    };
+    auto prevalidated = prevalidated_.exclusiveAccess([&](auto &prevalidated) {
+      if (not header.hash_opt) {
+        return false;
+      }
+      auto &hash = *header.hash_opt;
+      auto checked = prevalidated.get(hash);
+      if (not checked) {
+        return false;
+      }
+      auto match = checked->get() == check;
+      prevalidated.erase(hash);
+      return match;
+    });
+    if (prevalidated) {
+      SL_TRACE(log_,
+               "Seal and VRF of block {} are already checked",
+               header.blockInfo());
+      return outcome::success();
+    }
+
     OUTCOME_TRY(seal, getSeal(header));
 
     // signature in seal of the header must be valid
@@ -8,6 +8,8 @@
 
 #include "consensus/babe/babe_block_validator.hpp"
 
+#include <mutex>
+
 #include "clock/clock.hpp"
 #include "consensus/babe/types/babe_configuration.hpp"
 #include "consensus/babe/types/slot_leadership.hpp"
@@ -17,6 +19,8 @@
 #include "primitives/block.hpp"
 #include "primitives/event_types.hpp"
 #include "telemetry/service.hpp"
+#include "utils/lru.hpp"
+#include "utils/safe_object.hpp"
 
 namespace kagome::application {
   class AppStateManager;
@@ -61,7 +65,11 @@ namespace kagome::consensus::babe {
     void prepare();
 
     outcome::result<void> validateHeader(
-        const primitives::BlockHeader &block_header) const;
+        const primitives::BlockHeader &block_header) const override;
+
+    void prevalidateHeader(
+        const primitives::BlockHeader &block_header,
+        const primitives::BlockHeader &ancestor) const override;
 
     enum class ValidationError {
       NO_VALIDATOR = 1,
@@ -73,6 +81,19 @@ namespace kagome::consensus::babe {
     };
 
    private:
+    /// Epoch data used to check seal and VRF of a header
+    struct SealCheck {
+      EpochNumber epoch_number;
+      AuthorityId authority_id;
+      Randomness randomness;
+      Threshold threshold;
+
+      bool operator==(const SealCheck &) const = default;
+    };
+
+    /// Max number of prevalidated headers waiting for validation
+    static constexpr size_t kPrevalidatedCapacity = 1024;
+
     /**
      * Validate the block header
      * @param block to be validated
@@ -126,6 +147,10 @@ namespace kagome::consensus::babe {
     primitives::events::SyncStateSubscriptionEnginePtr sync_state_observable_;
 
     bool was_synchronized_ = false;
+
+    // headers with successfully checked seal and VRF
+    mutable SafeObject<Lru<primitives::BlockHash, SealCheck>, std::mutex>
+        prevalidated_{kPrevalidatedCapacity};
     primitives::events::SyncStateEventSubscriberPtr sync_state_observer_;
   };
 
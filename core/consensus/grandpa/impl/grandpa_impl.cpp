@@ -16,6 +16,7 @@
 #include "blockchain/block_tree.hpp"
 #include "common/main_thread_pool.hpp"
 #include "common/tagged.hpp"
+#include "common/worker_thread_pool.hpp"
 #include "consensus/grandpa/authority_manager.hpp"
 #include "consensus/grandpa/environment.hpp"
 #include "consensus/grandpa/grandpa_config.hpp"
@@ -25,6 +26,7 @@
 #include "consensus/grandpa/impl/vote_crypto_provider_impl.hpp"
 #include "consensus/grandpa/impl/vote_tracker_impl.hpp"
 #include "consensus/grandpa/impl/voting_round_impl.hpp"
+#include "consensus/grandpa/verify_justification.hpp"
 #include "consensus/grandpa/vote_graph/vote_graph_impl.hpp"
 #include "consensus/grandpa/voting_round_error.hpp"
 #include "consensus/grandpa/voting_round_update.hpp"
@@ -89,7 +91,8 @@ namespace kagome::consensus::grandpa {
       primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
       storage::SpacedStorage &db,
       common::MainThreadPool &main_thread_pool,
-      GrandpaThreadPool &grandpa_thread_pool)
+      GrandpaThreadPool &grandpa_thread_pool,
+      std::shared_ptr<common::WorkerThreadPool> worker_thread_pool)
       : round_time_factor_{kGossipDuration},
         hasher_{std::move(hasher)},
         environment_{std::move(environment)},
@@ -106,6 +109,7 @@ namespace kagome::consensus::grandpa {
         main_pool_handler_{main_thread_pool.handler(*app_state_manager)},
         grandpa_pool_handler_{poolHandlerReadyMake(
             this, app_state_manager, grandpa_thread_pool, logger_)},
+        worker_thread_pool_{std::move(worker_thread_pool)},
         scheduler_{std::make_shared<libp2p::basic::SchedulerImpl>(
             std::make_shared<libp2p::basic::AsioSchedulerBackend>(
                 grandpa_thread_pool.io_context()),
@@ -119,6 +123,7 @@ namespace kagome::consensus::grandpa {
     BOOST_ASSERT(reputation_repository_ != nullptr);
     BOOST_ASSERT(main_pool_handler_ != nullptr);
     BOOST_ASSERT(grandpa_pool_handler_ != nullptr);
+    BOOST_ASSERT(worker_thread_pool_ != nullptr);
 
     // Register metrics
     metrics_registry_->registerGaugeFamily(highestGrandpaRoundMetricName,
@@ -1134,23 +1139,23 @@ namespace kagome::consensus::grandpa {
   outcome::result<void> GrandpaImpl::verifyJustification(
       const GrandpaJustification &justification,
       const AuthoritySet &authorities) {
-    auto voters = VoterSet::make(authorities).value();
-    MovableRoundState state;
-    state.round_number = justification.round_number;
-    auto round = std::make_shared<VotingRoundImpl>(
-        shared_from_this(),
-        GrandpaConfig{voters, justification.round_number, {}, {}},
-        hasher_,
-        environment_,
-        std::make_shared<VoteCryptoProviderImpl>(
-            nullptr, crypto_provider_, justification.round_number, voters),
-        std::make_shared<VoteTrackerImpl>(),
-        std::make_shared<VoteTrackerImpl>(),
-        std::make_shared<VoteGraphImpl>(
-            primitives::BlockInfo{}, voters, environment_),
-        scheduler_,
-        state);
-    return round->validatePrecommitJustification(justification);
+    // same justification is often received from several peers
+    auto key = hasher_->blake2b_256(
+        scale::encode(authorities.id, justification).value());
+    if (verified_justifications_.exclusiveAccess(
+            [&](auto &verified) { return verified.has(key); })) {
+      return outcome::success();
+    }
+    OUTCOME_TRY(voters, VoterSet::make(authorities));
+    OUTCOME_TRY(grandpa::verifyJustification(justification,
+                                             *voters,
+                                             *hasher_,
+                                             *crypto_provider_,
+                                             *environment_,
+                                             *worker_thread_pool_));
+    verified_justifications_.exclusiveAccess(
+        [&](auto &verified) { verified.add(key); });
+    return outcome::success();
   }
 
   void GrandpaImpl::applyJustification(
@@ -20,6 +20,7 @@
 #include "primitives/event_types.hpp"
 #include "storage/spaced_storage.hpp"
 #include "utils/lru.hpp"
+#include "utils/safe_object.hpp"
 
 namespace kagome {
   class PoolHandler;
@@ -36,6 +37,7 @@ namespace kagome::blockchain {
 
 namespace kagome::common {
   class MainThreadPool;
+  class WorkerThreadPool;
 }
 
 namespace kagome::consensus {
@@ -102,6 +104,9 @@ namespace kagome::consensus::grandpa {
     static constexpr Clock::Duration kCatchupRequestTimeout =
         std::chrono::milliseconds(45'000);
 
+    /// Number of verified justifications remembered to skip verifying again
+    static constexpr size_t kVerifiedJustificationsCacheSize = 256;
+
     ~GrandpaImpl() override = default;
 
     GrandpaImpl(
@@ -119,7 +124,8 @@ namespace kagome::consensus::grandpa {
         primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
         storage::SpacedStorage &db,
         common::MainThreadPool &main_thread_pool,
-        GrandpaThreadPool &grandpa_thread_pool);
+        GrandpaThreadPool &grandpa_thread_pool,
+        std::shared_ptr<common::WorkerThreadPool> worker_thread_pool);
 
     /**
      * Initiates grandpa voting process e.g.:
@@ -272,6 +278,8 @@ namespace kagome::consensus::grandpa {
 
     std::shared_ptr<PoolHandler> main_pool_handler_;
     std::shared_ptr<PoolHandlerReady> grandpa_pool_handler_;
+    // lends threads to verify signatures of justifications
+    std::shared_ptr<common::WorkerThreadPool> worker_thread_pool_;
     std::shared_ptr<libp2p::basic::Scheduler> scheduler_;
 
     std::shared_ptr<VotingRound> current_round_;
@@ -290,6 +298,10 @@ namespace kagome::consensus::grandpa {
         historical_votes_{5};
     bool writing_historical_votes_ = false;
 
+    // hashes of authority set id and justification, already verified
+    SafeObject<LruSet<common::Hash256>> verified_justifications_{
+        kVerifiedJustificationsCacheSize};
+
     // Metrics
     metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
     metrics::Gauge *metric_highest_round_;
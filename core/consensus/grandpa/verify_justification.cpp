@@ -0,0 +1,106 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/grandpa/verify_justification.hpp"
+
+#include <atomic>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "consensus/grandpa/ancestry_verifier.hpp"
+#include "consensus/grandpa/chain.hpp"
+#include "consensus/grandpa/voter_set.hpp"
+#include "consensus/grandpa/voting_round_error.hpp"
+#include "crypto/ed25519_provider.hpp"
+#include "scale/scale.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace kagome::consensus::grandpa {
+  namespace {
+    /// Don't lend a thread for less signatures
+    constexpr size_t kMinSignaturesPerThread = 32;
+
+    bool verifySignature(const SignedPrecommit &vote,
+                         RoundNumber round,
+                         VoterSetId set_id,
+                         const crypto::Ed25519Provider &ed25519) {
+      if (not vote.is<Precommit>()) {
+        return false;
+      }
+      auto payload = scale::encode(vote.message, round, set_id).value();
+      auto r = ed25519.verify(vote.signature, payload, vote.id);
+      return r and r.value();
+    }
+  }  // namespace
+
+  outcome::result<void> verifyJustification(
+      const GrandpaJustification &justification,
+      const VoterSet &voters,
+      const crypto::Hasher &hasher,
+      const crypto::Ed25519Provider &ed25519,
+      const Chain &chain,
+      const ThreadPool &pool) {
+    auto &items = justification.items;
+    std::atomic_bool valid = true;
+    parallelFor(pool,
+                items.size(),
+                items.size() / kMinSignaturesPerThread,
+                [&](size_t i) {
+                  if (valid
+                      and not verifySignature(items[i],
+                                              justification.round_number,
+                                              voters.id(),
+                                              ed25519)) {
+                    valid = false;
+                  }
+                });
+    if (not valid) {
+      return VotingRoundError::INVALID_SIGNATURE;
+    }
+
+    AncestryVerifier ancestry_verifier(justification.votes_ancestries, hasher);
+    auto has_ancestry = [&](const primitives::BlockInfo &ancestor,
+                            const primitives::BlockInfo &descendant) {
+      return ancestry_verifier.hasAncestry(ancestor, descendant)
+          or chain.hasAncestry(ancestor.hash, descendant.hash);
+    };
+
+    // calculate super-majority
+    auto faulty = (voters.totalWeight() - 1) / 3;
+    auto threshold = voters.totalWeight() - faulty;
+    size_t total_weight = 0;
+    std::unordered_map<Id, primitives::BlockInfo> validators;
+    std::unordered_set<Id> equivocators;
+
+    for (const auto &signed_precommit : justification.items) {
+      if (auto [it, success] = validators.emplace(
+              signed_precommit.id, signed_precommit.getBlockInfo());
+          success) {
+        auto weight_opt = voters.voterWeight(signed_precommit.id);
+        if (not weight_opt) {
+          continue;
+        }
+        if (has_ancestry(justification.block_info,
+                         signed_precommit.getBlockInfo())) {
+          total_weight += weight_opt.value();
+        }
+      } else if (equivocators.emplace(signed_precommit.id).second) {
+        auto weight = voters.voterWeight(signed_precommit.id);
+        if (weight and has_ancestry(justification.block_info, it->second)) {
+          total_weight -= *weight;
+          threshold -= *weight;
+        }
+      } else {
+        return VotingRoundError::REDUNDANT_EQUIVOCATION;
+      }
+    }
+
+    if (total_weight < threshold) {
+      return VotingRoundError::NOT_ENOUGH_WEIGHT;
+    }
+    return outcome::success();
+  }
+}  // namespace kagome::consensus::grandpa
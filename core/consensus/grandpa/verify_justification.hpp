@@ -0,0 +1,38 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "consensus/grandpa/structs.hpp"
+#include "outcome/outcome.hpp"
+
+namespace kagome {
+  class ThreadPool;
+}  // namespace kagome
+
+namespace kagome::crypto {
+  class Ed25519Provider;
+  class Hasher;
+}  // namespace kagome::crypto
+
+namespace kagome::consensus::grandpa {
+  struct Chain;
+  class VoterSet;
+
+  /**
+   * Verifies precommit justification without creating voting round.
+   * Ancestry of votes is checked with `votes_ancestries` of justification,
+   * falling back to `chain`.
+   * Signatures are verified in parallel on `pool`.
+   */
+  outcome::result<void> verifyJustification(
+      const GrandpaJustification &justification,
+      const VoterSet &voters,
+      const crypto::Hasher &hasher,
+      const crypto::Ed25519Provider &ed25519,
+      const Chain &chain,
+      const ThreadPool &pool);
+}  // namespace kagome::consensus::grandpa
@@ -51,6 +51,13 @@ namespace kagome::consensus {
     virtual outcome::result<void> validateHeader(
         const primitives::BlockHeader &block_header) const = 0;
 
+    /// Speculatively checks a header, whose parent is not applied yet, to
+    /// speed up its `validateHeader`. Thread-safe.
+    /// @arg ancestor - header of applied ancestor
+    virtual void prevalidateHeader(
+        const primitives::BlockHeader &block_header,
+        const primitives::BlockHeader &ancestor) const = 0;
+
     /// Submit the equivocation report based on two blocks of one validator
     /// produced during a single slot
     /// @arg first - hash of first equivocating block
@@ -73,6 +73,17 @@ namespace kagome::consensus {
     return consensus->validateHeader(block.header);
   }
 
+  std::function<void()> BlockAppenderBase::prevalidateHeader(
+      primitives::BlockHeader header, primitives::BlockHeader ancestor) {
+    auto consensus = consensus_selector_.get()->getProductionConsensus(header);
+    BOOST_ASSERT_MSG(consensus, "Must be returned at least fallback consensus");
+    return [consensus{std::move(consensus)},
+            header{std::move(header)},
+            ancestor{std::move(ancestor)}] {
+      consensus->prevalidateHeader(header, ancestor);
+    };
+  }
+
   outcome::result<BlockAppenderBase::SlotInfo> BlockAppenderBase::getSlotInfo(
       const primitives::BlockHeader &header) const {
     auto consensus = consensus_selector_.get()->getProductionConsensus(header);
@@ -53,6 +53,14 @@ namespace kagome::consensus {
 
     outcome::result<void> validateHeader(const primitives::Block &block);
 
+    /**
+     * Selects consensus of the header.
+     * @return thread-safe function, which speculatively checks the header
+     * @see ProductionConsensus::prevalidateHeader
+     */
+    std::function<void()> prevalidateHeader(primitives::BlockHeader header,
+                                            primitives::BlockHeader ancestor);
+
     struct SlotInfo {
       TimePoint start;
       Duration duration;
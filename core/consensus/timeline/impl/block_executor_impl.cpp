@@ -6,6 +6,8 @@
 
 #include "consensus/timeline/impl/block_executor_impl.hpp"
 
+#include <algorithm>
+
 #include "application/app_state_manager.hpp"
 #include "blockchain/block_tree.hpp"
 #include "blockchain/block_tree_error.hpp"
@@ -18,6 +20,7 @@
 #include "runtime/runtime_api/core.hpp"
 #include "runtime/runtime_api/offchain_worker_api.hpp"
 #include "storage/changes_trie/impl/storage_changes_tracker_impl.hpp"
+#include "storage/trie/flat_state.hpp"
 #include "transaction_pool/transaction_pool.hpp"
 #include "transaction_pool/transaction_pool_error.hpp"
 #include "utils/pool_handler_ready_make.hpp"
@@ -41,6 +44,7 @@ namespace kagome::consensus {
       std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api,
       primitives::events::StorageSubscriptionEnginePtr storage_sub_engine,
       primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+      std::shared_ptr<storage::trie::FlatState> flat_state,
       std::unique_ptr<BlockAppenderBase> appender)
       : block_tree_{std::move(block_tree)},
         main_pool_handler_{main_thread_pool.handler(app_state_manager)},
@@ -52,6 +56,7 @@ namespace kagome::consensus {
         offchain_worker_api_(std::move(offchain_worker_api)),
         storage_sub_engine_{std::move(storage_sub_engine)},
         chain_subscription_engine_{std::move(chain_sub_engine)},
+        flat_state_{std::move(flat_state)},
         appender_{std::move(appender)},
         logger_{log::createLogger("BlockExecutor", "block_executor")},
         telemetry_{telemetry::createTelemetryService()} {
@@ -73,7 +78,92 @@ namespace kagome::consensus {
       primitives::Block &&block,
       const std::optional<primitives::Justification> &justification,
       ApplyJustificationCb &&callback) {
+    if (not applying_) {
+      startApplyBlock(std::move(block), justification, std::move(callback));
+      return;
+    }
+    if (not isApplying(block.header.parent_hash)
+        and not block_tree_->has(block.header.parent_hash)) {
+      callback(BlockAdditionError::PARENT_NOT_FOUND);
+      return;
+    }
+    SL_TRACE(logger_,
+             "Block {} is queued, {} blocks ahead",
+             block.header.blockInfo(),
+             queue_.size() + 1);
+    prevalidateHeader(block.header);
+    queue_.emplace_back(QueuedBlock{
+        std::move(block),
+        justification,
+        std::move(callback),
+    });
+  }
+
+  void BlockExecutorImpl::applyNextBlock(const primitives::BlockHash &applied) {
+    if (not applying_ or applying_->hash != applied) {
+      return;
+    }
+    applying_.reset();
+    if (queue_.empty()) {
+      return;
+    }
+    auto next = std::move(queue_.front());
+    queue_.pop_front();
+    startApplyBlock(
+        std::move(next.block), next.justification, std::move(next.callback));
+  }
+
+  bool BlockExecutorImpl::isApplying(const primitives::BlockHash &hash) const {
+    if (applying_ and applying_->hash == hash) {
+      return true;
+    }
+    return std::ranges::any_of(queue_, [&](const QueuedBlock &queued) {
+      return queued.block.header.hash() == hash;
+    });
+  }
+
+  void BlockExecutorImpl::prevalidateHeader(
+      const primitives::BlockHeader &header) {
+    // find the nearest ancestor present in block tree,
+    // queued blocks follow their parents
+    auto ancestor = header.parent_hash;
+    for (auto it = queue_.rbegin(); it != queue_.rend(); ++it) {
+      if (it->block.header.hash() == ancestor) {
+        ancestor = it->block.header.parent_hash;
+      }
+    }
+    if (applying_ and applying_->hash == ancestor) {
+      ancestor = applying_->parent_hash;
+    }
+    auto ancestor_header = block_tree_->getBlockHeader(ancestor);
+    if (ancestor_header.has_error()) {
+      return;
+    }
+    worker_pool_handler_->execute(appender_->prevalidateHeader(
+        header, std::move(ancestor_header.value())));
+  }
+
+  void BlockExecutorImpl::startApplyBlock(
+      primitives::Block &&block,
+      const std::optional<primitives::Justification> &justification,
+      ApplyJustificationCb &&callback) {
     auto block_info = block.header.blockInfo();
+    BOOST_ASSERT(not applying_);
+    applying_ = ApplyingBlock{block_info.hash, block.header.parent_hash};
+    // the next block starts when this one is applied
+    callback = [wself{weak_from_this()},
+                main_pool_handler{main_pool_handler_},
+                hash{block_info.hash},
+                callback{std::move(callback)}](
+                   outcome::result<void> &&result) mutable {
+      callback(std::move(result));
+      main_pool_handler->execute([wself, hash] {
+        if (auto self = wself.lock()) {
+          self->applyNextBlock(hash);
+        }
+      });
+    };
+
     if (not block_tree_->has(block.header.parent_hash)) {
       callback(BlockAdditionError::PARENT_NOT_FOUND);
       return;
@@ -165,6 +255,15 @@ namespace kagome::consensus {
       changes_tracker->onBlockAdded(
           block_info.hash, storage_sub_engine_, chain_subscription_engine_);
 
+      if (flat_state_ != nullptr) {
+        if (auto changes = changes_tracker->mainTrieChanges()) {
+          flat_state_->onBlockExecuted(block.header.number,
+                                       parent.state_root,
+                                       block.header.state_root,
+                                       std::move(*changes));
+        }
+      }
+
       auto executed = [self,
                        block{std::move(block)},
                        justification{std::move(justification)},
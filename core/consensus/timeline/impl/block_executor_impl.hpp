@@ -8,6 +8,8 @@
 
 #include "consensus/timeline/block_executor.hpp"
 
+#include <deque>
+
 #include <libp2p/peer/peer_id.hpp>
 
 #include "consensus/babe/types/babe_configuration.hpp"
@@ -43,6 +45,10 @@ namespace kagome::runtime {
   class Core;
 };  // namespace kagome::runtime
 
+namespace kagome::storage::trie {
+  class FlatState;
+}
+
 namespace kagome::transaction_pool {
   class TransactionPool;
 }
@@ -66,10 +72,16 @@ namespace kagome::consensus {
         std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api,
         primitives::events::StorageSubscriptionEnginePtr storage_sub_engine,
         primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+        std::shared_ptr<storage::trie::FlatState> flat_state,
         std::unique_ptr<BlockAppenderBase> appender);
 
     ~BlockExecutorImpl();
 
+    /**
+     * Applies blocks one by one in order of submission.
+     * Block may be submitted while its parent is being applied, then it waits
+     * in queue and its header is prevalidated on worker threads.
+     */
     void applyBlock(
         primitives::Block &&block,
         const std::optional<primitives::Justification> &justification,
@@ -85,6 +97,32 @@ namespace kagome::consensus {
         const primitives::BlockInfo &previous_best_block);
 
    private:
+    struct QueuedBlock {
+      primitives::Block block;
+      std::optional<primitives::Justification> justification;
+      ApplyJustificationCb callback;
+    };
+
+    struct ApplyingBlock {
+      primitives::BlockHash hash;
+      primitives::BlockHash parent_hash;
+    };
+
+    /// Applies the block, `applying_` must be empty
+    void startApplyBlock(
+        primitives::Block &&block,
+        const std::optional<primitives::Justification> &justification,
+        ApplyJustificationCb &&callback);
+
+    /// Starts the next queued block, if the block is still being applied
+    void applyNextBlock(const primitives::BlockHash &applied);
+
+    /// @return true if the block is being applied or queued
+    bool isApplying(const primitives::BlockHash &hash) const;
+
+    /// Schedules prevalidation of the header of queued block
+    void prevalidateHeader(const primitives::BlockHeader &header);
+
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<PoolHandler> main_pool_handler_;
     std::shared_ptr<PoolHandlerReady> worker_pool_handler_;
@@ -94,9 +132,14 @@ namespace kagome::consensus {
     std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api_;
     primitives::events::StorageSubscriptionEnginePtr storage_sub_engine_;
     primitives::events::ChainSubscriptionEnginePtr chain_subscription_engine_;
+    std::shared_ptr<storage::trie::FlatState> flat_state_;
 
     std::unique_ptr<BlockAppenderBase> appender_;
 
+    // accessed from main thread only
+    std::optional<ApplyingBlock> applying_;
+    std::deque<QueuedBlock> queue_;
+
     log::Logger logger_;
     telemetry::Telemetry telemetry_;
   };
@@ -7,9 +7,13 @@
 #include "host_api/impl/crypto_extension.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <exception>
+#include <mutex>
 
 #include <fmt/format.h>
+#include <boost/asio/post.hpp>
 #include <boost/assert.hpp>
 #include <span>
 
@@ -24,6 +28,7 @@
 #include "log/trace_macros.hpp"
 #include "runtime/ptr_size.hpp"
 #include "scale/scale.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace {
   template <typename Format, typename... Args>
@@ -65,7 +70,8 @@ namespace kagome::host_api {
       std::shared_ptr<const crypto::Ed25519Provider> ed25519_provider,
       std::shared_ptr<const crypto::Secp256k1Provider> secp256k1_provider,
       std::shared_ptr<const crypto::Hasher> hasher,
-      std::optional<std::shared_ptr<crypto::KeyStore>> key_store)
+      std::optional<std::shared_ptr<crypto::KeyStore>> key_store,
+      std::shared_ptr<const ThreadPool> batch_pool)
       : memory_provider_(std::move(memory_provider)),
         sr25519_provider_(std::move(sr25519_provider)),
         ecdsa_provider_(std::move(ecdsa_provider)),
@@ -73,7 +79,8 @@ namespace kagome::host_api {
         secp256k1_provider_(std::move(secp256k1_provider)),
         hasher_(std::move(hasher)),
         key_store_(std::move(key_store)),
-        logger_{log::createLogger("CryptoExtension", "crypto_extension")} {
+        logger_{log::createLogger("CryptoExtension", "crypto_extension")},
+        batch_pool_{std::move(batch_pool)} {
     BOOST_ASSERT(memory_provider_ != nullptr);
     BOOST_ASSERT(sr25519_provider_ != nullptr);
     BOOST_ASSERT(ecdsa_provider_ != nullptr);
@@ -170,6 +177,15 @@ namespace kagome::host_api {
     if (not batch_verify_) {
       throw_with_error(logger_, "batch not started");
     }
+    // verify rest of signatures while tasks are running
+    if (not std::ranges::all_of(batch_pending_,
+                                [](const auto &verify) { return verify(); })) {
+      *batch_verify_ = kVerifyFail;
+    }
+    batch_pending_.clear();
+    while (not batch_tasks_.empty()) {
+      batchJoinOne();
+    }
     auto ok = *batch_verify_;
     batch_verify_.reset();
     return ok;
@@ -295,12 +311,27 @@ namespace kagome::host_api {
       runtime::WasmPointer sig,
       runtime::WasmSpan msg_span,
       runtime::WasmPointer pubkey_data) {
-    SL_TRACE_FUNC_CALL(
-        logger_,
-        "Deprecated API method ext_crypto_ed25519_batch_verify_version_1 being "
-        "called. Passing call to ext_crypto_ed25519_verify_version_1");
-    return batchVerify(
-        ext_crypto_ed25519_verify_version_1(sig, msg_span, pubkey_data));
+    if (not batch_verify_) {
+      return ext_crypto_ed25519_verify_version_1(sig, msg_span, pubkey_data);
+    }
+    auto [msg_data, msg_len] = runtime::PtrSize(msg_span);
+    common::Buffer msg{getMemory().loadN(msg_data, msg_len)};
+    auto signature_res = crypto::Ed25519Signature::fromSpan(
+        getMemory().loadN(sig, ed25519_constants::SIGNATURE_SIZE));
+    auto pubkey_res = crypto::Ed25519PublicKey::fromSpan(
+        getMemory().loadN(pubkey_data, ed25519_constants::PUBKEY_SIZE));
+    if (not signature_res or not pubkey_res) {
+      BOOST_UNREACHABLE_RETURN(kVerifyFail);
+    }
+    SL_TRACE_FUNC_CALL(logger_, "deferred", signature_res.value(), msg);
+    batchDefer([provider{ed25519_provider_},
+                signature{signature_res.value()},
+                msg{std::move(msg)},
+                pubkey{pubkey_res.value()}] {
+      auto res = provider->verify(signature, msg, pubkey);
+      return res and res.value();
+    });
+    return kVerifySuccess;
   }
 
   runtime::WasmSpan CryptoExtension::ext_crypto_sr25519_public_keys_version_1(
@@ -433,12 +464,32 @@ namespace kagome::host_api {
       runtime::WasmPointer sig,
       runtime::WasmSpan msg_span,
       runtime::WasmPointer pubkey_data) {
-    SL_TRACE_FUNC_CALL(
-        logger_,
-        "Deprecated API method ext_crypto_sr25519_batch_verify_version_1 being "
-        "called. Passing call to ext_crypto_sr25519_verify_version_1");
-    return batchVerify(
-        ext_crypto_sr25519_verify_version_1(sig, msg_span, pubkey_data));
+    if (not batch_verify_) {
+      return ext_crypto_sr25519_verify_version_1(sig, msg_span, pubkey_data);
+    }
+    auto [msg_data, msg_len] = runtime::PtrSize(msg_span);
+    common::Buffer msg{getMemory().loadN(msg_data, msg_len)};
+    auto signature_buffer =
+        getMemory().loadN(sig, sr25519_constants::SIGNATURE_SIZE);
+    auto key_res = crypto::Sr25519PublicKey::fromSpan(
+        getMemory().loadN(pubkey_data, sr25519_constants::PUBLIC_SIZE));
+    if (not key_res) {
+      BOOST_UNREACHABLE_RETURN(kVerifyFail)
+    }
+    crypto::Sr25519Signature signature{};
+    std::copy_n(signature_buffer.begin(),
+                sr25519_constants::SIGNATURE_SIZE,
+                signature.begin());
+    SL_TRACE_FUNC_CALL(logger_, "deferred", signature, msg);
+    // version 1 verification is deprecated, same as in non-batch call
+    batchDefer([provider{sr25519_provider_},
+                signature,
+                msg{std::move(msg)},
+                key{key_res.value()}] {
+      auto res = provider->verify_deprecated(signature, msg, key);
+      return res and res.value();
+    });
+    return kVerifySuccess;
   }
 
   int32_t CryptoExtension::ext_crypto_sr25519_verify_version_1(
@@ -758,15 +809,70 @@ namespace kagome::host_api {
     return res;
   }
 
+  struct CryptoExtension::BatchTask {
+    std::vector<std::function<bool()>> pending;
+    std::atomic_bool started = false;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::optional<bool> ok;
+
+    /// Verifies signatures unless already started by other thread
+    void run() {
+      if (started.exchange(true)) {
+        return;
+      }
+      auto valid = std::ranges::all_of(
+          pending, [](const auto &verify) { return verify(); });
+      std::unique_lock lock{mutex};
+      ok = valid;
+      cv.notify_one();
+    }
+
+    /// Runs task if pool didn't start it yet, otherwise waits for it
+    bool join() {
+      run();
+      std::unique_lock lock{mutex};
+      cv.wait(lock, [&] { return ok.has_value(); });
+      return *ok;
+    }
+  };
+
   void CryptoExtension::reset() {
+    batch_pending_.clear();
+    // results are not needed, tasks not started by pool yet are skipped
+    for (auto &task : batch_tasks_) {
+      task->started = true;
+    }
+    batch_tasks_.clear();
     batch_verify_.reset();
   }
 
-  runtime::WasmSize CryptoExtension::batchVerify(runtime::WasmSize ok) {
-    if (batch_verify_) {
-      *batch_verify_ &= ok;
+  void CryptoExtension::batchDefer(std::function<bool()> verify) {
+    batch_pending_.emplace_back(std::move(verify));
+    if (batch_pending_.size() >= kBatchTaskSize) {
+      batchSpawn();
+    }
+  }
+
+  void CryptoExtension::batchSpawn() {
+    if (batch_tasks_.size() >= kMaxBatchTasks) {
+      batchJoinOne();
+    }
+    auto task = std::make_shared<BatchTask>();
+    task->pending = std::move(batch_pending_);
+    batch_pending_.clear();
+    if (batch_pool_ != nullptr) {
+      boost::asio::post(*batch_pool_->io_context(), [task] { task->run(); });
+    }
+    batch_tasks_.emplace_back(std::move(task));
+  }
+
+  void CryptoExtension::batchJoinOne() {
+    auto task = std::move(batch_tasks_.front());
+    batch_tasks_.pop_front();
+    if (not task->join()) {
+      *batch_verify_ = kVerifyFail;
     }
-    return ok;
   }
 
   runtime::WasmPointer
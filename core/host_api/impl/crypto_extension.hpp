@@ -6,15 +6,19 @@
 
 #pragma once
 
-#include <future>
+#include <deque>
+#include <functional>
 #include <optional>
-#include <queue>
 
 #include "crypto/key_store.hpp"
 #include "log/logger.hpp"
 #include "runtime/memory_provider.hpp"
 #include "runtime/types.hpp"
 
+namespace kagome {
+  class ThreadPool;
+}  // namespace kagome
+
 namespace kagome::crypto {
   class Sr25519Provider;
   class EcdsaProvider;
@@ -34,6 +38,10 @@ namespace kagome::host_api {
    public:
     static constexpr uint32_t kVerifySuccess = 1;
     static constexpr uint32_t kVerifyFail = 0;
+    /// Signatures verified by one task of batch
+    static constexpr size_t kBatchTaskSize = 64;
+    /// Tasks of batch running at once, bounds deferred signatures
+    static constexpr size_t kMaxBatchTasks = 4;
 
     CryptoExtension(
         std::shared_ptr<const runtime::MemoryProvider> memory_provider,
@@ -42,7 +50,8 @@ namespace kagome::host_api {
         std::shared_ptr<const crypto::Ed25519Provider> ed25519_provider,
         std::shared_ptr<const crypto::Secp256k1Provider> secp256k1_provider,
         std::shared_ptr<const crypto::Hasher> hasher,
-        std::optional<std::shared_ptr<crypto::KeyStore>> key_store);
+        std::optional<std::shared_ptr<crypto::KeyStore>> key_store,
+        std::shared_ptr<const ThreadPool> batch_pool = nullptr);
 
     void reset();
 
@@ -125,7 +134,9 @@ namespace kagome::host_api {
      * Deprecated and left here for backward-compatibility with old runtimes and
      * not going to be used now.
      *
-     * Emulates the behavior, but isn't doing any batch verification.
+     * Inside of batch signature is verified by task on `batch_pool_` while
+     * runtime continues and result is returned by finish batch, otherwise
+     * verifies immediately.
      */
     runtime::WasmSize ext_crypto_ed25519_batch_verify_version_1(
         runtime::WasmPointer sig,
@@ -165,7 +176,9 @@ namespace kagome::host_api {
      * Deprecated and left here for backward-compatibility with old runtimes and
      * not going to be used now.
      *
-     * Emulates the behavior, but isn't doing any batch verification.
+     * Inside of batch signature is verified by task on `batch_pool_` while
+     * runtime continues and result is returned by finish batch, otherwise
+     * verifies immediately.
      */
     int32_t ext_crypto_sr25519_batch_verify_version_1(
         runtime::WasmPointer sig,
@@ -268,7 +281,15 @@ namespace kagome::host_api {
     runtime::WasmSpan ecdsaRecoverCompressed(bool allow_overflow,
                                              runtime::WasmPointer sig,
                                              runtime::WasmPointer msg);
-    runtime::WasmSize batchVerify(runtime::WasmSize ok);
+    /// Chunk of deferred signature checks
+    struct BatchTask;
+
+    /// Queues signature check to be joined by finish batch
+    void batchDefer(std::function<bool()> verify);
+    /// Starts task verifying queued signatures on `batch_pool_`
+    void batchSpawn();
+    /// Waits for the oldest task and ANDs its result
+    void batchJoinOne();
     crypto::KeyType loadKeyType(runtime::WasmPointer ptr) const;
 
     std::shared_ptr<const runtime::MemoryProvider> memory_provider_;
@@ -282,5 +303,9 @@ namespace kagome::host_api {
     std::optional<std::shared_ptr<crypto::KeyStore>> key_store_;
     log::Logger logger_;
     std::optional<runtime::WasmSize> batch_verify_;
+    std::vector<std::function<bool()>> batch_pending_;
+    std::deque<std::shared_ptr<BatchTask>> batch_tasks_;
+    // optional, signatures are verified on runtime thread without it
+    std::shared_ptr<const ThreadPool> batch_pool_;
   };
 }  // namespace kagome::host_api
@@ -6,6 +6,7 @@
 
 #include "host_api/impl/host_api_factory_impl.hpp"
 
+#include "common/worker_thread_pool.hpp"
 #include "host_api/impl/host_api_impl.hpp"
 
 namespace kagome::host_api {
@@ -22,7 +23,8 @@ namespace kagome::host_api {
       std::shared_ptr<crypto::KeyStore> key_store,
       std::shared_ptr<offchain::OffchainPersistentStorage>
           offchain_persistent_storage,
-      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool)
+      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+      std::shared_ptr<common::WorkerThreadPool> worker_thread_pool)
       : offchain_config_(offchain_config),
         ecdsa_provider_(std::move(ecdsa_provider)),
         ed25519_provider_(std::move(ed25519_provider)),
@@ -35,7 +37,8 @@ namespace kagome::host_api {
         // because boost.di doesn't like optional<shared_ptr>
         key_store_(key_store ? std::optional(key_store) : std::nullopt),
         offchain_persistent_storage_(std::move(offchain_persistent_storage)),
-        offchain_worker_pool_(std::move(offchain_worker_pool)) {
+        offchain_worker_pool_(std::move(offchain_worker_pool)),
+        worker_thread_pool_(std::move(worker_thread_pool)) {
     BOOST_ASSERT(ecdsa_provider_ != nullptr);
     BOOST_ASSERT(ed25519_provider_ != nullptr);
     BOOST_ASSERT(sr25519_provider_ != nullptr);
@@ -62,7 +65,8 @@ namespace kagome::host_api {
                                          hasher_,
                                          key_store_,
                                          offchain_persistent_storage_,
-                                         offchain_worker_pool_);
+                                         offchain_worker_pool_,
+                                         worker_thread_pool_);
   }
 
 }  // namespace kagome::host_api
@@ -10,6 +10,10 @@
 
 #include "host_api/impl/offchain_extension.hpp"
 
+namespace kagome::common {
+  class WorkerThreadPool;
+}  // namespace kagome::common
+
 namespace kagome::crypto {
   class EllipticCurves;
   class EcdsaProvider;
@@ -44,7 +48,8 @@ namespace kagome::host_api {
         std::shared_ptr<crypto::KeyStore> key_store,
         std::shared_ptr<offchain::OffchainPersistentStorage>
             offchain_persistent_storage,
-        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool);
+        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+        std::shared_ptr<common::WorkerThreadPool> worker_thread_pool = nullptr);
 
     std::unique_ptr<HostApi> make(
         std::shared_ptr<const runtime::CoreApiFactory> core_factory,
@@ -65,6 +70,7 @@ namespace kagome::host_api {
     std::shared_ptr<offchain::OffchainPersistentStorage>
         offchain_persistent_storage_;
     std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool_;
+    std::shared_ptr<common::WorkerThreadPool> worker_thread_pool_;
   };
 
 }  // namespace kagome::host_api
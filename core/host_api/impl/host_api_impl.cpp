@@ -83,7 +83,8 @@ namespace kagome::host_api {
       std::optional<std::shared_ptr<crypto::KeyStore>> key_store,
       std::shared_ptr<offchain::OffchainPersistentStorage>
           offchain_persistent_storage,
-      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool)
+      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+      std::shared_ptr<const ThreadPool> batch_verify_pool)
       : memory_provider_([&] {
           BOOST_ASSERT(memory_provider);
           return std::move(memory_provider);
@@ -98,7 +99,8 @@ namespace kagome::host_api {
                     std::move(ed25519_provider),
                     std::move(secp256k1_provider),
                     hasher,
-                    std::move(key_store)),
+                    std::move(key_store),
+                    std::move(batch_verify_pool)),
         elliptic_curves_ext_(memory_provider_, std::move(elliptic_curves)),
         io_ext_(memory_provider_),
         memory_ext_(memory_provider_),
@@ -23,7 +23,6 @@
 #include "runtime/memory_provider.hpp"
 #include "runtime/ptr_size.hpp"
 #include "runtime/trie_storage_provider.hpp"
-#include "scale/encode_append.hpp"
 #include "storage/predefined_keys.hpp"
 #include "storage/trie/impl/topper_trie_batch_impl.hpp"
 #include "storage/trie/serialization/ordered_trie_hash.hpp"
@@ -249,25 +248,15 @@ namespace kagome::host_api {
     auto key_bytes = memory.loadN(key_ptr, key_size);
     auto append_bytes = memory.loadN(append_ptr, append_size);
 
-    auto val_opt_res = get(key_bytes);
-    if (val_opt_res.has_error()) {
-      throw std::runtime_error(fmt::format(
-          "Error fetching value from storage: {}", val_opt_res.error()));
-    }
-    auto &val_opt = val_opt_res.value();
-    auto &&val = val_opt ? common::Buffer{val_opt.value()} : common::Buffer{};
-
-    if (scale::append_or_new_vec(val.asVector(), append_bytes).has_value()) {
-      auto batch = storage_provider_->getCurrentBatch();
-      SL_TRACE_VOID_FUNC_CALL(logger_, key_bytes, val);
-      auto put_result = batch->put(key_bytes, std::move(val));
-      if (not put_result) {
-        logger_->error(
-            "ext_storage_append_version_1 failed, due to fail in trie db "
-            "with reason: {}",
-            put_result.error());
-      }
-      return;
+    auto batch = storage_provider_->getCurrentBatch();
+    SL_TRACE_VOID_FUNC_CALL(logger_, key_bytes, append_bytes);
+    // batch keeps appended items, so vector is not re-encoded on each append
+    auto append_result = batch->append(key_bytes, append_bytes, 1);
+    if (not append_result) {
+      logger_->error(
+          "ext_storage_append_version_1 failed, due to fail in trie db "
+          "with reason: {}",
+          append_result.error());
     }
   }
 
@@ -31,6 +31,7 @@
 #include "api/service/child_state/impl/child_state_api_impl.hpp"
 #include "api/service/impl/api_service_impl.hpp"
 #include "api/service/impl/rpc_thread_pool.hpp"
+#include "api/service/impl/rpc_worker_pool.hpp"
 #include "api/service/internal/impl/internal_api_impl.hpp"
 #include "api/service/internal/internal_jrpc_processor.hpp"
 #include "api/service/mmr/rpc.hpp"
@@ -56,6 +57,7 @@
 #include "authorship/impl/block_builder_impl.hpp"
 #include "authorship/impl/proposer_impl.hpp"
 #include "benchmark/block_execution_benchmark.hpp"
+#include "benchmark/runtime_benchmark.hpp"
 #include "blockchain/impl/block_header_repository_impl.hpp"
 #include "blockchain/impl/block_storage_impl.hpp"
 #include "blockchain/impl/block_tree_impl.hpp"
@@ -168,7 +170,9 @@
 #include "runtime/common/core_api_factory_impl.hpp"
 #include "runtime/common/module_repository_impl.hpp"
 #include "runtime/common/runtime_instances_pool.hpp"
+#include "runtime/common/runtime_instances_prewarm.hpp"
 #include "runtime/common/runtime_properties_cache_impl.hpp"
+#include "runtime/common/runtime_upgrade_precompiler.hpp"
 #include "runtime/common/runtime_upgrade_tracker_impl.hpp"
 #include "runtime/common/storage_code_provider.hpp"
 #include "runtime/common/trie_storage_provider_impl.hpp"
@@ -213,12 +217,15 @@
 #include "storage/changes_trie/impl/storage_changes_tracker_impl.hpp"
 #include "storage/rocksdb/rocksdb.hpp"
 #include "storage/spaces.hpp"
+#include "storage/trie/flat_state.hpp"
 #include "storage/trie/impl/trie_storage_backend_impl.hpp"
 #include "storage/trie/impl/trie_storage_impl.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
 #include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_node_cache.hpp"
 #include "storage/trie/serialization/trie_serializer_impl.hpp"
 #include "storage/trie_pruner/impl/trie_pruner_impl.hpp"
+#include "storage/trie_pruner/impl/trie_pruner_thread_pool.hpp"
 #include "telemetry/impl/service_impl.hpp"
 #include "telemetry/impl/telemetry_thread_pool.hpp"
 #include "transaction_pool/impl/pool_moderator_impl.hpp"
@@ -803,14 +810,59 @@ namespace {
                          injector.template create<
                              sptr<storage::trie::TrieSerializer>>(),
                          injector.template create<
-                             sptr<storage::trie_pruner::TriePruner>>())
+                             sptr<storage::trie_pruner::TriePruner>>(),
+                         injector.template create<
+                             sptr<storage::trie::FlatState>>())
                   .value();
             }),
+            bind_by_lambda<storage::trie::FlatState>(
+                [](const auto &injector) -> sptr<storage::trie::FlatState> {
+                  const application::AppConfiguration &config =
+                      injector.template create<
+                          application::AppConfiguration const &>();
+                  if (not config.enableFlatState()) {
+                    return nullptr;
+                  }
+                  return std::make_shared<storage::trie::FlatState>(
+                      injector.template create<sptr<storage::SpacedStorage>>(),
+                      injector.template create<
+                          sptr<storage::trie::TrieSerializer>>(),
+                      injector.template create<
+                          primitives::events::ChainSubscriptionEnginePtr>());
+                }),
             di::bind<storage::trie::PolkadotTrieFactory>.template to<storage::trie::PolkadotTrieFactoryImpl>(),
             bind_by_lambda<storage::trie::Codec>([](const auto&) {
               return std::make_shared<storage::trie::PolkadotCodec>(crypto::blake2b<32>);
             }),
-            di::bind<storage::trie::TrieSerializer>.template to<storage::trie::TrieSerializerImpl>(),
+            bind_by_lambda<storage::trie::TrieNodeCache>(
+                [](const auto &injector)
+                    -> sptr<storage::trie::TrieNodeCache> {
+                  const application::AppConfiguration &config =
+                      injector.template create<
+                          application::AppConfiguration const &>();
+                  if (config.trieNodeCacheSize() == 0) {
+                    return nullptr;
+                  }
+                  return std::make_shared<storage::trie::TrieNodeCache>(
+                      config.trieNodeCacheSize());
+                }),
+            bind_by_lambda<storage::trie::TrieSerializer>(
+                [](const auto &injector) {
+                  const application::AppConfiguration &config =
+                      injector.template create<
+                          application::AppConfiguration const &>();
+                  return std::make_shared<storage::trie::TrieSerializerImpl>(
+                      injector.template create<
+                          sptr<storage::trie::PolkadotTrieFactory>>(),
+                      injector.template create<sptr<storage::trie::Codec>>(),
+                      injector.template create<
+                          sptr<storage::trie::TrieStorageBackend>>(),
+                      injector.template create<
+                          sptr<storage::trie::TrieNodeCache>>(),
+                      injector
+                          .template create<sptr<common::WorkerThreadPool>>(),
+                      config.trieCommitThreads());
+                }),
             bind_by_lambda<storage::trie_pruner::TriePruner>(
                 [](const auto &injector)
                     -> sptr<storage::trie_pruner::TriePruner> {
@@ -1093,6 +1145,12 @@ namespace kagome::injector {
         .template create<sptr<benchmark::BlockExecutionBenchmark>>();
   }
 
+  std::shared_ptr<benchmark::RuntimeBenchmark>
+  KagomeNodeInjector::injectRuntimeBenchmark() {
+    return pimpl_->injector_
+        .template create<sptr<benchmark::RuntimeBenchmark>>();
+  }
+
   std::shared_ptr<Watchdog> KagomeNodeInjector::injectWatchdog() {
     return pimpl_->injector_.template create<sptr<Watchdog>>();
   }
@@ -1105,4 +1163,12 @@ namespace kagome::injector {
   void KagomeNodeInjector::kademliaRandomWalk() {
     pimpl_->injector_.create<sptr<KademliaRandomWalk>>();
   }
+
+  void KagomeNodeInjector::runtimeInstancesPrewarm() {
+    pimpl_->injector_.create<sptr<runtime::RuntimeInstancesPrewarm>>();
+  }
+
+  void KagomeNodeInjector::runtimeUpgradePrecompiler() {
+    pimpl_->injector_.create<sptr<runtime::RuntimeUpgradePrecompiler>>();
+  }
 }  // namespace kagome::injector
@@ -38,7 +38,8 @@ namespace kagome {
 
   namespace benchmark {
     class BlockExecutionBenchmark;
-  }
+    class RuntimeBenchmark;
+  }  // namespace benchmark
 
   namespace dispute {
     class DisputeCoordinator;
@@ -147,6 +148,8 @@ namespace kagome::injector {
     std::shared_ptr<authority_discovery::AddressPublisher>
     injectAddressPublisher();
     void kademliaRandomWalk();
+    void runtimeInstancesPrewarm();
+    void runtimeUpgradePrecompiler();
 
     std::shared_ptr<application::mode::PrintChainInfoMode>
     injectPrintChainInfoMode();
@@ -154,6 +157,7 @@ namespace kagome::injector {
     injectPrecompileWasmMode();
     std::shared_ptr<application::mode::RecoveryMode> injectRecoveryMode();
     std::shared_ptr<benchmark::BlockExecutionBenchmark> injectBlockBenchmark();
+    std::shared_ptr<benchmark::RuntimeBenchmark> injectRuntimeBenchmark();
 
    protected:
     std::shared_ptr<class KagomeNodeInjectorImpl> pimpl_;
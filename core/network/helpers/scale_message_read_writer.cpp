@@ -6,6 +6,9 @@
 
 #include "network/helpers/scale_message_read_writer.hpp"
 
+#include <libp2p/basic/write_return_size.hpp>
+#include <libp2p/multi/uvarint.hpp>
+
 namespace kagome::network {
   ScaleMessageReadWriter::ScaleMessageReadWriter(
       std::shared_ptr<libp2p::basic::MessageReadWriter> read_writer)
@@ -15,4 +18,29 @@ namespace kagome::network {
       const std::shared_ptr<libp2p::basic::ReadWriter> &read_writer)
       : read_writer_{std::make_shared<libp2p::basic::MessageReadWriterUvarint>(
           read_writer)} {}
+
+  void ScaleMessageReadWriter::writeEncoded(
+      const std::shared_ptr<libp2p::basic::Writer> &writer,
+      EncodedMessage msg,
+      libp2p::basic::Writer::WriteCallbackFunc cb) {
+    BOOST_ASSERT(msg != nullptr);
+    const auto &bytes = *msg;
+    libp2p::writeReturnSize(
+        writer,
+        bytes,
+        [msg{std::move(msg)}, cb{std::move(cb)}](auto &&write_res) {
+          cb(std::forward<decltype(write_res)>(write_res));
+        });
+  }
+
+  ScaleMessageReadWriter::EncodedMessage ScaleMessageReadWriter::prependLength(
+      libp2p::BytesIn payload) {
+    libp2p::multi::UVarint length{payload.size()};
+    auto &prefix = length.toVector();
+    auto bytes = std::make_shared<std::vector<uint8_t>>();
+    bytes->reserve(prefix.size() + payload.size());
+    bytes->insert(bytes->end(), prefix.begin(), prefix.end());
+    bytes->insert(bytes->end(), payload.begin(), payload.end());
+    return bytes;
+  }
 }  // namespace kagome::network
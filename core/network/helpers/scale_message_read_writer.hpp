@@ -10,6 +10,7 @@
 #include <memory>
 
 #include <libp2p/basic/message_read_writer_uvarint.hpp>
+#include <libp2p/common/types.hpp>
 #include <outcome/outcome.hpp>
 
 #include "scale/scale.hpp"
@@ -24,6 +25,9 @@ namespace kagome::network {
     using ReadCallback = std::function<void(outcome::result<MsgType>)>;
 
    public:
+    /// SCALE-encoded message with the prepended varint, shared between streams
+    using EncodedMessage = std::shared_ptr<const std::vector<uint8_t>>;
+
     explicit ScaleMessageReadWriter(
         std::shared_ptr<libp2p::basic::MessageReadWriter> read_writer);
     explicit ScaleMessageReadWriter(
@@ -84,7 +88,33 @@ namespace kagome::network {
                           });
     }
 
+    /**
+     * SCALE-encode a message and prepend the varint once, so the same buffer
+     * can be written to any number of channels
+     * @tparam MsgType - type of the message
+     * @param msg to be encoded
+     */
+    template <typename MsgType>
+    static outcome::result<EncodedMessage> encode(const MsgType &msg) {
+      OUTCOME_TRY(encoded, ::scale::encode(msg));
+      return prependLength(encoded);
+    }
+
+    /**
+     * Write a message made by `encode` to the channel, the buffer is kept
+     * alive until the write completes
+     * @param writer - channel to write to
+     * @param msg to be written
+     * @param cb to be called, when the message is written, or error happens
+     */
+    static void writeEncoded(
+        const std::shared_ptr<libp2p::basic::Writer> &writer,
+        EncodedMessage msg,
+        libp2p::basic::Writer::WriteCallbackFunc cb);
+
    private:
+    static EncodedMessage prependLength(libp2p::BytesIn payload);
+
     std::shared_ptr<libp2p::basic::MessageReadWriter> read_writer_;
   };
 }  // namespace kagome::network
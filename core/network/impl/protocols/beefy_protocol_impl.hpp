@@ -37,6 +37,9 @@ namespace kagome::network {
 
     bool start() override;
     const std::string &protocolName() const override;
+    OutboundPriority outboundPriority() const override {
+      return OutboundPriority::Consensus;
+    }
     void onIncomingStream(std::shared_ptr<Stream> stream) override;
     void newOutgoingStream(
         const PeerId &peer_id,
@@ -58,6 +58,10 @@ namespace kagome::network {
 
     const std::string &protocolName() const override;
 
+    OutboundPriority outboundPriority() const override {
+      return OutboundPriority::Consensus;
+    }
+
     void onIncomingStream(std::shared_ptr<Stream> stream) override;
     void newOutgoingStream(
         const PeerId &peer_id,
@@ -187,6 +187,10 @@ namespace kagome::network {
       return protocol_name.value();
     }
 
+    OutboundPriority outboundPriority() const override {
+      return OutboundPriority::Parachain;
+    }
+
    private:
     void onHandshake(const PeerId &peer) {
       if constexpr (kCollation) {
@@ -76,6 +76,10 @@ namespace kagome::network {
 
     const std::string &protocolName() const override;
 
+    OutboundPriority outboundPriority() const override {
+      return OutboundPriority::Transactions;
+    }
+
     void onIncomingStream(std::shared_ptr<Stream> stream) override;
     void newOutgoingStream(
         const PeerId &peer_id,
@@ -4,6 +4,9 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
+#include <ranges>
+
 #include <boost/algorithm/string/predicate.hpp>
 
 #include "crypto/blake2/blake2b.h"
@@ -24,7 +27,8 @@ namespace kagome::network {
         log_{log::createLogger("StateSync")} {
     done_ = isKnown(block.state_root);
     if (not done_) {
-      auto &level = levels_.emplace_back();
+      auto &level =
+          state_.ranges[state_.next_range++].levels.emplace_back();
       level.child = {};
       level.branch_hash = block.state_root;
     }
@@ -34,11 +38,37 @@ namespace kagome::network {
     return done_;
   }
 
-  StateRequest StateSyncRequestFlow::nextRequest() const {
+  std::optional<StateSyncRequestFlow::RangeId>
+  StateSyncRequestFlow::takeRange() {
+    for (auto &[id, range] : state_.ranges) {
+      if (not range.fetching) {
+        range.fetching = true;
+        return id;
+      }
+    }
+    return std::nullopt;
+  }
+
+  void StateSyncRequestFlow::releaseRange(RangeId id) {
+    if (auto it = state_.ranges.find(id); it != state_.ranges.end()) {
+      it->second.fetching = false;
+    }
+  }
+
+  size_t StateSyncRequestFlow::fetching() const {
+    return std::ranges::count_if(
+        state_.ranges, [](const auto &p) { return p.second.fetching; });
+  }
+
+  StateRequest StateSyncRequestFlow::nextRequest(RangeId id) const {
     BOOST_ASSERT(not complete());
+    auto &range = state_.ranges.at(id);
     StateRequest req{block_info_.hash, {}, false};
-    for (auto &level : levels_) {
+    for (auto &level : range.levels) {
       storage::trie::KeyNibbles nibbles;
+      if (&level == &range.levels.front()) {
+        nibbles.put(range.prefix);
+      }
       for (auto &item : level.stack) {
         nibbles.put(item.node->getKeyNibbles());
         if (item.branch) {
@@ -54,9 +84,11 @@ namespace kagome::network {
   }
 
   outcome::result<void> StateSyncRequestFlow::onResponse(
-      const StateResponse &res) {
-    storage::trie::PolkadotCodec codec;
+      RangeId id, const StateResponse &res) {
     BOOST_ASSERT(not complete());
+    auto it = state_.ranges.find(id);
+    BOOST_ASSERT(it != state_.ranges.end());
+    it->second.fetching = false;
     BOOST_OUTCOME_TRY(auto nodes, storage::trie::compactDecode(res.proof));
     auto diff_count = nodes.size(), diff_size = res.proof.size();
     if (diff_count != 0) {
@@ -69,9 +101,131 @@ namespace kagome::network {
               stat_count_,
               stat_size_ >> 20);
     }
-    while (not levels_.empty()) {
-      auto &level = levels_.back();
-      auto push = [&](decltype(nodes)::iterator it) -> outcome::result<void> {
+    // nothing is changed if any step fails, range is requested again
+    auto state = state_;
+    auto batch = node_db_->batch();
+    auto r = applyResponse(state, id, nodes, *batch);
+    if (r) {
+      r = batch->commit();
+    }
+    if (r) {
+      state_ = std::move(state);
+      known_.merge(pending_known_);
+      done_ = state_.ranges.empty();
+    }
+    pending_known_.clear();
+    return r;
+  }
+
+  outcome::result<void> StateSyncRequestFlow::applyResponse(
+      State &state, RangeId id, Nodes &nodes, storage::BufferBatch &batch) {
+    // nodes beyond the range and its subranges are ignored
+    std::vector<RangeId> ids{id};
+    while (not ids.empty()) {
+      auto it = state.ranges.find(ids.back());
+      ids.pop_back();
+      OUTCOME_TRY(split, splitRange(state, it->second, nodes));
+      if (split) {
+        state.ranges.erase(it);
+        ids.insert(ids.end(), split->begin(), split->end());
+        continue;
+      }
+      OUTCOME_TRY(onNodes(it->second, nodes, batch));
+    }
+    std::erase_if(state.ranges,
+                  [](const auto &p) { return p.second.levels.empty(); });
+    return writeParents(state, batch);
+  }
+
+  outcome::result<std::optional<std::vector<StateSyncRequestFlow::RangeId>>>
+  StateSyncRequestFlow::splitRange(State &state,
+                                   const Range &range,
+                                   Nodes &nodes) {
+    if (state.ranges.size() >= kMaxRanges or range.levels.size() != 1
+        or not range.levels.front().stack.empty()) {
+      return std::nullopt;
+    }
+    auto it = nodes.find(*range.levels.front().branch_hash);
+    if (it == nodes.end()) {
+      return std::nullopt;
+    }
+    if (not it->second.second) {
+      storage::trie::PolkadotCodec codec;
+      BOOST_OUTCOME_TRY(it->second.second, codec.decodeNode(it->second.first));
+    }
+    auto node = it->second.second;
+    if (not node->isBranch() or node->getValue()) {
+      return std::nullopt;
+    }
+    auto parent = std::make_shared<const Parent>(
+        Parent{Item{it->first, std::move(it->second.first)}, range.parent});
+    nodes.erase(it);
+    auto &children =
+        dynamic_cast<storage::trie::BranchNode &>(*node).children;
+    std::vector<RangeId> ids;
+    for (uint8_t i = 0; i < storage::trie::BranchNode::kMaxChildren; ++i) {
+      if (not children[i]) {
+        continue;
+      }
+      auto hash = dynamic_cast<storage::trie::DummyNode &>(*children[i])
+                      .db_key.asHash();
+      // inline children are contained in split node
+      if (not hash or isKnown(*hash)) {
+        continue;
+      }
+      Range child;
+      child.prefix.put(range.prefix);
+      child.prefix.put(node->getKeyNibbles());
+      child.prefix.putUint8(i);
+      child.parent = parent;
+      auto &level = child.levels.emplace_back();
+      level.child = {};
+      level.child.match(child.prefix);
+      level.branch_hash = hash;
+      ids.emplace_back(state.next_range);
+      state.ranges.emplace(state.next_range++, std::move(child));
+    }
+    state.parents.emplace_back(std::move(parent));
+    SL_DEBUG(log_,
+             "state of block {} is split into {} ranges",
+             block_info_,
+             state.ranges.size() - 1);
+    return ids;
+  }
+
+  outcome::result<void> StateSyncRequestFlow::writeParents(
+      State &state, storage::BufferBatch &batch) {
+    auto incomplete = [&](const Parent *parent) {
+      for (auto &range : state.ranges | std::views::values) {
+        for (auto p = range.parent.get(); p != nullptr; p = p->parent.get()) {
+          if (p == parent) {
+            return true;
+          }
+        }
+      }
+      return false;
+    };
+    for (auto it = state.parents.begin(); it != state.parents.end();) {
+      auto &item = (*it)->item;
+      if (incomplete(it->get())) {
+        ++it;
+        continue;
+      }
+      // parent may be shared with state before response
+      OUTCOME_TRY(batch.put(item.hash, common::Buffer{item.encoded}));
+      pending_known_.emplace(item.hash);
+      it = state.parents.erase(it);
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> StateSyncRequestFlow::onNodes(
+      Range &range, Nodes &nodes, storage::BufferBatch &batch) {
+    storage::trie::PolkadotCodec codec;
+    auto &levels = range.levels;
+    while (not levels.empty()) {
+      auto &level = levels.back();
+      auto push = [&](Nodes::iterator it) -> outcome::result<void> {
         auto &node = it->second.second;
         auto &raw = it->second.first;
         if (not node) {
@@ -94,7 +248,7 @@ namespace kagome::network {
       while (not level.stack.empty()) {
         auto child = level.value_child;
         if (child and not isKnown(*child)) {
-          auto &level = levels_.emplace_back();
+          auto &level = levels.emplace_back();
           level.branch_hash = child;
           pop_level = false;
           break;
@@ -104,8 +258,8 @@ namespace kagome::network {
           if (it == nodes.end()) {
             return outcome::success();
           }
-          OUTCOME_TRY(node_db_->put(it->first, std::move(it->second.first)));
-          known_.emplace(it->first);
+          OUTCOME_TRY(batch.put(it->first, std::move(it->second.first)));
+          pending_known_.emplace(it->first);
         }
         for (level.branchInit(); not level.branch_end; level.branchNext()) {
           if (not level.branch_hash or isKnown(*level.branch_hash)) {
@@ -120,8 +274,8 @@ namespace kagome::network {
         }
         if (level.branch_end) {
           auto &t = level.stack.back().t;
-          OUTCOME_TRY(node_db_->put(t.hash, std::move(t.encoded)));
-          known_.emplace(t.hash);
+          OUTCOME_TRY(batch.put(t.hash, std::move(t.encoded)));
+          pending_known_.emplace(t.hash);
           level.pop();
           if (not level.stack.empty()) {
             level.branchNext();
@@ -129,10 +283,9 @@ namespace kagome::network {
         }
       }
       if (pop_level) {
-        levels_.pop_back();
+        levels.pop_back();
       }
     }
-    done_ = true;
     return outcome::success();
   }
 
@@ -140,7 +293,7 @@ namespace kagome::network {
     if (hash == storage::trie::kEmptyRootHash) {
       return true;
     }
-    if (known_.find(hash) != known_.end()) {
+    if (known_.contains(hash) or pending_known_.contains(hash)) {
       return true;
     }
     if (auto node_res = node_db_->contains(hash),
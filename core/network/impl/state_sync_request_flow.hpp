@@ -6,12 +6,14 @@
 
 #pragma once
 
+#include <map>
 #include <unordered_set>
 
 #include "log/logger.hpp"
 #include "network/types/state_request.hpp"
 #include "network/types/state_response.hpp"
 #include "primitives/block_header.hpp"
+#include "storage/trie/compact_decode.hpp"
 #include "storage/trie/raw_cursor.hpp"
 
 namespace kagome::storage::trie {
@@ -21,6 +23,14 @@ namespace kagome::storage::trie {
 namespace kagome::network {
   /**
    * Recursive coroutine to fetch missing trie nodes with "/state/2" protocol.
+   * When the top branch node of a range is received, subtrees of its
+   * children become independent ranges, so requests for different ranges
+   * may be sent to different peers concurrently. Large subtrees are split
+   * again at deeper branches, up to `kMaxRanges`.
+   * Nodes are written bottom-up and a split branch is written after all its
+   * ranges, so the sync resumes from the missing subtrees after restart.
+   * Response is applied to the copy of the flow state, which replaces the
+   * state only when nodes of response are committed.
    *
    * https://github.com/paritytech/substrate/blob/master/client/network/sync/src/state.rs
    */
@@ -33,6 +43,8 @@ namespace kagome::network {
 
     using Level = storage::trie::RawCursor<Item>;
 
+    using RangeId = size_t;
+
     StateSyncRequestFlow(
         std::shared_ptr<storage::trie::TrieStorageBackend> node_db,
         const primitives::BlockInfo &block_info,
@@ -48,11 +60,71 @@ namespace kagome::network {
 
     bool complete() const;
 
-    StateRequest nextRequest() const;
+    /**
+     * Takes the range which is not being fetched now
+     * @return range id or nullopt if all ranges are being fetched
+     */
+    std::optional<RangeId> takeRange();
+
+    /// Makes the range available to `takeRange` after failed request
+    void releaseRange(RangeId id);
+
+    /// Number of ranges being fetched now
+    size_t fetching() const;
+
+    StateRequest nextRequest(RangeId id) const;
 
-    outcome::result<void> onResponse(const StateResponse &res);
+    outcome::result<void> onResponse(RangeId id, const StateResponse &res);
 
    private:
+    /// Ranges are not split further when there are that many
+    static constexpr size_t kMaxRanges = 256;
+
+    /// Branch node split into ranges of its children subtrees
+    struct Parent {
+      Item item;
+      std::shared_ptr<const Parent> parent;
+    };
+
+    /// Subtree of the state trie
+    struct Range {
+      /// nibbles of path to the subtree
+      storage::trie::KeyNibbles prefix;
+      std::vector<Level> levels;
+      bool fetching = false;
+      /// written when all its ranges are complete
+      std::shared_ptr<const Parent> parent;
+    };
+
+    struct State {
+      std::map<RangeId, Range> ranges;
+      RangeId next_range = 0;
+      /// split branches waiting for their ranges
+      std::vector<std::shared_ptr<const Parent>> parents;
+    };
+
+    using Nodes = storage::trie::CompactDecoded;
+
+    outcome::result<void> applyResponse(State &state,
+                                        RangeId id,
+                                        Nodes &nodes,
+                                        storage::BufferBatch &batch);
+
+    /**
+     * Splits range into ranges of its top branch children subtrees
+     * @return ids of new ranges or nullopt if range can't be split
+     */
+    outcome::result<std::optional<std::vector<RangeId>>> splitRange(
+        State &state, const Range &range, Nodes &nodes);
+
+    outcome::result<void> onNodes(Range &range,
+                                  Nodes &nodes,
+                                  storage::BufferBatch &batch);
+
+    /// Writes split branches which have no incomplete ranges
+    outcome::result<void> writeParents(State &state,
+                                       storage::BufferBatch &batch);
+
     bool isKnown(const common::Hash256 &hash);
 
     std::shared_ptr<storage::trie::TrieStorageBackend> node_db_;
@@ -61,8 +133,10 @@ namespace kagome::network {
     primitives::BlockHeader block_;
 
     bool done_ = false;
-    std::vector<Level> levels_;
+    State state_;
     std::unordered_set<common::Hash256> known_;
+    /// nodes written to batch of response being applied
+    std::unordered_set<common::Hash256> pending_known_;
 
     size_t stat_count_ = 0, stat_size_ = 0;
     log::Logger log_;
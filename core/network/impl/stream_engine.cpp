@@ -8,6 +8,57 @@
 
 namespace kagome::network {
 
+  namespace {
+    constexpr auto kQueueBytesMetric = "kagome_network_outbound_queue_bytes";
+    constexpr auto kQueueMessagesMetric =
+        "kagome_network_outbound_queue_messages";
+    constexpr auto kDroppedMetric = "kagome_network_outbound_dropped_total";
+    constexpr auto kCoalescedMetric =
+        "kagome_network_outbound_coalesced_total";
+
+    constexpr std::array<std::string_view, kOutboundPriorityCount>
+        kPriorityNames{"consensus", "parachain", "sync", "transactions"};
+  }  // namespace
+
+  StreamEngine::StreamEngine(
+      std::shared_ptr<ReputationRepository> reputation_repository)
+      : reputation_repository_(std::move(reputation_repository)),
+        logger_{log::createLogger("StreamEngine", "network")},
+        metrics_registry_{metrics::createRegistry()} {
+    metrics_registry_->registerGaugeFamily(
+        kQueueBytesMetric, "Bytes queued to outgoing peer streams");
+    metrics_registry_->registerGaugeFamily(
+        kQueueMessagesMetric, "Messages queued to outgoing peer streams");
+    metrics_registry_->registerCounterFamily(
+        kDroppedMetric, "Messages dropped because of full peer queues");
+    metrics_registry_->registerCounterFamily(
+        kCoalescedMetric, "Messages skipped as equal to already queued ones");
+    for (size_t i = 0; i < kOutboundPriorityCount; ++i) {
+      std::map<std::string, std::string> labels{
+          {"priority", std::string{kPriorityNames[i]}},
+      };
+      queue_metrics_[i] = QueueMetrics{
+          metrics_registry_->registerGaugeMetric(kQueueBytesMetric, labels),
+          metrics_registry_->registerGaugeMetric(kQueueMessagesMetric, labels),
+          metrics_registry_->registerCounterMetric(kDroppedMetric, labels),
+          metrics_registry_->registerCounterMetric(kCoalescedMetric, labels),
+      };
+    }
+  }
+
+  size_t StreamEngine::outboundQueueLimit(OutboundPriority priority) {
+    switch (priority) {
+      case OutboundPriority::Consensus:
+      case OutboundPriority::Parachain:
+        return 16 << 20;
+      case OutboundPriority::Sync:
+        return 4 << 20;
+      case OutboundPriority::Transactions:
+        return 1 << 20;
+    }
+    return 1 << 20;
+  }
+
   void StreamEngine::add(std::shared_ptr<Stream> stream,
                          const std::shared_ptr<ProtocolBase> &protocol,
                          Direction direction) {
@@ -26,19 +77,27 @@ namespace kagome::network {
              peer_id,
              protocol->protocolName());
 
+    Writes writes;
     streams_.exclusiveAccess([&](PeerMap &streams) {
       bool existing = false;
-      forPeerProtocol(peer_id, streams, protocol, [&](auto type, auto &descr) {
-        existing = true;
-        if (is_incoming) {
-          uploadStream(
-              descr.incoming.stream, stream, protocol, Direction::INCOMING);
-        }
-        if (is_outgoing) {
-          uploadStream(
-              descr.outgoing.stream, stream, protocol, Direction::OUTGOING);
-        }
-      });
+      forPeerProtocol(
+          peer_id, streams, protocol, [&](auto &protocols, auto &descr) {
+            existing = true;
+            if (is_incoming) {
+              uploadStream(
+                  descr.incoming.stream, stream, protocol, Direction::INCOMING);
+            }
+            if (is_outgoing) {
+              if (descr.outgoing.stream != stream) {
+                // the message being written to the replaced stream is written
+                // to the new one
+                descr.outgoing.writing = false;
+              }
+              uploadStream(
+                  descr.outgoing.stream, stream, protocol, Direction::OUTGOING);
+              startWrites(peer_id, protocols, writes);
+            }
+          });
 
       if (not existing) {
         auto &proto_map = streams[peer_id];
@@ -55,6 +114,7 @@ namespace kagome::network {
                  peer_id);
       }
     });
+    write(std::move(writes));
   }
 
   void StreamEngine::reserveStreams(
@@ -78,6 +138,7 @@ namespace kagome::network {
       if (auto it = streams.find(peer_id); it != streams.end()) {
         for (auto &protocol_it : it->second) {
           auto &descr = protocol_it.second;
+          clearQueue(descr);
           if (descr.incoming.stream) {
             descr.incoming.stream->reset();
           }
@@ -102,6 +163,7 @@ namespace kagome::network {
         auto protocol_it = protocols.find(protocol);
         if (protocol_it != protocols.end()) {
           auto &descr = protocol_it->second;
+          clearQueue(descr);
           if (descr.incoming.stream) {
             descr.incoming.stream->reset();
           }
@@ -138,6 +200,199 @@ namespace kagome::network {
     });
   }
 
+  void StreamEngine::sendEncoded(const PeerId &peer_id,
+                                 const std::shared_ptr<ProtocolBase> &protocol,
+                                 EncodedMessage msg) {
+    BOOST_ASSERT(msg != nullptr);
+    BOOST_ASSERT(protocol != nullptr);
+
+    Writes writes;
+    streams_.exclusiveAccess([&](PeerMap &streams) {
+      forPeerProtocol(
+          peer_id, streams, protocol, [&](auto &protocols, auto &descr) {
+            enqueue(peer_id, protocol, descr, msg);
+            startWrites(peer_id, protocols, writes);
+          });
+    });
+    write(std::move(writes));
+  }
+
+  void StreamEngine::broadcastEncoded(
+      const std::shared_ptr<ProtocolBase> &protocol,
+      const EncodedMessage &msg,
+      const std::function<bool(const PeerId &peer_id)> &predicate) {
+    BOOST_ASSERT(msg != nullptr);
+    BOOST_ASSERT(protocol != nullptr);
+
+    Writes writes;
+    forEachPeer([&](const auto &peer_id, auto &proto_map) {
+      if (predicate(peer_id)) {
+        forProtocol(proto_map, protocol, [&](ProtocolDescr &descr) {
+          SL_TRACE(logger_,
+                   "Sending msg to peer.(protocol={}, peer={})",
+                   protocol->protocolName(),
+                   peer_id);
+          enqueue(peer_id, protocol, descr, msg);
+          startWrites(peer_id, proto_map, writes);
+        });
+      }
+    });
+    write(std::move(writes));
+  }
+
+  void StreamEngine::enqueue(const PeerId &peer_id,
+                             const std::shared_ptr<ProtocolBase> &protocol,
+                             ProtocolDescr &descr,
+                             const EncodedMessage &msg) {
+    auto &queue = descr.outgoing.queue;
+    auto &metrics = queueMetrics(*protocol);
+    // the front message may be being written already
+    auto waiting = queue.begin() + (descr.outgoing.writing ? 1 : 0);
+    for (auto it = waiting; it != queue.end(); ++it) {
+      if (*it == msg or **it == *msg) {
+        metrics.coalesced->inc();
+        return;
+      }
+    }
+
+    auto priority = protocol->outboundPriority();
+    auto limit = outboundQueueLimit(priority);
+    if (descr.outgoing.queued_bytes + msg->size() > limit) {
+      if (priority == OutboundPriority::Transactions) {
+        // transactions are propagated again later, keep the queued ones
+        if (descr.outgoing.queued_bytes != 0) {
+          SL_TRACE(logger_,
+                   "Queue is full, drop message.(protocol={}, peer={})",
+                   protocol->protocolName(),
+                   peer_id);
+          metrics.dropped->inc();
+          return;
+        }
+      } else {
+        // newer messages supersede the stale ones
+        while (descr.outgoing.queued_bytes + msg->size() > limit
+               and waiting != queue.end()) {
+          SL_TRACE(logger_,
+                   "Queue is full, drop stale message.(protocol={}, peer={})",
+                   protocol->protocolName(),
+                   peer_id);
+          waiting = eraseQueued(descr, waiting);
+          metrics.dropped->inc();
+        }
+      }
+    }
+
+    queue.emplace_back(msg);
+    descr.outgoing.queued_bytes += msg->size();
+    metrics.bytes->inc(msg->size());
+    metrics.messages->inc();
+
+    if (not descr.hasActiveOutgoing()) {
+      SL_TRACE(logger_,
+               "No active outgoing. Reopen outgoing stream.(protocol={}, "
+               "peer={})",
+               protocol->protocolName(),
+               peer_id);
+      openOutgoingStream(peer_id, protocol, descr);
+    }
+  }
+
+  std::deque<StreamEngine::EncodedMessage>::iterator StreamEngine::eraseQueued(
+      ProtocolDescr &descr, std::deque<EncodedMessage>::iterator it) {
+    auto &metrics = queueMetrics(*descr.protocol);
+    auto size = (*it)->size();
+    descr.outgoing.queued_bytes -= size;
+    metrics.bytes->dec(size);
+    metrics.messages->dec();
+    return descr.outgoing.queue.erase(it);
+  }
+
+  void StreamEngine::clearQueue(ProtocolDescr &descr) {
+    auto &queue = descr.outgoing.queue;
+    for (auto it = queue.begin(); it != queue.end();) {
+      it = eraseQueued(descr, it);
+    }
+    descr.outgoing.writing = false;
+  }
+
+  void StreamEngine::startWrites(const PeerId &peer_id,
+                                 ProtocolMap &protocols,
+                                 Writes &writes) {
+    // a class is written only when more urgent ones have no waiting messages
+    auto top = kOutboundPriorityCount;
+    for (auto &[protocol, descr] : protocols) {
+      if (descr.waitingMessages() != 0 and descr.hasActiveOutgoing()) {
+        top = std::min(top, static_cast<size_t>(protocol->outboundPriority()));
+      }
+    }
+    for (auto &[protocol, descr] : protocols) {
+      if (static_cast<size_t>(protocol->outboundPriority()) != top
+          or descr.outgoing.writing or descr.outgoing.queue.empty()
+          or not descr.hasActiveOutgoing()) {
+        continue;
+      }
+      descr.outgoing.writing = true;
+      writes.emplace_back(Write{
+          .peer_id = peer_id,
+          .protocol = protocol,
+          .stream = descr.outgoing.stream,
+          .msg = descr.outgoing.queue.front(),
+      });
+    }
+  }
+
+  void StreamEngine::write(Writes writes) {
+    for (auto &pending : writes) {
+      ScaleMessageReadWriter::writeEncoded(
+          pending.stream,
+          std::move(pending.msg),
+          [wp(weak_from_this()),
+           peer_id{std::move(pending.peer_id)},
+           protocol{std::move(pending.protocol)},
+           stream{pending.stream}](auto &&res) {
+            if (auto self = wp.lock()) {
+              if (res.has_value()) {
+                SL_TRACE(self->logger_,
+                         "Message sent to {} stream with {}",
+                         protocol->protocolName(),
+                         peer_id);
+              } else {
+                SL_TRACE(self->logger_,
+                         "Could not send message to {} stream with {}: {}",
+                         protocol->protocolName(),
+                         peer_id,
+                         res.error());
+                stream->reset();
+              }
+              self->onWritten(peer_id, protocol, stream);
+            }
+          });
+    }
+  }
+
+  void StreamEngine::onWritten(const PeerId &peer_id,
+                               const std::shared_ptr<ProtocolBase> &protocol,
+                               const std::shared_ptr<Stream> &stream) {
+    Writes writes;
+    streams_.exclusiveAccess([&](PeerMap &streams) {
+      forPeerProtocol(
+          peer_id, streams, protocol, [&](auto &protocols, auto &descr) {
+            // the stream was replaced while writing
+            if (descr.outgoing.stream != stream or not descr.outgoing.writing) {
+              return;
+            }
+            descr.outgoing.writing = false;
+            eraseQueued(descr, descr.outgoing.queue.begin());
+            if (not descr.outgoing.queue.empty()
+                and not descr.hasActiveOutgoing()) {
+              openOutgoingStream(peer_id, protocol, descr);
+            }
+            startWrites(peer_id, protocols, writes);
+          });
+    });
+    write(std::move(writes));
+  }
+
   void StreamEngine::uploadStream(std::shared_ptr<Stream> &dst,
                                   const std::shared_ptr<Stream> &src,
                                   const std::shared_ptr<ProtocolBase> &protocol,
@@ -193,7 +448,7 @@ namespace kagome::network {
               self->streams_.exclusiveAccess([&](auto &streams) {
                 self->forPeerProtocol(
                     peer_id, streams, protocol, [&](auto, auto &descr) {
-                      descr.deferred_messages.clear();
+                      self->clearQueue(descr);
                       descr.dropReserved();
                     });
               });
@@ -211,25 +466,26 @@ namespace kagome::network {
             }
 
             auto &stream = stream_res.value();
+            Writes writes;
             self->streams_.exclusiveAccess([&](auto &streams) {
               [[maybe_unused]] bool existing = false;
               self->forPeerProtocol(
-                  peer_id, streams, protocol, [&](auto, auto &descr) {
+                  peer_id,
+                  streams,
+                  protocol,
+                  [&](auto &protocols, auto &descr) {
                     existing = true;
                     self->uploadStream(descr.outgoing.stream,
                                        stream,
                                        protocol,
                                        Direction::OUTGOING);
+                    descr.outgoing.writing = false;
                     descr.dropReserved();
-
-                    while (!descr.deferred_messages.empty()) {
-                      auto &msg = descr.deferred_messages.front();
-                      msg(stream);
-                      descr.deferred_messages.pop_front();
-                    }
+                    self->startWrites(peer_id, protocols, writes);
                   });
               BOOST_ASSERT(existing);
             });
+            self->write(std::move(writes));
           });
     }
   }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <deque>
 #include <numeric>
 #include <optional>
@@ -22,6 +23,7 @@
 #include "libp2p/peer/peer_info.hpp"
 #include "libp2p/peer/protocol.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "network/helpers/scale_message_read_writer.hpp"
 #include "network/protocol_base.hpp"
 #include "network/reputation_repository.hpp"
@@ -37,7 +39,11 @@ namespace kagome::network {
    *     ` ProtocolPtr_0,
    *       Incoming_Stream_0
    *       Outgoing_Stream_0
-   *       MessagesQueue for creating outgoing stream
+   *       MessagesQueue of the outgoing stream
+   *
+   * Messages are written to an outgoing stream one at a time. Queues are
+   * bounded in bytes per protocol priority, stale messages are dropped when
+   * a peer doesn't keep up.
    */
   struct StreamEngine final : std::enable_shared_from_this<StreamEngine> {
     using PeerInfo = libp2p::peer::PeerInfo;
@@ -45,6 +51,7 @@ namespace kagome::network {
     using Protocol = libp2p::peer::ProtocolName;
     using Stream = libp2p::connection::Stream;
     using StreamEnginePtr = std::shared_ptr<StreamEngine>;
+    using EncodedMessage = ScaleMessageReadWriter::EncodedMessage;
 
     static constexpr auto kDownVoteByDisconnectionExpirationTimeout =
         std::chrono::seconds(30);
@@ -63,9 +70,13 @@ namespace kagome::network {
 
     ~StreamEngine() = default;
     explicit StreamEngine(
-        std::shared_ptr<ReputationRepository> reputation_repository)
-        : reputation_repository_(std::move(reputation_repository)),
-          logger_{log::createLogger("StreamEngine", "network")} {}
+        std::shared_ptr<ReputationRepository> reputation_repository);
+
+    /**
+     * @return bytes queued to a stream of the priority above which messages
+     * are dropped
+     */
+    static size_t outboundQueueLimit(OutboundPriority priority);
 
     void add(std::shared_ptr<Stream> stream,
              const std::shared_ptr<ProtocolBase> &protocol,
@@ -107,23 +118,14 @@ namespace kagome::network {
               std::shared_ptr<T> msg) {
       BOOST_ASSERT(msg != nullptr);
       BOOST_ASSERT(protocol != nullptr);
-
-      bool was_sent = false;
-      streams_.sharedAccess([&](const auto &streams) {
-        forPeerProtocol(
-            peer_id, streams, protocol, [&](auto type, auto const &descr) {
-              if (descr.hasActiveOutgoing()) {
-                send(peer_id, protocol, descr.outgoing.stream, msg);
-                was_sent = true;
-              }
-            });
-      });
-
-      if (not was_sent) {
-        updateStream(peer_id, protocol, msg);
+      if (auto encoded = encode(protocol, *msg)) {
+        sendEncoded(peer_id, protocol, std::move(encoded));
       }
     }
 
+    /**
+     * Encodes the message once and writes the same buffer to every peer
+     */
     template <typename T>
     void broadcast(
         const std::shared_ptr<ProtocolBase> &protocol,
@@ -131,44 +133,9 @@ namespace kagome::network {
         const std::function<bool(const PeerId &peer_id)> &predicate) {
       BOOST_ASSERT(msg != nullptr);
       BOOST_ASSERT(protocol != nullptr);
-
-      forEachPeer([&](const auto &peer_id, auto &proto_map) {
-        if (predicate(peer_id)) {
-          forProtocol(proto_map, protocol, [&](ProtocolDescr &descr) {
-            SL_TRACE(logger_,
-                     "Sending msg to peer.(protocol={}, peer={})",
-                     protocol->protocolName(),
-                     peer_id);
-            if (descr.hasActiveOutgoing()) {
-              SL_TRACE(
-                  logger_,
-                  "Has active outgoing. Direct send.(protocol={}, peer={})",
-                  protocol->protocolName(),
-                  peer_id);
-              send(peer_id, protocol, descr.outgoing.stream, msg);
-            } else {
-              SL_TRACE(
-                  logger_,
-                  "No active outgoing. Reopen outgoing stream.(protocol={}, "
-                  "peer={})",
-                  protocol->protocolName(),
-                  peer_id);
-              descr.deferred_messages.push_back(
-                  [weak_self{weak_from_this()}, msg, peer_id, protocol](
-                      auto stream) {
-                    if (auto self = weak_self.lock()) {
-                      SL_TRACE(self->logger_,
-                               "Send deffered messages.(protocol={}, peer={})",
-                               protocol->protocolName(),
-                               peer_id);
-                      self->send(peer_id, protocol, stream, msg);
-                    }
-                  });
-              openOutgoingStream(peer_id, protocol, descr);
-            }
-          });
-        }
-      });
+      if (auto encoded = encode(protocol, *msg)) {
+        broadcastEncoded(protocol, encoded, predicate);
+      }
     }
 
     template <typename T>
@@ -179,6 +146,22 @@ namespace kagome::network {
       broadcast(protocol, msg, any);
     }
 
+    /**
+     * Sends a message made by ScaleMessageReadWriter::encode
+     */
+    void sendEncoded(const PeerId &peer_id,
+                     const std::shared_ptr<ProtocolBase> &protocol,
+                     EncodedMessage msg);
+
+    /**
+     * Writes a message made by ScaleMessageReadWriter::encode to streams of
+     * peers matching the predicate, without copying it
+     */
+    void broadcastEncoded(
+        const std::shared_ptr<ProtocolBase> &protocol,
+        const EncodedMessage &msg,
+        const std::function<bool(const PeerId &peer_id)> &predicate);
+
     template <typename F>
     void forEachPeer(F &&f) {
       streams_.exclusiveAccess([&](auto &streams) {
@@ -219,11 +202,12 @@ namespace kagome::network {
       struct {
         std::shared_ptr<Stream> stream;
         bool reserved = false;
+        /// messages to write, the front one is being written if `writing`
+        std::deque<EncodedMessage> queue;
+        size_t queued_bytes = 0;
+        bool writing = false;
       } outgoing;
 
-      std::deque<std::function<void(std::shared_ptr<Stream>)>>
-          deferred_messages;
-
      public:
       explicit ProtocolDescr(std::shared_ptr<ProtocolBase> proto)
           : protocol{std::move(proto)} {}
@@ -268,6 +252,13 @@ namespace kagome::network {
         // bt();
       }
 
+      /**
+       * Returns number of queued messages which are not being written.
+       */
+      size_t waitingMessages() const {
+        return outgoing.queue.size() - (outgoing.writing ? 1 : 0);
+      }
+
       /**
        * Returns if descriptor contains active incoming stream.
        */
@@ -280,38 +271,75 @@ namespace kagome::network {
         std::unordered_map<std::shared_ptr<ProtocolBase>, struct ProtocolDescr>;
     using PeerMap = std::unordered_map<PeerId, ProtocolMap>;
 
+    struct Write {
+      PeerId peer_id;
+      std::shared_ptr<ProtocolBase> protocol;
+      std::shared_ptr<Stream> stream;
+      EncodedMessage msg;
+    };
+    using Writes = std::vector<Write>;
+
+    struct QueueMetrics {
+      metrics::Gauge *bytes;
+      metrics::Gauge *messages;
+      metrics::Counter *dropped;
+      metrics::Counter *coalesced;
+    };
+
     void uploadStream(std::shared_ptr<Stream> &dst,
                       const std::shared_ptr<Stream> &src,
                       const std::shared_ptr<ProtocolBase> &protocol,
                       Direction direction);
 
     template <typename T>
-    void send(const PeerId &peer_id,
-              const std::shared_ptr<ProtocolBase> &protocol,
-              std::shared_ptr<Stream> stream,
-              const std::shared_ptr<T> &msg) {
-      BOOST_ASSERT(stream != nullptr);
-
-      auto read_writer = std::make_shared<ScaleMessageReadWriter>(stream);
-      read_writer->write(
-          *msg,
-          [wp(weak_from_this()), peer_id, protocol, msg, stream](auto &&res) {
-            if (auto self = wp.lock()) {
-              if (res.has_value()) {
-                SL_TRACE(self->logger_,
-                         "Message sent to {} stream with {}",
-                         protocol->protocolName(),
-                         peer_id);
-              } else {
-                SL_TRACE(self->logger_,
-                         "Could not send message to {} stream with {}: {}",
-                         protocol->protocolName(),
-                         peer_id,
-                         res.error());
-                stream->reset();
-              }
-            }
-          });
+    EncodedMessage encode(const std::shared_ptr<ProtocolBase> &protocol,
+                          const T &msg) {
+      auto res = ScaleMessageReadWriter::encode(msg);
+      if (not res) {
+        SL_ERROR(logger_,
+                 "Could not encode {} message: {}",
+                 protocol->protocolName(),
+                 res.error());
+        return nullptr;
+      }
+      return std::move(res.value());
+    }
+
+    /**
+     * Queues the message to the outgoing stream, opening it if needed.
+     * Drops stale messages when the queue is full, skips a message equal to
+     * a queued one.
+     */
+    void enqueue(const PeerId &peer_id,
+                 const std::shared_ptr<ProtocolBase> &protocol,
+                 ProtocolDescr &descr,
+                 const EncodedMessage &msg);
+
+    std::deque<EncodedMessage>::iterator eraseQueued(
+        ProtocolDescr &descr, std::deque<EncodedMessage>::iterator it);
+
+    void clearQueue(ProtocolDescr &descr);
+
+    /**
+     * Takes the next messages of the peer streams to write, in priority order
+     */
+    void startWrites(const PeerId &peer_id,
+                     ProtocolMap &protocols,
+                     Writes &writes);
+
+    /**
+     * Writes messages taken by `startWrites`, must be called without the lock
+     * as streams may complete writes immediately
+     */
+    void write(Writes writes);
+
+    void onWritten(const PeerId &peer_id,
+                   const std::shared_ptr<ProtocolBase> &protocol,
+                   const std::shared_ptr<Stream> &stream);
+
+    QueueMetrics &queueMetrics(const ProtocolBase &protocol) {
+      return queue_metrics_.at(
+          static_cast<size_t>(protocol.outboundPriority()));
     }
 
     template <typename PM, typename F>
@@ -340,27 +368,12 @@ namespace kagome::network {
                             const std::shared_ptr<ProtocolBase> &protocol,
                             ProtocolDescr &descr);
 
-    template <typename T>
-    void updateStream(const PeerId &peer_id,
-                      const std::shared_ptr<ProtocolBase> &protocol,
-                      std::shared_ptr<T> msg) {
-      streams_.exclusiveAccess([&](auto &streams) {
-        forPeerProtocol(peer_id, streams, protocol, [&](auto, auto &descr) {
-          descr.deferred_messages.push_back(
-              [wp(weak_from_this()), peer_id, protocol, msg(std::move(msg))](
-                  std::shared_ptr<Stream> stream) {
-                if (auto self = wp.lock()) {
-                  self->send(peer_id, protocol, stream, msg);
-                }
-              });
-          openOutgoingStream(peer_id, protocol, descr);
-        });
-      });
-    }
-
     std::shared_ptr<ReputationRepository> reputation_repository_;
     log::Logger logger_;
 
+    metrics::RegistryPtr metrics_registry_;
+    std::array<QueueMetrics, kOutboundPriorityCount> queue_metrics_{};
+
     SafeObject<PeerMap> streams_;
   };
 
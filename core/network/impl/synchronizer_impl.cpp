@@ -133,6 +133,8 @@ namespace kagome::network {
     BOOST_ASSERT(main_pool_handler_);
 
     sync_method_ = app_config.syncMethod();
+    import_pipeline_depth_ =
+        std::max<size_t>(app_config.importPipelineDepth(), 1);
 
     // Register metrics
     metrics_registry_->registerGaugeFamily(
@@ -811,69 +813,118 @@ namespace kagome::network {
       state_sync_flow_.emplace(trie_node_db_, block, header);
     }
     state_sync_.emplace(StateSync{
-        peer_id,
-        std::move(handler),
+        .peer = peer_id,
+        .cb = std::move(handler),
     });
     SL_INFO(log_, "Sync of state for block {} has started", block);
     syncState();
   }
 
   void SynchronizerImpl::syncState() {
+    while (state_sync_->requesting.size() < kMaxStateSyncPeers) {
+      auto range = state_sync_flow_->takeRange();
+      if (not range) {
+        return;
+      }
+      auto peer = chooseStatePeer();
+      if (not peer) {
+        state_sync_flow_->releaseRange(*range);
+        return;
+      }
+      syncState(*peer, *range);
+    }
+  }
+
+  std::optional<libp2p::peer::PeerId> SynchronizerImpl::chooseStatePeer()
+      const {
+    auto free = [&](const PeerId &peer) {
+      return not state_sync_->requesting.contains(peer)
+         and not state_sync_->failed.contains(peer);
+    };
+    if (free(state_sync_->peer)) {
+      return state_sync_->peer;
+    }
+    return peer_manager_->peerFinalized(state_sync_flow_->blockInfo().number,
+                                        free);
+  }
+
+  void SynchronizerImpl::syncState(const libp2p::peer::PeerId &peer,
+                                   StateSyncRequestFlow::RangeId range) {
     SL_TRACE(log_,
              "State sync request has sent to {} for block {}",
-             state_sync_->peer,
+             peer,
              state_sync_flow_->blockInfo());
 
-    auto request = state_sync_flow_->nextRequest();
+    auto request = state_sync_flow_->nextRequest(range);
 
     auto protocol = router_->getStateProtocol();
     BOOST_ASSERT_MSG(protocol, "Router did not provide state protocol");
 
-    auto response_handler = [wp{weak_from_this()}](auto &&_res) mutable {
-      auto self = wp.lock();
-      if (not self) {
-        return;
-      }
-      std::unique_lock lock{self->state_sync_mutex_};
-      auto ok = self->syncState(lock, std::move(_res));
-      if (not ok) {
-        auto cb = std::move(self->state_sync_->cb);
-        SL_WARN(self->log_, "State syncing failed with error: {}", ok.error());
-        self->state_sync_.reset();
-        lock.unlock();
-        cb(ok.error());
-      }
-    };
+    state_sync_->requesting.emplace(peer);
+    auto response_handler =
+        [wp{weak_from_this()}, peer, range](auto &&_res) mutable {
+          auto self = wp.lock();
+          if (not self) {
+            return;
+          }
+          std::unique_lock lock{self->state_sync_mutex_};
+          self->syncState(lock, peer, range, std::move(_res));
+        };
 
-    protocol->request(
-        state_sync_->peer, std::move(request), std::move(response_handler));
+    protocol->request(peer, std::move(request), std::move(response_handler));
   }
 
-  outcome::result<void> SynchronizerImpl::syncState(
-      std::unique_lock<std::mutex> &lock,
-      outcome::result<StateResponse> &&_res) {
-    OUTCOME_TRY(res, _res);
-    OUTCOME_TRY(state_sync_flow_->onResponse(res));
-    if (not state_sync_flow_->complete()) {
-      syncState();
-      return outcome::success();
+  void SynchronizerImpl::syncState(std::unique_lock<std::mutex> &lock,
+                                   const libp2p::peer::PeerId &peer,
+                                   StateSyncRequestFlow::RangeId range,
+                                   outcome::result<StateResponse> &&_res) {
+    state_sync_->requesting.erase(peer);
+    outcome::result<void> ok = outcome::success();
+    if (_res) {
+      ok = state_sync_flow_->onResponse(range, _res.value());
+    } else {
+      ok = _res.error();
+    }
+    if (ok and state_sync_flow_->complete()) {
+      ok = trie_pruner_->addNewState(state_sync_flow_->root(),
+                                     storage::trie::StateVersion::V0);
+      if (ok) {
+        auto block = state_sync_flow_->blockInfo();
+        state_sync_flow_.reset();
+        SL_INFO(log_, "State syncing block {} has finished.", block);
+        chain_sub_engine_->notify(
+            primitives::events::ChainEventType::kNewRuntime, block.hash);
+
+        auto cb = std::move(state_sync_->cb);
+        state_sync_.reset();
+
+        // State syncing has completed; Switch to the full syncing
+        afterStateSync();
+        lock.unlock();
+        cb(block);
+        return;
+      }
+    }
+    if (not ok) {
+      SL_WARN(log_,
+              "State sync request to {} failed with error: {}",
+              peer,
+              ok.error());
+      state_sync_flow_->releaseRange(range);
+      state_sync_->failed.emplace(peer);
+      state_sync_->error = ok.error();
+    }
+    // other peers continue with ranges of failed one
+    syncState();
+    if (not state_sync_->requesting.empty()) {
+      return;
     }
-    OUTCOME_TRY(trie_pruner_->addNewState(state_sync_flow_->root(),
-                                          storage::trie::StateVersion::V0));
-    auto block = state_sync_flow_->blockInfo();
-    state_sync_flow_.reset();
-    SL_INFO(log_, "State syncing block {} has finished.", block);
-    chain_sub_engine_->notify(primitives::events::ChainEventType::kNewRuntime,
-                              block.hash);
-
     auto cb = std::move(state_sync_->cb);
+    auto error = state_sync_->error.value();
+    SL_WARN(log_, "State syncing failed with error: {}", error);
     state_sync_.reset();
-
-    // State syncing has completed; Switch to the full syncing
-    afterStateSync();
     lock.unlock();
-    cb(block);
-    return outcome::success();
+    cb(error);
   }
 
   void SynchronizerImpl::post_block_addition(
@@ -897,8 +948,12 @@ namespace kagome::network {
       return;
     }
 
-    bool false_val = false;
-    if (not applying_in_progress_.compare_exchange_strong(false_val, true)) {
+    // headers are appended one by one in fast sync
+    auto max_applying = sync_method_ == application::SyncMethod::Full
+                          ? import_pipeline_depth_
+                          : 1;
+    if (applying_in_progress_.fetch_add(1) >= max_applying) {
+      --applying_in_progress_;
       SL_TRACE(log_, "Applying in progress");
       return;
     }
@@ -906,7 +961,7 @@ namespace kagome::network {
     ::libp2p::common::MovableFinalAction cleanup([weak{weak_from_this()}] {
       if (auto self = weak.lock()) {
         SL_TRACE(self->log_, "End applying");
-        self->applying_in_progress_ = false;
+        --self->applying_in_progress_;
       }
     });
 
@@ -977,6 +1032,15 @@ namespace kagome::network {
           block_executor_->applyBlock(
               std::move(block), block_data.justification, std::move(callback));
 
+          // submit the next block while this one is being applied
+          if (applying_in_progress_ < max_applying) {
+            scheduler_->schedule([wp{weak_from_this()}] {
+              if (auto self = wp.lock()) {
+                self->applyNextBlock();
+              }
+            });
+          }
+
         } else {
           // Fast syncing
           if (not state_sync_) {
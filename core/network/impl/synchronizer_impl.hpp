@@ -93,6 +93,9 @@ namespace kagome::network {
     static constexpr std::chrono::milliseconds kRecentnessDuration =
         std::chrono::seconds(60);
 
+    /// Max number of peers requested for state ranges simultaneously
+    static constexpr size_t kMaxStateSyncPeers = 8;
+
     enum class Error {
       SHUTTING_DOWN = 1,
       EMPTY_RESPONSE,
@@ -222,9 +225,15 @@ namespace kagome::network {
         const libp2p::peer::PeerId &peer_id,
         const BlocksRequest::Fingerprint &fingerprint);
 
+    /// Requests free state ranges from free peers
     void syncState();
-    outcome::result<void> syncState(std::unique_lock<std::mutex> &lock,
-                                    outcome::result<StateResponse> &&_res);
+    void syncState(const libp2p::peer::PeerId &peer,
+                   StateSyncRequestFlow::RangeId range);
+    void syncState(std::unique_lock<std::mutex> &lock,
+                   const libp2p::peer::PeerId &peer,
+                   StateSyncRequestFlow::RangeId range,
+                   outcome::result<StateResponse> &&_res);
+    std::optional<libp2p::peer::PeerId> chooseStatePeer() const;
 
     void fetch(const libp2p::peer::PeerId &peer,
                BlocksRequest request,
@@ -265,6 +274,11 @@ namespace kagome::network {
     struct StateSync {
       libp2p::peer::PeerId peer;
       SyncResultHandler cb;
+      /// peers with request in progress
+      std::unordered_set<libp2p::peer::PeerId> requesting;
+      /// peers excluded after failed request
+      std::unordered_set<libp2p::peer::PeerId> failed;
+      std::optional<std::error_code> error;
     };
 
     mutable std::mutex state_sync_mutex_;
@@ -299,7 +313,9 @@ namespace kagome::network {
 
     std::multimap<primitives::BlockInfo, SyncResultHandler> subscriptions_;
 
-    std::atomic_bool applying_in_progress_ = false;
+    // number of blocks submitted for applying and not applied yet
+    std::atomic_size_t applying_in_progress_ = 0;
+    size_t import_pipeline_depth_ = 1;
     std::atomic_bool asking_blocks_portion_in_progress_ = false;
     std::set<libp2p::peer::PeerId> busy_peers_;
     std::unordered_set<primitives::BlockInfo> load_blocks_;
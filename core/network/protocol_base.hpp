@@ -23,6 +23,18 @@ namespace kagome::network {
 
   using namespace std::string_literals;
 
+  /**
+   * Priority of messages written to peer streams of a protocol, messages of a
+   * class are written to a peer only when more urgent classes are not queued
+   */
+  enum class OutboundPriority : uint8_t {
+    Consensus,
+    Parachain,
+    Sync,
+    Transactions,
+  };
+  constexpr size_t kOutboundPriorityCount = 4;
+
   class ProtocolBase {
    public:
     ProtocolBase() = default;
@@ -34,6 +46,10 @@ namespace kagome::network {
 
     virtual const ProtocolName &protocolName() const = 0;
 
+    virtual OutboundPriority outboundPriority() const {
+      return OutboundPriority::Sync;
+    }
+
     virtual bool start() = 0;
 
     virtual void onIncomingStream(std::shared_ptr<Stream> stream) = 0;
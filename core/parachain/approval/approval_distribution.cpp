@@ -29,6 +29,7 @@
 #include "parachain/approval/approval_distribution_error.hpp"
 #include "parachain/approval/approval_thread_pool.hpp"
 #include "parachain/approval/state.hpp"
+#include "parachain/approval/verify_message.hpp"
 #include "primitives/math.hpp"
 #include "runtime/runtime_api/parachain_host_types.hpp"
 #include "utils/pool_handler_ready_make.hpp"
@@ -44,6 +45,26 @@ static constexpr kagome::network::Tick kTickTooFarInFuture =
 
 namespace {
 
+  /// Calls `f` on destruction unless cancelled
+  class OnDrop {
+   public:
+    explicit OnDrop(std::function<void()> f) : f_{std::move(f)} {}
+    OnDrop(const OnDrop &) = delete;
+    OnDrop &operator=(const OnDrop &) = delete;
+    ~OnDrop() {
+      if (f_) {
+        f_();
+      }
+    }
+
+    void cancel() {
+      f_ = nullptr;
+    }
+
+   private:
+    std::function<void()> f_;
+  };
+
   /// assumes `slot_duration_millis` evenly divided by tick duration.
   kagome::network::Tick slotNumberToTick(uint64_t slot_duration_millis,
                                          kagome::consensus::SlotNumber slot) {
@@ -449,7 +470,8 @@ namespace {
       const kagome::runtime::SessionInfo &config,
       const RelayVRFStory &relay_vrf_story,
       const kagome::parachain::approval::AssignmentCertV2 &assignment,
-      const std::vector<kagome::network::GroupIndex> &backing_groups) {
+      const std::vector<kagome::network::GroupIndex> &backing_groups,
+      std::optional<kagome::network::DelayTranche> verified_tranche) {
     using namespace kagome;
     using parachain::ApprovalDistributionError;
 
@@ -487,8 +509,6 @@ namespace {
       }
     }
 
-    const auto &vrf_output = assignment.vrf.output;
-    const auto &vrf_proof = assignment.vrf.proof;
     const auto first_claimed_core_index = [&]() {
       for (uint32_t i = 0; i < claimed_core_indices.bits.size(); ++i) {
         if (claimed_core_indices.bits[i]) {
@@ -533,20 +553,22 @@ namespace {
             return ApprovalDistributionError::VRF_DELAY_CORE_INDEX_MISMATCH;
           }
 
-          network::DelayTranche tranche;
-          if (SR25519_SIGNATURE_RESULT_OK
-              != sr25519_vrf_verify_and_get_tranche(
-                  validator_public.data(),
-                  vrf_output.data(),
-                  vrf_proof.data(),
-                  config.n_delay_tranches,
-                  config.zeroth_delay_tranche_width,
-                  &relay_vrf_story,
-                  core_index,
-                  &tranche)) {
+          // VRF may be already verified on worker thread
+          if (verified_tranche) {
+            return *verified_tranche;
+          }
+          auto tranche = parachain::approval::verifyDelayAssignment({
+              .assignment_key = validator_public,
+              .vrf = assignment.vrf,
+              .relay_vrf_story = relay_vrf_story,
+              .core_index = core_index,
+              .n_delay_tranches = config.n_delay_tranches,
+              .zeroth_delay_tranche_width = config.zeroth_delay_tranche_width,
+          });
+          if (not tranche) {
             return ApprovalDistributionError::VRF_VERIFY_AND_GET_TRANCHE;
           }
-          return tranche;
+          return *tranche;
         });
   }
 
@@ -1501,19 +1523,8 @@ namespace kagome::parachain {
             SL_TRACE(self->logger_,
                      "Processing pending assignment/approvals.(count={})",
                      it->second.size());
-            for (auto i = it->second.begin(); i != it->second.end(); ++i) {
-              visit_in_place(
-                  i->second,
-                  [&](const network::vstaging::Assignment &assignment) {
-                    self->import_and_circulate_assignment(
-                        i->first,
-                        assignment.indirect_assignment_cert,
-                        assignment.candidate_bitfield);
-                  },
-                  [&](const network::vstaging::IndirectSignedApprovalVoteV2
-                          &approval) {
-                    self->import_and_circulate_approval(i->first, approval);
-                  });
+            for (auto &[peer_id, message] : it->second) {
+              self->verify_and_import(peer_id, std::move(message));
             }
             it = self->pending_known_.erase(it);
           }
@@ -1742,7 +1753,8 @@ namespace kagome::parachain {
   ApprovalDistribution::AssignmentCheckResult
   ApprovalDistribution::check_and_import_assignment(
       const approval::IndirectAssignmentCertV2 &assignment,
-      const scale::BitVec &candidate_indices) {
+      const scale::BitVec &candidate_indices,
+      std::optional<DelayTranche> verified_tranche) {
     BOOST_ASSERT(approval_thread_handler_->isInCurrentThread());
     const auto tick_now = ::tickNow();
 
@@ -1837,7 +1849,8 @@ namespace kagome::parachain {
                                        session_info,
                                        block_entry.relay_vrf_story,
                                        assignment.cert,
-                                       backing_groups);
+                                       backing_groups,
+                                       verified_tranche);
         res.has_value()) {
       const auto current_tranche =
           ::trancheNow(config_.slot_duration_millis, block_entry.slot);
@@ -1903,7 +1916,8 @@ namespace kagome::parachain {
 
   ApprovalDistribution::ApprovalCheckResult
   ApprovalDistribution::check_and_import_approval(
-      const approval::IndirectSignedApprovalVoteV2 &approval) {
+      const approval::IndirectSignedApprovalVoteV2 &approval,
+      bool signature_checked) {
     GET_OPT_VALUE_OR_EXIT(
         block_entry,
         ApprovalCheckResult::Bad,
@@ -1954,8 +1968,29 @@ namespace kagome::parachain {
     }
 
     runtime::SessionInfo &session_info = *opt_session_info;
+    if (approval.payload.ix >= session_info.validators.size()) {
+      return ApprovalCheckResult::Bad;
+    }
     const auto &pubkey = session_info.validators[approval.payload.ix];
 
+    if (not signature_checked) {
+      std::vector<CandidateHash> candidates;
+      for (const auto &[_, candidate_hash] : approved_candidates_info) {
+        candidates.emplace_back(candidate_hash);
+      }
+      if (not approval::verifyApprovalSignature(*crypto_provider_,
+                                                pubkey,
+                                                candidates,
+                                                block_entry.session,
+                                                approval.signature)) {
+        SL_WARN(logger_,
+                "Invalid approval signature.(block hash={}, validator={})",
+                approval.payload.payload.block_hash,
+                approval.payload.ix);
+        return ApprovalCheckResult::Bad;
+      }
+    }
+
     for (const auto &[approval_candidate_index, approved_candidate_hash] :
          approved_candidates_info) {
       GET_OPT_VALUE_OR_EXIT(
@@ -2003,7 +2038,8 @@ namespace kagome::parachain {
   void ApprovalDistribution::import_and_circulate_assignment(
       const MessageSource &source,
       const approval::IndirectAssignmentCertV2 &assignment,
-      const scale::BitVec &claimed_candidate_indices) {
+      const scale::BitVec &claimed_candidate_indices,
+      std::optional<DelayTranche> verified_tranche) {
     BOOST_ASSERT(approval_thread_handler_->isInCurrentThread());
 
     const auto &block_hash = assignment.block_hash;
@@ -2068,8 +2104,8 @@ namespace kagome::parachain {
         }
       }
 
-      switch (
-          check_and_import_assignment(assignment, claimed_candidate_indices)) {
+      switch (check_and_import_assignment(
+          assignment, claimed_candidate_indices, verified_tranche)) {
         case AssignmentCheckResult::Accepted: {
           SL_TRACE(logger_,
                    "Assignment accepted. (peer id={}, block hash={})",
@@ -2174,7 +2210,8 @@ namespace kagome::parachain {
 
   void ApprovalDistribution::import_and_circulate_approval(
       const MessageSource &source,
-      const approval::IndirectSignedApprovalVoteV2 &vote) {
+      const approval::IndirectSignedApprovalVoteV2 &vote,
+      bool signature_checked) {
     BOOST_ASSERT(approval_thread_handler_->isInCurrentThread());
     const auto &block_hash = vote.payload.payload.block_hash;
     const auto validator_index = vote.payload.ix;
@@ -2253,7 +2290,7 @@ namespace kagome::parachain {
         return;
       }
 
-      switch (check_and_import_approval(vote)) {
+      switch (check_and_import_approval(vote, signature_checked)) {
         case ApprovalCheckResult::Accepted: {
           entry.knowledge.insert(message_subject, message_kind);
           if (auto it = entry.known_by.find(peer_id);
@@ -2506,9 +2543,7 @@ namespace kagome::parachain {
               continue;
             }
 
-            import_and_circulate_assignment(peer_id,
-                                            assignment.indirect_assignment_cert,
-                                            assignment.candidate_bitfield);
+            verify_and_import(peer_id, PendingMessage{assignment});
           }
         },
         [&](const network::vstaging::Approvals &approvals) {
@@ -2531,12 +2566,211 @@ namespace kagome::parachain {
               continue;
             }
 
-            import_and_circulate_approval(peer_id, approval_vote);
+            verify_and_import(peer_id, PendingMessage{approval_vote});
           }
         },
         [&](const auto &) { UNREACHABLE; });
   }
 
+  void ApprovalDistribution::verify_and_import(
+      const libp2p::peer::PeerId &peer_id, PendingMessage &&message) {
+    BOOST_ASSERT(approval_thread_handler_->isInCurrentThread());
+    auto key = hasher_->blake2b_256(scale::encode(message).value());
+    const auto index = verification_queue_begin_ + verification_queue_.size();
+    auto &item = verification_queue_.emplace_back(PendingVerification{
+        .peer_id = peer_id,
+        .message = std::move(message),
+        .key = key,
+        .checking = false,
+        .check = std::nullopt,
+    });
+    if (auto cached = checked_messages_.get(key)) {
+      item.check = cached->get();
+    } else if (auto it = checking_.find(key); it != checking_.end()) {
+      // same message from other peer is being checked already
+      item.checking = true;
+      it->second.emplace_back(index);
+    } else if (auto check = prepare_check(item.message)) {
+      item.checking = true;
+      checking_[key].emplace_back(index);
+      auto report = [wself{weak_from_this()},
+                     key](std::optional<MessageCheck> result) {
+        if (auto self = wself.lock()) {
+          self->approval_thread_handler_->execute([wself, key, result] {
+            if (auto self = wself.lock()) {
+              self->on_message_checked(key, result);
+            }
+          });
+        }
+      };
+      // stopped worker pool drops the task, then the message is checked on
+      // import instead of blocking the queue forever
+      auto on_drop =
+          std::make_shared<OnDrop>([report] { report(std::nullopt); });
+      worker_pool_handler_->execute(
+          [report, on_drop, check{std::move(*check)}] {
+            on_drop->cancel();
+            report(check());
+          });
+    }
+    import_checked_messages();
+  }
+
+  std::optional<std::function<ApprovalDistribution::MessageCheck()>>
+  ApprovalDistribution::prepare_check(const PendingMessage &message) {
+    using CheckFn = std::optional<std::function<MessageCheck()>>;
+    // messages without inputs for check are checked or rejected on import
+    return visit_in_place(
+        message,
+        [&](const network::vstaging::Assignment &assignment) -> CheckFn {
+          const auto &cert = assignment.indirect_assignment_cert;
+          // only delay assignments have VRF verified
+          auto delay = if_type<const approval::RelayVRFDelay>(cert.cert.kind);
+          if (not delay) {
+            return std::nullopt;
+          }
+          auto block_entry = storedBlockEntries().get(cert.block_hash);
+          if (not block_entry) {
+            return std::nullopt;
+          }
+          auto info = check_session_info(block_entry->get().parent_hash,
+                                         block_entry->get().session);
+          if (info == nullptr
+              or cert.validator >= info->assignment_keys.size()) {
+            return std::nullopt;
+          }
+          approval::DelayAssignmentCheck check{
+              .assignment_key = info->assignment_keys[cert.validator],
+              .vrf = cert.cert.vrf,
+              .relay_vrf_story = block_entry->get().relay_vrf_story,
+              .core_index = delay->get().core_index,
+              .n_delay_tranches = info->n_delay_tranches,
+              .zeroth_delay_tranche_width = info->zeroth_delay_tranche_width,
+          };
+          return [check] {
+            auto tranche = approval::verifyDelayAssignment(check);
+            return MessageCheck{
+                .valid = tranche.has_value(),
+                .tranche = tranche,
+            };
+          };
+        },
+        [&](const network::vstaging::IndirectSignedApprovalVoteV2 &vote)
+            -> CheckFn {
+          const auto &block_hash = vote.payload.payload.block_hash;
+          auto block_entry = storedBlockEntries().get(block_hash);
+          if (not block_entry) {
+            return std::nullopt;
+          }
+          const auto &candidates_included = block_entry->get().candidates;
+          std::vector<CandidateHash> candidates;
+          auto r = approval::iter_ones(
+              vote.payload.payload.candidate_indices,
+              [&](const auto candidate_index) -> outcome::result<void> {
+                if (candidate_index >= candidates_included.size()) {
+                  return ApprovalDistributionError::
+                      CANDIDATE_INDEX_OUT_OF_BOUNDS;
+                }
+                candidates.emplace_back(
+                    candidates_included[candidate_index].second);
+                return outcome::success();
+              });
+          if (r.has_error()) {
+            return std::nullopt;
+          }
+          const auto session = block_entry->get().session;
+          auto info = check_session_info(block_hash, session);
+          if (info == nullptr or vote.payload.ix >= info->validators.size()) {
+            return std::nullopt;
+          }
+          return [crypto_provider{crypto_provider_},
+                  validator{info->validators[vote.payload.ix]},
+                  candidates{std::move(candidates)},
+                  session,
+                  signature{vote.signature}] {
+            return MessageCheck{
+                .valid = approval::verifyApprovalSignature(*crypto_provider,
+                                                           validator,
+                                                           candidates,
+                                                           session,
+                                                           signature),
+                .tranche = std::nullopt,
+            };
+          };
+        });
+  }
+
+  std::shared_ptr<const ApprovalDistribution::CheckSessionInfo>
+  ApprovalDistribution::check_session_info(const Hash &block_hash,
+                                           SessionIndex session) {
+    if (auto cached = check_sessions_.get(session)) {
+      return cached->get();
+    }
+    auto r = parachain_host_->session_info(block_hash, session);
+    if (not r or not r.value()) {
+      return nullptr;
+    }
+    auto &session_info = *r.value();
+    auto info = std::make_shared<const CheckSessionInfo>(CheckSessionInfo{
+        .validators = std::move(session_info.validators),
+        .assignment_keys = std::move(session_info.assignment_keys),
+        .n_delay_tranches = session_info.n_delay_tranches,
+        .zeroth_delay_tranche_width = session_info.zeroth_delay_tranche_width,
+    });
+    check_sessions_.put(session, info);
+    return info;
+  }
+
+  void ApprovalDistribution::on_message_checked(
+      const Hash &key, std::optional<MessageCheck> result) {
+    BOOST_ASSERT(approval_thread_handler_->isInCurrentThread());
+    if (result) {
+      checked_messages_.put(key, *result);
+    }
+    auto it = checking_.find(key);
+    if (it == checking_.end()) {
+      return;
+    }
+    for (const auto index : it->second) {
+      BOOST_ASSERT(index >= verification_queue_begin_);
+      auto &item = verification_queue_[index - verification_queue_begin_];
+      item.checking = false;
+      item.check = result;
+    }
+    checking_.erase(it);
+    import_checked_messages();
+  }
+
+  void ApprovalDistribution::import_checked_messages() {
+    while (not verification_queue_.empty()
+           and not verification_queue_.front().checking) {
+      auto item = std::move(verification_queue_.front());
+      verification_queue_.pop_front();
+      ++verification_queue_begin_;
+      if (item.check and not item.check->valid) {
+        SL_WARN(logger_,
+                "Got a message with bad signature or VRF from peer. (peer "
+                "id={})",
+                item.peer_id);
+        continue;
+      }
+      visit_in_place(
+          item.message,
+          [&](const network::vstaging::Assignment &assignment) {
+            import_and_circulate_assignment(
+                item.peer_id,
+                assignment.indirect_assignment_cert,
+                assignment.candidate_bitfield,
+                item.check ? item.check->tranche : std::nullopt);
+          },
+          [&](const network::vstaging::IndirectSignedApprovalVoteV2
+                  &approval) {
+            import_and_circulate_approval(
+                item.peer_id, approval, item.check.has_value());
+          });
+    }
+  }
+
   void ApprovalDistribution::runDistributeAssignment(
       const approval::IndirectAssignmentCertV2 &indirect_cert,
       const scale::BitVec &candidate_indices,
@@ -2796,7 +3030,8 @@ namespace kagome::parachain {
                     .ix = validator_index,
                 },
             .signature = std::move(*sig),
-        });
+        },
+        true);
 
     /// TODO(iceseer): store state for the dispute
   }
@@ -2811,9 +3046,8 @@ namespace kagome::parachain {
       logger_->warn("No key pair in store for {}", pubkey);
       return std::nullopt;
     }
-    static std::array<uint8_t, 4ull> kMagic{'A', 'P', 'P', 'R'};
-    auto d = std::make_tuple(kMagic, candidate_hash, session_index);
-    auto payload = scale::encode(std::move(d)).value();
+    auto payload =
+        approval::approvalSigningPayload({candidate_hash}, session_index);
 
     if (auto res = crypto_provider_->sign(key_pair.value(), payload);
         res.has_value()) {
@@ -2839,8 +3073,10 @@ namespace kagome::parachain {
     const auto validator_index = indirect_cert.validator;
 
     if (distribute_assignment) {
-      import_and_circulate_assignment(
-          std::nullopt, indirect_cert, claimed_candidate_indices);
+      import_and_circulate_assignment(std::nullopt,
+                                      indirect_cert,
+                                      claimed_candidate_indices,
+                                      assignment_tranche);
     }
 
     std::optional<ApprovalOutcome> approval_state =
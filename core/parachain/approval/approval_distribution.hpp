@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <deque>
 #include <unordered_set>
 #include <vector>
 
@@ -36,6 +37,7 @@
 #include "parachain/validator/parachain_processor.hpp"
 #include "runtime/runtime_api/parachain_host.hpp"
 #include "runtime/runtime_api/parachain_host_types.hpp"
+#include "utils/lru.hpp"
 #include "utils/safe_object.hpp"
 
 namespace kagome {
@@ -649,18 +651,68 @@ namespace kagome::parachain {
     void imported_block_info(const primitives::BlockHash &block_hash,
                              const primitives::BlockHeader &block_header);
 
+    /// Result of signature or VRF check of remote message
+    struct MessageCheck {
+      bool valid;
+      /// Tranche of `RelayVRFDelay` assignment
+      std::optional<DelayTranche> tranche;
+    };
+
+    /// Remote message waiting for its check, imported in arrival order
+    struct PendingVerification {
+      libp2p::peer::PeerId peer_id;
+      PendingMessage message;
+      Hash key;
+      /// Check is running on worker thread
+      bool checking;
+      /// Empty if message is checked on import
+      std::optional<MessageCheck> check;
+    };
+
+    /// Part of session info read by message checks
+    struct CheckSessionInfo {
+      std::vector<runtime::ValidatorId> validators;
+      std::vector<runtime::AssignmentId> assignment_keys;
+      uint32_t n_delay_tranches;
+      uint32_t zeroth_delay_tranche_width;
+    };
+
+    /// `verified_tranche` is result of VRF check done on worker thread
     AssignmentCheckResult check_and_import_assignment(
         const approval::IndirectAssignmentCertV2 &assignment,
-        const scale::BitVec &candidate_indices);
+        const scale::BitVec &candidate_indices,
+        std::optional<DelayTranche> verified_tranche);
     ApprovalCheckResult check_and_import_approval(
-        const approval::IndirectSignedApprovalVoteV2 &vote);
+        const approval::IndirectSignedApprovalVoteV2 &vote,
+        bool signature_checked);
     void import_and_circulate_assignment(
         const MessageSource &source,
         const approval::IndirectAssignmentCertV2 &assignment,
-        const scale::BitVec &claimed_candidate_indices);
+        const scale::BitVec &claimed_candidate_indices,
+        std::optional<DelayTranche> verified_tranche);
     void import_and_circulate_approval(
         const MessageSource &source,
-        const approval::IndirectSignedApprovalVoteV2 &vote);
+        const approval::IndirectSignedApprovalVoteV2 &vote,
+        bool signature_checked);
+
+    /**
+     * Checks signature or VRF of remote message on worker threads, then
+     * imports checked messages in arrival order.
+     * Message already checked or being checked is not checked again.
+     */
+    void verify_and_import(const libp2p::peer::PeerId &peer_id,
+                           PendingMessage &&message);
+    /// Collects inputs of message check, empty if there is nothing to check
+    std::optional<std::function<MessageCheck()>> prepare_check(
+        const PendingMessage &message);
+    /// Session info for message checks, cached by session
+    std::shared_ptr<const CheckSessionInfo> check_session_info(
+        const Hash &block_hash, SessionIndex session);
+    /// Empty `result` means the check was dropped, message is checked on
+    /// import
+    void on_message_checked(const Hash &key,
+                            std::optional<MessageCheck> result);
+    void import_checked_messages();
 
     // Returns the claimed core bitfield from the assignment cert, the candidate
     // hash and a
@@ -883,6 +935,17 @@ namespace kagome::parachain {
         Hash,
         std::vector<std::pair<libp2p::peer::PeerId, PendingMessage>>>
         pending_known_;
+
+    static constexpr size_t kCheckedMessagesCacheSize = 1 << 14;
+    std::deque<PendingVerification> verification_queue_;
+    /// Arrival index of `verification_queue_` front
+    size_t verification_queue_begin_ = 0;
+    /// Arrival indices of messages waiting for running check, by message hash
+    std::unordered_map<Hash, std::vector<size_t>> checking_;
+    Lru<Hash, MessageCheck> checked_messages_{kCheckedMessagesCacheSize};
+    static constexpr size_t kCheckSessionsCacheSize = 8;
+    Lru<SessionIndex, std::shared_ptr<const CheckSessionInfo>> check_sessions_{
+        kCheckSessionsCacheSize};
     std::unordered_map<libp2p::peer::PeerId, network::View> peer_views_;
     std::map<primitives::BlockNumber, std::unordered_set<primitives::BlockHash>>
         blocks_by_number_;
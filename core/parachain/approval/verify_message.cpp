@@ -0,0 +1,57 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/approval/verify_message.hpp"
+
+#include "crypto/sr25519_provider.hpp"
+#include "scale/scale.hpp"
+
+namespace kagome::parachain::approval {
+  namespace {
+    constexpr std::array<uint8_t, 4> kApprovalMagic{'A', 'P', 'P', 'R'};
+  }  // namespace
+
+  common::Buffer approvalSigningPayload(
+      const std::vector<CandidateHash> &candidates, SessionIndex session) {
+    if (candidates.size() == 1) {
+      return common::Buffer{
+          scale::encode(kApprovalMagic, candidates[0], session).value()};
+    }
+    return common::Buffer{
+        scale::encode(kApprovalMagic, candidates, session).value()};
+  }
+
+  bool verifyApprovalSignature(const crypto::Sr25519Provider &crypto_provider,
+                               const ValidatorId &validator,
+                               const std::vector<CandidateHash> &candidates,
+                               SessionIndex session,
+                               const ValidatorSignature &signature) {
+    if (candidates.empty()) {
+      return false;
+    }
+    auto payload = approvalSigningPayload(candidates, session);
+    auto r = crypto_provider.verify(signature, payload, validator);
+    return r.has_value() and r.value();
+  }
+
+  std::optional<DelayTranche> verifyDelayAssignment(
+      const DelayAssignmentCheck &check) {
+    DelayTranche tranche{};
+    if (SR25519_SIGNATURE_RESULT_OK
+        != sr25519_vrf_verify_and_get_tranche(check.assignment_key.data(),
+                                              check.vrf.output.data(),
+                                              check.vrf.proof.data(),
+                                              check.n_delay_tranches,
+                                              check.zeroth_delay_tranche_width,
+                                              &check.relay_vrf_story,
+                                              check.core_index,
+                                              &tranche)) {
+      return std::nullopt;
+    }
+    return tranche;
+  }
+
+}  // namespace kagome::parachain::approval
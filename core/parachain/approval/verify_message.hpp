@@ -0,0 +1,48 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "common/buffer.hpp"
+#include "crypto/sr25519_types.hpp"
+#include "parachain/approval/approval.hpp"
+#include "runtime/runtime_api/parachain_host_types.hpp"
+
+namespace kagome::crypto {
+  class Sr25519Provider;
+}  // namespace kagome::crypto
+
+namespace kagome::parachain::approval {
+
+  /**
+   * Payload signed by validator approving candidates of one block.
+   * Single candidate payload is the same as of v1 approval vote.
+   */
+  common::Buffer approvalSigningPayload(
+      const std::vector<CandidateHash> &candidates, SessionIndex session);
+
+  /// Verifies signature of approval vote for candidates
+  bool verifyApprovalSignature(const crypto::Sr25519Provider &crypto_provider,
+                               const ValidatorId &validator,
+                               const std::vector<CandidateHash> &candidates,
+                               SessionIndex session,
+                               const ValidatorSignature &signature);
+
+  /// Inputs of `RelayVRFDelay` assignment VRF check
+  struct DelayAssignmentCheck {
+    runtime::AssignmentId assignment_key;
+    crypto::VRFOutput vrf;
+    ::RelayVRFStory relay_vrf_story;
+    CoreIndex core_index;
+    uint32_t n_delay_tranches;
+    uint32_t zeroth_delay_tranche_width;
+  };
+
+  /// Verifies VRF of delay assignment, returns tranche it is valid for
+  std::optional<DelayTranche> verifyDelayAssignment(
+      const DelayAssignmentCheck &check);
+
+}  // namespace kagome::parachain::approval
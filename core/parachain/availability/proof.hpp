@@ -12,22 +12,43 @@
 #include "parachain/availability/erasure_coding_error.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_impl.hpp"
 #include "storage/trie/serialization/polkadot_codec.hpp"
+#include "utils/parallel_for.hpp"
 
 namespace kagome::parachain {
   inline auto makeTrieProofKey(network::ValidatorIndex index) {
     return scale::encode(index).value();
   }
 
+  /// Don't lend a thread for less bytes of chunks
+  constexpr size_t kMinChunkBytesPerThread = 1 << 20;
+
+  /**
+   * Fills proofs of chunks and returns root of their trie.
+   * Chunks are hashed on `pool` when they are large enough, e.g. for large
+   * PoV.
+   */
   inline storage::trie::RootHash makeTrieProof(
-      std::vector<network::ErasureChunk> &chunks) {
+      std::vector<network::ErasureChunk> &chunks, const ThreadPool &pool) {
     storage::trie::PolkadotCodec codec;
 
-    auto trie = storage::trie::PolkadotTrieImpl::createEmpty();
     for (size_t i = 0; i < chunks.size(); ++i) {
       if (chunks[i].index != i) {
         throw std::logic_error{"ErasureChunk.index is wrong"};
       }
-      trie->put(makeTrieProofKey(i), codec.hash256(chunks[i].chunk)).value();
+    }
+    size_t bytes = 0;
+    for (auto &chunk : chunks) {
+      bytes += chunk.chunk.size();
+    }
+    std::vector<common::Hash256> hashes(chunks.size());
+    parallelFor(pool,
+                chunks.size(),
+                bytes / kMinChunkBytesPerThread,
+                [&](size_t i) { hashes[i] = codec.hash256(chunks[i].chunk); });
+
+    auto trie = storage::trie::PolkadotTrieImpl::createEmpty();
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      trie->put(makeTrieProofKey(i), hashes[i]).value();
     }
 
     using Ptr = const storage::trie::TrieNode *;
@@ -9,6 +9,7 @@
 #include "application/chain_spec.hpp"
 #include "authority_discovery/query/query.hpp"
 #include "blockchain/block_tree.hpp"
+#include "common/worker_thread_pool.hpp"
 #include "network/impl/protocols/protocol_fetch_available_data.hpp"
 #include "network/impl/protocols/protocol_fetch_chunk.hpp"
 #include "network/impl/protocols/protocol_fetch_chunk_obsolete.hpp"
@@ -55,7 +56,8 @@ namespace kagome::parachain {
       std::shared_ptr<AvailabilityStore> av_store,
       std::shared_ptr<authority_discovery::Query> query_audi,
       std::shared_ptr<network::Router> router,
-      std::shared_ptr<network::PeerManager> pm)
+      std::shared_ptr<network::PeerManager> pm,
+      std::shared_ptr<common::WorkerThreadPool> worker_thread_pool)
       : logger_{log::createLogger("Recovery", "parachain")},
         hasher_{std::move(hasher)},
         block_tree_{std::move(block_tree)},
@@ -63,7 +65,8 @@ namespace kagome::parachain {
         av_store_{std::move(av_store)},
         query_audi_{std::move(query_audi)},
         router_{std::move(router)},
-        pm_{std::move(pm)} {
+        pm_{std::move(pm)},
+        worker_thread_pool_{std::move(worker_thread_pool)} {
     // Register metrics
     metrics_registry_->registerCounterFamily(
         fullRecoveriesStartedMetricName, "Total number of started recoveries");
@@ -789,7 +792,7 @@ namespace kagome::parachain {
   outcome::result<void> RecoveryImpl::check(const Active &active,
                                             const AvailableData &data) {
     OUTCOME_TRY(chunks, toChunks(active.chunks_total, data));
-    auto root = makeTrieProof(chunks);
+    auto root = makeTrieProof(chunks, *worker_thread_pool_);
     if (root != active.erasure_encoding_root) {
       return ErasureCodingRootError::MISMATCH;
     }
@@ -28,6 +28,10 @@ namespace kagome::blockchain {
   class BlockTree;
 }
 
+namespace kagome::common {
+  class WorkerThreadPool;
+}  // namespace kagome::common
+
 namespace kagome::crypto {
   class Hasher;
 }
@@ -56,7 +60,8 @@ namespace kagome::parachain {
                  std::shared_ptr<AvailabilityStore> av_store,
                  std::shared_ptr<authority_discovery::Query> query_audi,
                  std::shared_ptr<network::Router> router,
-                 std::shared_ptr<network::PeerManager> pm);
+                 std::shared_ptr<network::PeerManager> pm,
+                 std::shared_ptr<common::WorkerThreadPool> worker_thread_pool);
 
     void recover(const HashedCandidateReceipt &hashed_receipt,
                  SessionIndex session_index,
@@ -132,6 +137,8 @@ namespace kagome::parachain {
     std::shared_ptr<authority_discovery::Query> query_audi_;
     std::shared_ptr<network::Router> router_;
     std::shared_ptr<network::PeerManager> pm_;
+    // lends threads to hash chunks of large PoV
+    std::shared_ptr<common::WorkerThreadPool> worker_thread_pool_;
 
     std::mutex mutex_;
     std::default_random_engine random_;
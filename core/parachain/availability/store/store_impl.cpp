@@ -6,110 +6,240 @@
 
 #include "parachain/availability/store/store_impl.hpp"
 
+#include <boost/endian/conversion.hpp>
+
+#include "scale/scale.hpp"
+#include "storage/database_error.hpp"
+#include "storage/map_prefix/prefix.hpp"
+
 namespace kagome::parachain {
-  bool AvailabilityStoreImpl::hasChunk(const CandidateHash &candidate_hash,
-                                       ValidatorIndex index) const {
-    return state_.sharedAccess([&](const auto &state) {
-      auto it = state.per_candidate_.find(candidate_hash);
-      if (it == state.per_candidate_.end()) {
+  namespace {
+    using common::Buffer;
+    using common::BufferView;
+
+    // key prefixes in the availability space
+    constexpr uint8_t kChunkPrefix = 'c';
+    constexpr uint8_t kPovPrefix = 'p';
+    constexpr uint8_t kDataPrefix = 'd';
+    /// relay parent and candidate hash
+    constexpr uint8_t kCandidatePrefix = 'r';
+    /// relay parent, value is time of first store
+    constexpr uint8_t kStoredAtPrefix = 's';
+    /// time of first store and relay parent, ordered by time
+    constexpr uint8_t kPrunePrefix = 't';
+
+    Buffer key(uint8_t prefix, BufferView hash) {
+      return Buffer{}.putUint8(prefix).put(hash);
+    }
+
+    Buffer chunkKey(const CandidateHash &candidate_hash, ChunkIndex index) {
+      return key(kChunkPrefix, candidate_hash).putUint32(index);
+    }
+
+    Buffer pruneKey(uint64_t time, const network::RelayHash &relay_parent) {
+      return Buffer{}.putUint8(kPrunePrefix).putUint64(time).put(relay_parent);
+    }
+
+    bool contains(const storage::BufferStorage &db,
+                  const log::Logger &logger,
+                  const Buffer &key) {
+      auto r = db.contains(key);
+      if (not r) {
+        SL_WARN(logger, "contains({}) failed: {}", key, r.error());
         return false;
       }
-      return it->second.chunks.count(index) != 0;
+      return r.value();
+    }
+
+    template <typename T>
+    std::optional<T> load(const storage::BufferStorage &db,
+                          const log::Logger &logger,
+                          const Buffer &key) {
+      auto r = db.tryGet(key);
+      if (not r) {
+        SL_WARN(logger, "get({}) failed: {}", key, r.error());
+        return std::nullopt;
+      }
+      if (not r.value()) {
+        return std::nullopt;
+      }
+      auto decoded = scale::decode<T>(*r.value());
+      if (not decoded) {
+        SL_WARN(logger, "decode({}) failed: {}", key, decoded.error());
+        return std::nullopt;
+      }
+      return std::move(decoded.value());
+    }
+
+    template <typename T>
+    outcome::result<void> save(storage::BufferBatch &batch,
+                               const Buffer &key,
+                               const T &value) {
+      OUTCOME_TRY(encoded, scale::encode(value));
+      return batch.put(key, Buffer{std::move(encoded)});
+    }
+  }  // namespace
+
+  AvailabilityStoreImpl::AvailabilityStoreImpl(
+      std::shared_ptr<storage::SpacedStorage> storage,
+      std::shared_ptr<clock::SystemClock> clock)
+      : db_{storage->getSpace(storage::Space::kAvailabilityStorage)},
+        clock_{std::move(clock)} {
+    BOOST_ASSERT(db_ != nullptr);
+    BOOST_ASSERT(clock_ != nullptr);
+  }
+
+  AvailabilityStoreImpl::PerCandidate &AvailabilityStoreImpl::hot(
+      State &state, const CandidateHash &candidate_hash) {
+    if (auto candidate = state.hot_.get(candidate_hash)) {
+      return candidate->get();
+    }
+    return state.hot_.put(candidate_hash, {});
+  }
+
+  bool AvailabilityStoreImpl::hasChunk(const CandidateHash &candidate_hash,
+                                       ValidatorIndex index) const {
+    auto cached = state_.exclusiveAccess([&](State &state) {
+      auto candidate = state.hot_.get(candidate_hash);
+      return candidate and candidate->get().chunks.contains(index);
     });
+    return cached or contains(*db_, logger, chunkKey(candidate_hash, index));
   }
 
   bool AvailabilityStoreImpl::hasPov(
       const CandidateHash &candidate_hash) const {
-    return state_.sharedAccess([&](const auto &state) {
-      auto it = state.per_candidate_.find(candidate_hash);
-      if (it == state.per_candidate_.end()) {
-        return false;
-      }
-      return it->second.pov.has_value();
+    auto cached = state_.exclusiveAccess([&](State &state) {
+      auto candidate = state.hot_.get(candidate_hash);
+      return candidate and candidate->get().pov.has_value();
     });
+    return cached
+        or contains(*db_, logger, key(kPovPrefix, candidate_hash));
   }
 
   bool AvailabilityStoreImpl::hasData(
       const CandidateHash &candidate_hash) const {
-    return state_.sharedAccess([&](const auto &state) {
-      auto it = state.per_candidate_.find(candidate_hash);
-      if (it == state.per_candidate_.end()) {
-        return false;
-      }
-      return it->second.data.has_value();
+    auto cached = state_.exclusiveAccess([&](State &state) {
+      auto candidate = state.hot_.get(candidate_hash);
+      return candidate and candidate->get().data.has_value();
     });
+    return cached
+        or contains(*db_, logger, key(kDataPrefix, candidate_hash));
   }
 
   std::optional<AvailabilityStore::ErasureChunk>
   AvailabilityStoreImpl::getChunk(const CandidateHash &candidate_hash,
                                   ValidatorIndex index) const {
-    return state_.sharedAccess(
-        [&](const auto &state)
-            -> std::optional<AvailabilityStore::ErasureChunk> {
-          auto it = state.per_candidate_.find(candidate_hash);
-          if (it == state.per_candidate_.end()) {
-            return std::nullopt;
-          }
-          auto it2 = it->second.chunks.find(index);
-          if (it2 == it->second.chunks.end()) {
-            return std::nullopt;
+    auto cached = state_.exclusiveAccess(
+        [&](State &state) -> std::optional<ErasureChunk> {
+          if (auto candidate = state.hot_.get(candidate_hash)) {
+            auto &chunks = candidate->get().chunks;
+            if (auto it = chunks.find(index); it != chunks.end()) {
+              return it->second;
+            }
           }
-          return it2->second;
+          return std::nullopt;
         });
+    if (cached) {
+      return cached;
+    }
+    auto chunk =
+        load<ErasureChunk>(*db_, logger, chunkKey(candidate_hash, index));
+    if (chunk) {
+      state_.exclusiveAccess([&](State &state) {
+        hot(state, candidate_hash).chunks.emplace(index, *chunk);
+      });
+    }
+    return chunk;
   }
 
   std::optional<AvailabilityStore::ParachainBlock>
   AvailabilityStoreImpl::getPov(const CandidateHash &candidate_hash) const {
-    return state_.sharedAccess(
-        [&](const auto &state)
-            -> std::optional<AvailabilityStore::ParachainBlock> {
-          auto it = state.per_candidate_.find(candidate_hash);
-          if (it == state.per_candidate_.end()) {
-            return std::nullopt;
+    auto cached = state_.exclusiveAccess(
+        [&](State &state) -> std::optional<ParachainBlock> {
+          if (auto candidate = state.hot_.get(candidate_hash)) {
+            return candidate->get().pov;
           }
-          return it->second.pov;
+          return std::nullopt;
         });
+    if (cached) {
+      return cached;
+    }
+    auto pov =
+        load<ParachainBlock>(*db_, logger, key(kPovPrefix, candidate_hash));
+    if (pov) {
+      state_.exclusiveAccess(
+          [&](State &state) { hot(state, candidate_hash).pov = *pov; });
+    }
+    return pov;
   }
 
   std::optional<AvailabilityStore::AvailableData>
   AvailabilityStoreImpl::getPovAndData(
       const CandidateHash &candidate_hash) const {
-    return state_.sharedAccess(
-        [&](const auto &state)
-            -> std::optional<AvailabilityStore::AvailableData> {
-          auto it = state.per_candidate_.find(candidate_hash);
-          if (it == state.per_candidate_.end()) {
-            return std::nullopt;
+    auto cached = state_.exclusiveAccess(
+        [&](State &state) -> std::optional<AvailableData> {
+          if (auto candidate = state.hot_.get(candidate_hash)) {
+            auto &[_, pov, data] = candidate->get();
+            if (pov and data) {
+              return AvailableData{*pov, *data};
+            }
           }
-          if (not it->second.pov or not it->second.data) {
-            return std::nullopt;
-          }
-          return AvailableData{*it->second.pov, *it->second.data};
+          return std::nullopt;
         });
+    if (cached) {
+      return cached;
+    }
+    auto pov =
+        load<ParachainBlock>(*db_, logger, key(kPovPrefix, candidate_hash));
+    if (not pov) {
+      return std::nullopt;
+    }
+    auto data = load<PersistedValidationData>(
+        *db_, logger, key(kDataPrefix, candidate_hash));
+    if (not data) {
+      return std::nullopt;
+    }
+    state_.exclusiveAccess([&](State &state) {
+      auto &candidate = hot(state, candidate_hash);
+      candidate.pov = *pov;
+      candidate.data = *data;
+    });
+    return AvailableData{std::move(*pov), std::move(*data)};
   }
 
   std::vector<AvailabilityStore::ErasureChunk> AvailabilityStoreImpl::getChunks(
       const CandidateHash &candidate_hash) const {
-    return state_.sharedAccess([&](const auto &state) {
-      std::vector<AvailabilityStore::ErasureChunk> chunks;
-      auto it = state.per_candidate_.find(candidate_hash);
-      if (it != state.per_candidate_.end()) {
-        for (auto &p : it->second.chunks) {
-          chunks.emplace_back(p.second);
-        }
+    std::vector<ErasureChunk> chunks;
+    // all chunks are written to database, cache may have only some of them
+    storage::MapPrefix prefix{key(kChunkPrefix, candidate_hash), db_};
+    auto cursor = prefix.cursor();
+    auto r = cursor->seekFirst();
+    while (r and cursor->isValid()) {
+      auto chunk = scale::decode<ErasureChunk>(*cursor->value());
+      if (not chunk) {
+        SL_WARN(logger,
+                "decode chunk of {} failed: {}",
+                candidate_hash,
+                chunk.error());
+      } else {
+        chunks.emplace_back(std::move(chunk.value()));
       }
-      return chunks;
-    });
+      r = cursor->next();
+    }
+    if (not r) {
+      SL_WARN(logger, "getChunks({}) failed: {}", candidate_hash, r.error());
+    }
+    return chunks;
   }
 
   void AvailabilityStoreImpl::printStoragesLoad() {
     state_.sharedAccess([&](auto &state) {
       SL_TRACE(logger,
                "[Availability store statistics]:"
-               "\n\t-> state.candidates={}"
-               "\n\t-> state.per_candidate={}",
-               state.candidates_.size(),
-               state.per_candidate_.size());
+               "\n\t-> state.relay_parents={}"
+               "\n\t-> state.hot={}",
+               state.relay_parents_.size(),
+               state.hot_.size());
     });
   }
 
@@ -118,9 +248,22 @@ namespace kagome::parachain {
                                         std::vector<ErasureChunk> &&chunks,
                                         const ParachainBlock &pov,
                                         const PersistedValidationData &data) {
-    state_.exclusiveAccess([&](auto &state) {
-      state.candidates_[relay_parent].insert(candidate_hash);
-      auto &candidate_data = state.per_candidate_[candidate_hash];
+    auto r = [&]() -> outcome::result<void> {
+      auto batch = db_->batch();
+      for (auto &chunk : chunks) {
+        OUTCOME_TRY(
+            save(*batch, chunkKey(candidate_hash, chunk.index), chunk));
+      }
+      OUTCOME_TRY(save(*batch, key(kPovPrefix, candidate_hash), pov));
+      OUTCOME_TRY(save(*batch, key(kDataPrefix, candidate_hash), data));
+      OUTCOME_TRY(track(*batch, relay_parent, candidate_hash));
+      return batch->commit();
+    }();
+    if (not r) {
+      SL_WARN(logger, "storeData({}) failed: {}", candidate_hash, r.error());
+    }
+    state_.exclusiveAccess([&](State &state) {
+      auto &candidate_data = hot(state, candidate_hash);
       for (auto &&chunk : std::move(chunks)) {
         candidate_data.chunks[chunk.index] = std::move(chunk);
       }
@@ -132,22 +275,126 @@ namespace kagome::parachain {
   void AvailabilityStoreImpl::putChunk(const network::RelayHash &relay_parent,
                                        const CandidateHash &candidate_hash,
                                        ErasureChunk &&chunk) {
-    state_.exclusiveAccess([&](auto &state) {
-      state.candidates_[relay_parent].insert(candidate_hash);
-      state.per_candidate_[candidate_hash].chunks[chunk.index] =
-          std::move(chunk);
+    auto r = [&]() -> outcome::result<void> {
+      auto batch = db_->batch();
+      OUTCOME_TRY(save(*batch, chunkKey(candidate_hash, chunk.index), chunk));
+      OUTCOME_TRY(track(*batch, relay_parent, candidate_hash));
+      return batch->commit();
+    }();
+    if (not r) {
+      SL_WARN(logger, "putChunk({}) failed: {}", candidate_hash, r.error());
+    }
+    state_.exclusiveAccess([&](State &state) {
+      auto index = chunk.index;
+      hot(state, candidate_hash).chunks[index] = std::move(chunk);
     });
   }
 
-  void AvailabilityStoreImpl::remove(const network::RelayHash &relay_parent) {
-    state_.exclusiveAccess([&](auto &state) {
-      if (auto it = state.candidates_.find(relay_parent);
-          it != state.candidates_.end()) {
-        for (auto const &l : it->second) {
-          state.per_candidate_.erase(l);
-        }
-        state.candidates_.erase(it);
+  outcome::result<void> AvailabilityStoreImpl::track(
+      storage::BufferBatch &batch,
+      const network::RelayHash &relay_parent,
+      const CandidateHash &candidate_hash) {
+    auto candidate_key = key(kCandidatePrefix, relay_parent);
+    candidate_key.put(candidate_hash);
+    OUTCOME_TRY(batch.put(candidate_key, Buffer{}));
+    auto first = state_.exclusiveAccess([&](State &state) {
+      return state.relay_parents_.emplace(relay_parent).second;
+    });
+    auto stored_at_key = key(kStoredAtPrefix, relay_parent);
+    if (first) {
+      OUTCOME_TRY(stored, db_->contains(stored_at_key));
+      if (not stored) {
+        auto now = clock_->nowUint64();
+        Buffer stored_at;
+        stored_at.putUint64(now);
+        OUTCOME_TRY(batch.put(stored_at_key, std::move(stored_at)));
+        OUTCOME_TRY(batch.put(pruneKey(now, relay_parent), Buffer{}));
+      }
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> AvailabilityStoreImpl::removeCandidate(
+      storage::BufferBatch &batch, const CandidateHash &candidate_hash) {
+    storage::MapPrefix prefix{key(kChunkPrefix, candidate_hash), db_};
+    auto cursor = prefix.cursor();
+    OUTCOME_TRY(cursor->seekFirst());
+    while (cursor->isValid()) {
+      OUTCOME_TRY(batch.remove(prefix._key(*cursor->key())));
+      OUTCOME_TRY(cursor->next());
+    }
+    OUTCOME_TRY(batch.remove(key(kPovPrefix, candidate_hash)));
+    OUTCOME_TRY(batch.remove(key(kDataPrefix, candidate_hash)));
+    return outcome::success();
+  }
+
+  outcome::result<void> AvailabilityStoreImpl::removeRelayParent(
+      const network::RelayHash &relay_parent) {
+    auto batch = db_->batch();
+    std::vector<CandidateHash> candidates;
+    storage::MapPrefix prefix{key(kCandidatePrefix, relay_parent), db_};
+    auto cursor = prefix.cursor();
+    OUTCOME_TRY(cursor->seekFirst());
+    while (cursor->isValid()) {
+      auto candidate_key = *cursor->key();
+      OUTCOME_TRY(candidate_hash, CandidateHash::fromSpan(candidate_key));
+      OUTCOME_TRY(removeCandidate(*batch, candidate_hash));
+      OUTCOME_TRY(batch->remove(prefix._key(candidate_key)));
+      candidates.emplace_back(candidate_hash);
+      OUTCOME_TRY(cursor->next());
+    }
+    auto stored_at_key = key(kStoredAtPrefix, relay_parent);
+    OUTCOME_TRY(stored_at, db_->tryGet(stored_at_key));
+    if (stored_at and stored_at->size() == sizeof(uint64_t)) {
+      auto time = boost::endian::load_big_u64(stored_at->data());
+      OUTCOME_TRY(batch->remove(pruneKey(time, relay_parent)));
+    }
+    OUTCOME_TRY(batch->remove(stored_at_key));
+    OUTCOME_TRY(batch->commit());
+
+    state_.exclusiveAccess([&](State &state) {
+      state.relay_parents_.erase(relay_parent);
+      for (auto &candidate_hash : candidates) {
+        state.hot_.erase(candidate_hash);
       }
     });
+    return outcome::success();
+  }
+
+  outcome::result<void> AvailabilityStoreImpl::prune() {
+    auto now = clock_->nowUint64();
+    std::vector<network::RelayHash> expired;
+    storage::MapPrefix prefix{Buffer{}.putUint8(kPrunePrefix), db_};
+    auto cursor = prefix.cursor();
+    OUTCOME_TRY(cursor->seekFirst());
+    while (cursor->isValid()) {
+      auto prune_key = *cursor->key();
+      if (prune_key.size() != sizeof(uint64_t) + sizeof(network::RelayHash)) {
+        return storage::DatabaseError::CORRUPTION;
+      }
+      auto time = boost::endian::load_big_u64(prune_key.data());
+      if (time + kPruneAge.count() > now) {
+        break;
+      }
+      OUTCOME_TRY(relay_parent,
+                  network::RelayHash::fromSpan(
+                      BufferView{prune_key}.subspan(sizeof(uint64_t))));
+      expired.emplace_back(relay_parent);
+      OUTCOME_TRY(cursor->next());
+    }
+    for (auto &relay_parent : expired) {
+      SL_DEBUG(logger, "Prune expired relay parent {}", relay_parent);
+      OUTCOME_TRY(removeRelayParent(relay_parent));
+    }
+    return outcome::success();
+  }
+
+  void AvailabilityStoreImpl::remove(const network::RelayHash &relay_parent) {
+    if (auto r = removeRelayParent(relay_parent); not r) {
+      SL_WARN(logger, "remove({}) failed: {}", relay_parent, r.error());
+    }
+    if (auto r = prune(); not r) {
+      SL_WARN(logger, "prune failed: {}", r.error());
+    }
   }
 }  // namespace kagome::parachain
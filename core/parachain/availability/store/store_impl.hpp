@@ -10,12 +10,28 @@
 
 #include <unordered_map>
 #include <unordered_set>
+#include "clock/clock.hpp"
 #include "log/logger.hpp"
+#include "storage/spaced_storage.hpp"
+#include "utils/lru.hpp"
 #include "utils/safe_object.hpp"
 
 namespace kagome::parachain {
+  /**
+   * Keeps data in the database, so it survives restarts.
+   * Recently used candidates are cached in memory.
+   * Data is removed with its relay parent, data of relay parents which were
+   * not removed (e.g. node was restarted) is pruned after `kPruneAge`.
+   */
   class AvailabilityStoreImpl : public AvailabilityStore {
    public:
+    /// Polkadot keeps finalized availability data for a day
+    static constexpr std::chrono::seconds kPruneAge{std::chrono::hours{25}};
+    /// Number of candidates cached in memory
+    static constexpr size_t kHotCandidates = 32;
+
+    AvailabilityStoreImpl(std::shared_ptr<storage::SpacedStorage> storage,
+                          std::shared_ptr<clock::SystemClock> clock);
     ~AvailabilityStoreImpl() override = default;
 
     bool hasChunk(const CandidateHash &candidate_hash,
@@ -49,12 +65,27 @@ namespace kagome::parachain {
     };
 
     struct State {
-      std::unordered_map<CandidateHash, PerCandidate> per_candidate_{};
-      std::unordered_map<network::RelayHash, std::unordered_set<CandidateHash>>
-          candidates_{};
+      Lru<CandidateHash, PerCandidate> hot_{kHotCandidates};
+      /// relay parents with stored time written to database
+      std::unordered_set<network::RelayHash> relay_parents_{};
     };
 
+    static PerCandidate &hot(State &state, const CandidateHash &candidate_hash);
+
+    /// Adds candidate to relay parent and remembers time of first store
+    outcome::result<void> track(storage::BufferBatch &batch,
+                                const network::RelayHash &relay_parent,
+                                const CandidateHash &candidate_hash);
+    outcome::result<void> removeRelayParent(
+        const network::RelayHash &relay_parent);
+    outcome::result<void> removeCandidate(storage::BufferBatch &batch,
+                                          const CandidateHash &candidate_hash);
+    /// Removes relay parents stored more than `kPruneAge` ago
+    outcome::result<void> prune();
+
     log::Logger logger = log::createLogger("AvailabilityStore", "parachain");
-    SafeObject<State> state_{};
+    std::shared_ptr<storage::BufferStorage> db_;
+    std::shared_ptr<clock::SystemClock> clock_;
+    mutable SafeObject<State> state_{};
   };
 }  // namespace kagome::parachain
@@ -36,6 +36,7 @@
 #include "log/configurator.hpp"
 #include "log/logger.hpp"
 #include "parachain/pvf/kagome_pvf_worker_injector.hpp"
+#include "parachain/pvf/pvf_shared_memory.hpp"
 #include "parachain/pvf/pvf_worker_types.hpp"
 #include "scale/scale.hpp"
 
@@ -280,6 +281,11 @@ namespace kagome::parachain {
     OUTCOME_TRY(input_config, decodeInput<PvfWorkerInputConfig>());
     kagome::log::tuneLoggingSystem(input_config.log_params);
 
+    std::unique_ptr<PvfSharedMemory> memory;
+    if (input_config.shared_memory_fd) {
+      memory = PvfSharedMemory::open(*input_config.shared_memory_fd);
+    }
+
     SL_VERBOSE(logger, "Cache directory: {}", input_config.cache_dir);
     if (not std::filesystem::path{input_config.cache_dir}.is_absolute()) {
       SL_ERROR(
@@ -347,11 +353,20 @@ namespace kagome::parachain {
         BOOST_OUTCOME_TRY(module, factory->loadCompiled(path));
         continue;
       }
-      auto &input_args = std::get<PvfWorkerInputArgs>(input);
       if (not module) {
         SL_ERROR(logger, "PvfWorkerInputCode expected");
         return std::errc::invalid_argument;
       }
+      BufferView input_args;
+      if (auto *shared = std::get_if<PvfWorkerInputSharedArgs>(&input)) {
+        if (not memory) {
+          SL_ERROR(logger, "Shared memory was not configured");
+          return std::errc::invalid_argument;
+        }
+        BOOST_OUTCOME_TRY(input_args, memory->read(shared->size));
+      } else {
+        input_args = std::get<PvfWorkerInputArgs>(input);
+      }
       OUTCOME_TRY(instance, module->instantiate());
 
       OUTCOME_TRY(ctx, runtime::RuntimeContextFactory::stateless(instance));
@@ -360,8 +375,14 @@ namespace kagome::parachain {
           instance->callExportFunction(ctx, "validate_block", input_args));
       OUTCOME_TRY(instance->resetEnvironment());
       OUTCOME_TRY(len, scale::encode<uint32_t>(result.size()));
+      if (memory) {
+        // node reads result from shared memory when receives length
+        OUTCOME_TRY(memory->write(result));
+      }
       std::cout.write((const char *)len.data(), len.size());
-      std::cout.write((const char *)result.data(), result.size());
+      if (not memory) {
+        std::cout.write((const char *)result.data(), result.size());
+      }
       std::cout.flush();
     }
   }
@@ -0,0 +1,110 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/pvf/pvf_shared_memory.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace kagome::parachain {
+  namespace {
+    /// Grow in steps to avoid remapping for slightly larger PoVs
+    constexpr size_t kGrowStep = 1 << 20;
+
+    std::error_code lastError() {
+      return {errno, std::system_category()};
+    }
+  }  // namespace
+
+  outcome::result<std::unique_ptr<PvfSharedMemory>> PvfSharedMemory::create() {
+#ifdef __linux__
+    auto fd = ::memfd_create("kagome-pvf", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd == -1) {
+      return lastError();
+    }
+    std::unique_ptr<PvfSharedMemory> memory{new PvfSharedMemory{fd}};
+    // size is never decreased, so mapped pages stay backed by file
+    if (::ftruncate(fd, kGrowStep) == -1
+        or ::fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK) == -1) {
+      return lastError();
+    }
+    return memory;
+#else
+    return std::errc::not_supported;
+#endif
+  }
+
+  std::unique_ptr<PvfSharedMemory> PvfSharedMemory::open(int fd) {
+    return std::unique_ptr<PvfSharedMemory>{new PvfSharedMemory{fd}};
+  }
+
+  PvfSharedMemory::PvfSharedMemory(int fd) : fd_{fd} {}
+
+  PvfSharedMemory::~PvfSharedMemory() {
+    if (data_ != nullptr) {
+      ::munmap(data_, size_);
+    }
+    ::close(fd_);
+  }
+
+  void PvfSharedMemory::inheritInChild() const {
+    ::fcntl(fd_, F_SETFD, 0);
+  }
+
+  outcome::result<void> PvfSharedMemory::map(size_t size, bool grow) {
+    if (size <= size_) {
+      return outcome::success();
+    }
+    struct stat st {};
+    if (::fstat(fd_, &st) == -1) {
+      return lastError();
+    }
+    auto file_size = static_cast<size_t>(st.st_size);
+    auto map_size = (size + kGrowStep - 1) / kGrowStep * kGrowStep;
+    if (file_size < size) {
+      if (not grow) {
+        return std::errc::invalid_argument;
+      }
+      if (::ftruncate(fd_, static_cast<off_t>(map_size)) == -1) {
+        return lastError();
+      }
+    } else {
+      // don't map more than needed if other side grew file too much
+      map_size = std::min(map_size, file_size);
+    }
+    if (data_ != nullptr) {
+      ::munmap(data_, size_);
+      data_ = nullptr;
+      size_ = 0;
+    }
+    auto data = ::mmap(
+        nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (data == MAP_FAILED) {
+      return lastError();
+    }
+    data_ = static_cast<uint8_t *>(data);
+    size_ = map_size;
+    return outcome::success();
+  }
+
+  outcome::result<void> PvfSharedMemory::write(common::BufferView data) {
+    OUTCOME_TRY(map(data.size(), true));
+    if (not data.empty()) {
+      std::memcpy(data_, data.data(), data.size());
+    }
+    return outcome::success();
+  }
+
+  outcome::result<common::BufferView> PvfSharedMemory::read(size_t size) {
+    OUTCOME_TRY(map(size, false));
+    return common::BufferView{data_, size};
+  }
+}  // namespace kagome::parachain
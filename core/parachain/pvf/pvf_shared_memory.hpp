@@ -0,0 +1,66 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <span>
+
+#include "common/buffer_view.hpp"
+#include "outcome/outcome.hpp"
+
+namespace kagome::parachain {
+  /**
+   * Memory shared by node and PVF worker process (memfd inherited by worker).
+   * Node writes call arguments and worker writes call result in place,
+   * only sizes are sent through pipes.
+   * Node and worker take turns, so no synchronization is needed.
+   * Memfd is sealed against shrinking, so worker can't truncate pages
+   * mapped by node.
+   */
+  class PvfSharedMemory {
+   public:
+    /**
+     * Creates sized and sealed memfd, linux only.
+     * Memfd is close-on-exec, see `inheritInChild`.
+     */
+    static outcome::result<std::unique_ptr<PvfSharedMemory>> create();
+
+    /// Uses memfd inherited from parent process
+    static std::unique_ptr<PvfSharedMemory> open(int fd);
+
+    ~PvfSharedMemory();
+
+    PvfSharedMemory(const PvfSharedMemory &) = delete;
+    PvfSharedMemory &operator=(const PvfSharedMemory &) = delete;
+
+    int fd() const {
+      return fd_;
+    }
+
+    /**
+     * Makes memfd inherited by exec of forked child process.
+     * Called in child between fork and exec, so other processes spawned
+     * by node don't inherit memfd.
+     */
+    void inheritInChild() const;
+
+    /// Grows memory if needed and copies data to it
+    outcome::result<void> write(common::BufferView data);
+
+    /// Memory written by other side
+    outcome::result<common::BufferView> read(size_t size);
+
+   private:
+    explicit PvfSharedMemory(int fd);
+
+    /// Maps at least `size` bytes, growing file if `grow`
+    outcome::result<void> map(size_t size, bool grow);
+
+    int fd_;
+    uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+  };
+}  // namespace kagome::parachain
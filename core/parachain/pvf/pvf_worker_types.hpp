@@ -31,17 +31,28 @@ namespace kagome::parachain {
       const application::AppConfiguration &app_config);
 
   struct PvfWorkerInputConfig {
-    SCALE_TIE(4);
+    SCALE_TIE(5);
 
     RuntimeEngine engine;
     std::string cache_dir;
     std::vector<std::string> log_params;
     bool force_disable_secure_mode;
+    /// inherited memfd for args and results, see PvfSharedMemory
+    std::optional<int32_t> shared_memory_fd;
   };
 
   using PvfWorkerInputCode = std::string;
 
   using PvfWorkerInputArgs = Buffer;
 
-  using PvfWorkerInput = std::variant<PvfWorkerInputCode, PvfWorkerInputArgs>;
+  /// Args of given size were written to shared memory
+  struct PvfWorkerInputSharedArgs {
+    SCALE_TIE(1);
+
+    uint32_t size;
+  };
+
+  using PvfWorkerInput = std::variant<PvfWorkerInputCode,
+                                      PvfWorkerInputArgs,
+                                      PvfWorkerInputSharedArgs>;
 }  // namespace kagome::parachain
@@ -9,12 +9,14 @@
 #include <boost/asio/buffered_read_stream.hpp>
 #include <boost/asio/buffered_write_stream.hpp>
 #include <boost/process.hpp>
+#include <boost/process/extend.hpp>
 #include <libp2p/basic/scheduler.hpp>
 #include <libp2p/common/asio_buffer.hpp>
 #include <qtils/option_take.hpp>
 
 #include "application/app_configuration.hpp"
 #include "common/main_thread_pool.hpp"
+#include "parachain/pvf/pvf_shared_memory.hpp"
 #include "parachain/pvf/pvf_worker_types.hpp"
 #include "utils/get_exe_path.hpp"
 #include "utils/weak_macro.hpp"
@@ -25,11 +27,21 @@ namespace kagome::parachain {
     using lowest_layer_type = AsyncPipe;
   };
 
+  static std::unique_ptr<PvfSharedMemory> createSharedMemory() {
+    auto r = PvfSharedMemory::create();
+    if (not r) {
+      return nullptr;
+    }
+    return std::move(r.value());
+  }
+
   struct ProcessAndPipes : std::enable_shared_from_this<ProcessAndPipes> {
     AsyncPipe pipe_stdin;
     boost::asio::buffered_write_stream<AsyncPipe &> writer;
     AsyncPipe pipe_stdout;
     boost::asio::buffered_read_stream<AsyncPipe &> reader;
+    /// created before process, so process inherits it
+    std::unique_ptr<PvfSharedMemory> memory = createSharedMemory();
     boost::process::child process;
     std::shared_ptr<Buffer> writing = std::make_shared<Buffer>();
     std::shared_ptr<Buffer> reading = std::make_shared<Buffer>();
@@ -44,6 +56,13 @@ namespace kagome::parachain {
               boost::process::args({"pvf-worker"}),
               boost::process::std_out > pipe_stdout,
               boost::process::std_in < pipe_stdin,
+              // only worker inherits memory
+              boost::process::extend::on_exec_setup =
+                  [shared{memory.get()}](auto &) {
+                    if (shared != nullptr) {
+                      shared->inheritInChild();
+                    }
+                  },
           } {}
 
     void write(Buffer data, auto cb) {
@@ -96,6 +115,14 @@ namespace kagome::parachain {
             if (len_res.has_error()) {
               return cb(len_res.error());
             }
+            if (self->memory) {
+              // result was written to shared memory
+              auto result = self->memory->read(len_res.value());
+              if (not result) {
+                return cb(result.error());
+              }
+              return cb(Buffer{result.value()});
+            }
             self->reading->resize(len_res.value());
             boost::asio::async_read(
                 self->reader,
@@ -136,8 +163,12 @@ namespace kagome::parachain {
       }
       auto used = std::make_shared<Used>(*this);
       auto process = std::make_shared<ProcessAndPipes>(*io_context_, exe_);
+      auto config = worker_config_;
+      if (process->memory) {
+        config.shared_memory_fd = process->memory->fd();
+      }
       process->writeScale(
-          worker_config_,
+          config,
           [WEAK_SELF, job{std::move(job)}, used{std::move(used)}, process](
               outcome::result<void> r) mutable {
             WEAK_LOCK(self);
@@ -221,12 +252,23 @@ namespace kagome::parachain {
     };
     *timeout = scheduler_->scheduleWithHandle(
         [cb]() mutable { cb(std::errc::timed_out); }, timeout_);
-    worker.process->writeScale(PvfWorkerInput{job.args},
-                               [cb](outcome::result<void> r) mutable {
-                                 if (not r) {
-                                   return cb(r.error());
-                                 }
-                               });
+    auto on_write = [cb](outcome::result<void> r) mutable {
+      if (not r) {
+        return cb(r.error());
+      }
+    };
+    if (auto &memory = worker.process->memory) {
+      if (auto r = memory->write(job.args); not r) {
+        return cb(r.error());
+      }
+      worker.process->writeScale(
+          PvfWorkerInput{PvfWorkerInputSharedArgs{
+              static_cast<uint32_t>(job.args.size())}},
+          std::move(on_write));
+    } else {
+      worker.process->writeScale(PvfWorkerInput{job.args},
+                                 std::move(on_write));
+    }
     worker.process->read(std::move(cb));
   }
 
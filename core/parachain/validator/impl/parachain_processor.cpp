@@ -141,7 +141,7 @@ namespace kagome::parachain {
       common::MainThreadPool &main_thread_pool,
       std::shared_ptr<crypto::Hasher> hasher,
       std::shared_ptr<network::PeerView> peer_view,
-      common::WorkerThreadPool &worker_thread_pool,
+      std::shared_ptr<common::WorkerThreadPool> worker_thread_pool,
       std::shared_ptr<parachain::BitfieldSigner> bitfield_signer,
       std::shared_ptr<parachain::PvfPrecheck> pvf_precheck,
       std::shared_ptr<parachain::BitfieldStore> bitfield_store,
@@ -183,7 +183,8 @@ namespace kagome::parachain {
         slots_util_(std::move(slots_util)),
         babe_config_repo_(std::move(babe_config_repo)),
         chain_sub_{std::move(chain_sub_engine)},
-        worker_pool_handler_{worker_thread_pool.handler(app_state_manager)},
+        worker_pool_handler_{worker_thread_pool->handler(app_state_manager)},
+        worker_thread_pool_{std::move(worker_thread_pool)},
         prospective_parachains_{std::move(prospective_parachains)},
         block_tree_{std::move(block_tree)} {
     BOOST_ASSERT(pm_);
@@ -3305,9 +3306,9 @@ namespace kagome::parachain {
     if (auto chunk =
             av_store_->getChunk(request.candidate, request.chunk_index)) {
       return network::Chunk{
-          .data = chunk->chunk,
+          .data = std::move(chunk->chunk),
           .chunk_index = request.chunk_index,
-          .proof = chunk->proof,
+          .proof = std::move(chunk->proof),
       };
     }
     return network::FetchChunkResponse{};
@@ -5023,7 +5024,7 @@ namespace kagome::parachain {
       const network::CandidateHash &candidate_hash,
       const network::ParachainBlock &pov,
       const runtime::PersistedValidationData &data) {
-    makeTrieProof(chunks);
+    makeTrieProof(chunks, *worker_thread_pool_);
     /// TODO(iceseer): remove copy
     av_store_->storeData(
         relay_parent, candidate_hash, std::move(chunks), pov, data);
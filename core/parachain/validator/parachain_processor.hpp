@@ -153,7 +153,7 @@ namespace kagome::parachain {
         common::MainThreadPool &main_thread_pool,
         std::shared_ptr<crypto::Hasher> hasher,
         std::shared_ptr<network::PeerView> peer_view,
-        common::WorkerThreadPool &worker_thread_pool,
+        std::shared_ptr<common::WorkerThreadPool> worker_thread_pool,
         std::shared_ptr<parachain::BitfieldSigner> bitfield_signer,
         std::shared_ptr<parachain::PvfPrecheck> pvf_precheck,
         std::shared_ptr<parachain::BitfieldStore> bitfield_store,
@@ -1156,6 +1156,8 @@ namespace kagome::parachain {
 
     primitives::events::ChainSub chain_sub_;
     std::shared_ptr<PoolHandler> worker_pool_handler_;
+    // lends threads to hash chunks of large PoV
+    std::shared_ptr<common::WorkerThreadPool> worker_thread_pool_;
     std::default_random_engine random_;
     std::shared_ptr<ProspectiveParachains> prospective_parachains_;
     Candidates candidates_;
@@ -0,0 +1,187 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/host_api_profiler.hpp"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+#include "metrics/metrics.hpp"
+
+namespace kagome::runtime {
+
+  namespace {
+    constexpr std::array<std::string_view, kHostMethodCount> kHostMethodNames{
+#define REGISTER_HOST_METHOD(Ret, name, ...) #name,
+        REGISTER_HOST_METHODS
+#undef REGISTER_HOST_METHOD
+    };
+
+    constexpr auto kCallsMetric = "kagome_host_api_calls_total";
+    constexpr auto kTimeMetric = "kagome_host_api_time_seconds_total";
+    constexpr auto kBytesMetric = "kagome_host_api_bytes_total";
+    constexpr std::string_view kUnknownCall = "unknown";
+
+    struct Counters {
+      metrics::Counter *calls;
+      metrics::Counter *seconds;
+      metrics::Counter *bytes;
+    };
+
+    using Key = std::pair<std::string, HostMethod>;
+
+    /// stats of all threads, updated when runtime calls end
+    struct Totals {
+      std::mutex mutex;
+      metrics::RegistryPtr registry;
+      std::map<Key, HostApiProfiler::Stats> stats;
+      std::map<Key, Counters> counters;
+
+      void add(std::string_view runtime_call,
+               HostMethod method,
+               const HostApiProfiler::Stats &delta) {
+        Key key{runtime_call, method};
+        auto &total = stats[key];
+        total.calls += delta.calls;
+        total.nanoseconds += delta.nanoseconds;
+        total.bytes += delta.bytes;
+
+        auto it = counters.find(key);
+        if (it == counters.end()) {
+          std::map<std::string, std::string> labels{
+              {"runtime_call", key.first},
+              {"function", std::string{hostMethodName(method)}},
+          };
+          it = counters
+                   .emplace(std::move(key),
+                            Counters{
+                                registry->registerCounterMetric(kCallsMetric,
+                                                                labels),
+                                registry->registerCounterMetric(kTimeMetric,
+                                                                labels),
+                                registry->registerCounterMetric(kBytesMetric,
+                                                                labels),
+                            })
+                   .first;
+        }
+        it->second.calls->inc(delta.calls);
+        it->second.seconds->inc(delta.nanoseconds / 1e9);
+        it->second.bytes->inc(delta.bytes);
+      }
+    };
+
+    Totals &totals() {
+      static Totals totals;
+      return totals;
+    }
+  }  // namespace
+
+  struct HostApiProfiler::Frame {
+    std::string runtime_call;
+    std::array<Stats, kHostMethodCount> stats{};
+  };
+
+  namespace {
+    thread_local HostApiProfiler::Frame *current_frame = nullptr;
+  }  // namespace
+
+  std::atomic_bool HostApiProfiler::enabled_ = false;
+
+  std::string_view hostMethodName(HostMethod method) {
+    return kHostMethodNames.at(static_cast<size_t>(method));
+  }
+
+  void HostApiProfiler::enable(bool enabled) {
+    if (enabled) {
+      auto &state = totals();
+      std::lock_guard lock{state.mutex};
+      if (state.registry == nullptr) {
+        state.registry = metrics::createRegistry();
+        state.registry->registerCounterFamily(
+            kCallsMetric, "Number of host function calls");
+        state.registry->registerCounterFamily(
+            kTimeMetric, "Time spent in host functions, in seconds");
+        state.registry->registerCounterFamily(
+            kBytesMetric,
+            "Bytes passed to and returned from host functions");
+      }
+    }
+    enabled_.store(enabled, std::memory_order_relaxed);
+  }
+
+  std::vector<HostApiProfiler::Entry> HostApiProfiler::snapshot() {
+    std::vector<Entry> entries;
+    {
+      auto &state = totals();
+      std::lock_guard lock{state.mutex};
+      for (auto &[key, stats] : state.stats) {
+        entries.emplace_back(
+            Entry{key.first, hostMethodName(key.second), stats});
+      }
+    }
+    std::ranges::sort(entries, [](const Entry &l, const Entry &r) {
+      return l.stats.nanoseconds > r.stats.nanoseconds;
+    });
+    return entries;
+  }
+
+  void HostApiProfiler::reset() {
+    auto &state = totals();
+    std::lock_guard lock{state.mutex};
+    state.stats.clear();
+  }
+
+  HostApiProfiler::CallScope::CallScope(std::string_view runtime_call) {
+    if (not enabled()) [[likely]] {
+      return;
+    }
+    frame_ = std::make_unique<Frame>();
+    frame_->runtime_call = runtime_call;
+    parent_ = current_frame;
+    current_frame = frame_.get();
+  }
+
+  HostApiProfiler::CallScope::~CallScope() {
+    if (frame_ == nullptr) {
+      return;
+    }
+    current_frame = parent_;
+    auto &state = totals();
+    std::lock_guard lock{state.mutex};
+    for (size_t i = 0; i < kHostMethodCount; ++i) {
+      if (frame_->stats[i].calls != 0) {
+        state.add(frame_->runtime_call,
+                  static_cast<HostMethod>(i),
+                  frame_->stats[i]);
+      }
+    }
+  }
+
+  HostApiProfiler::Measure::~Measure() {
+    Stats delta{
+        .calls = 1,
+        .nanoseconds = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start_)
+                .count()),
+        .bytes = bytes_,
+    };
+    if (current_frame != nullptr) [[likely]] {
+      auto &stats = current_frame->stats[static_cast<size_t>(method_)];
+      stats.calls += delta.calls;
+      stats.nanoseconds += delta.nanoseconds;
+      stats.bytes += delta.bytes;
+      return;
+    }
+    // profiler was enabled during the runtime call, or the instance is not
+    // borrowed from the pool
+    auto &state = totals();
+    std::lock_guard lock{state.mutex};
+    state.add(kUnknownCall, method_, delta);
+  }
+
+}  // namespace kagome::runtime
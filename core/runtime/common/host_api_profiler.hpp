@@ -0,0 +1,151 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "runtime/common/register_host_api.hpp"
+#include "runtime/ptr_size.hpp"
+
+namespace kagome::runtime {
+
+  /// Host methods in the order of REGISTER_HOST_METHODS
+  enum class HostMethod : uint16_t {
+#define REGISTER_HOST_METHOD(Ret, name, ...) name,
+    REGISTER_HOST_METHODS
+#undef REGISTER_HOST_METHOD
+  };
+
+  constexpr size_t kHostMethodCount = [] {
+    size_t count = 0;
+#define REGISTER_HOST_METHOD(Ret, name, ...) ++count;
+    REGISTER_HOST_METHODS
+#undef REGISTER_HOST_METHOD
+    return count;
+  }();
+
+  std::string_view hostMethodName(HostMethod method);
+
+  /**
+   * Counts calls, time and bytes passed through pointer-size arguments and
+   * results per host method and per runtime call (exported function).
+   * Stats of a runtime call are accumulated thread-locally and flushed to
+   * metrics when the call ends. When disabled, host calls only check a flag.
+   */
+  class HostApiProfiler {
+   public:
+    struct Stats {
+      uint64_t calls = 0;
+      uint64_t nanoseconds = 0;
+      uint64_t bytes = 0;
+    };
+
+    struct Entry {
+      std::string runtime_call;
+      std::string_view method;
+      Stats stats;
+    };
+
+    /// stats of host calls made by a runtime call
+    struct Frame;
+
+    /// set once at startup from the configuration, before runtimes run
+    static void enable(bool enabled);
+
+    static bool enabled() {
+      return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return stats accumulated since the last reset, sorted by time spent
+     */
+    static std::vector<Entry> snapshot();
+
+    static void reset();
+
+    /**
+     * Attributes host calls of the current thread to the runtime call until
+     * destroyed, nested runtime calls are attributed separately
+     */
+    class CallScope {
+     public:
+      explicit CallScope(std::string_view runtime_call);
+      ~CallScope();
+
+      CallScope(const CallScope &) = delete;
+      CallScope &operator=(const CallScope &) = delete;
+
+     private:
+      std::unique_ptr<Frame> frame_;
+      Frame *parent_ = nullptr;
+    };
+
+    /**
+     * Records a single host call when destroyed
+     */
+    class Measure {
+     public:
+      Measure(HostMethod method, uint64_t bytes)
+          : method_{method},
+            bytes_{bytes},
+            start_{std::chrono::steady_clock::now()} {}
+      ~Measure();
+
+      Measure(const Measure &) = delete;
+      Measure &operator=(const Measure &) = delete;
+
+      void addBytes(uint64_t bytes) {
+        bytes_ += bytes;
+      }
+
+     private:
+      HostMethod method_;
+      uint64_t bytes_;
+      std::chrono::steady_clock::time_point start_;
+    };
+
+   private:
+    static std::atomic_bool enabled_;
+  };
+
+  /// size of the buffer if the value is a pointer-size
+  template <typename T>
+  uint64_t hostArgBytes(T value) {
+    // numbers passed as i64 (debug prints, offchain timestamps) are counted
+    // too, they are rare outside of offchain workers
+    if constexpr (sizeof(T) == sizeof(WasmSpan)) {
+      return PtrSize{static_cast<WasmSpan>(value)}.size;
+    } else {
+      return 0;
+    }
+  }
+
+  /**
+   * Calls the host method, profiling it when the profiler is enabled
+   */
+  template <HostMethod method, typename Ret, typename F, typename... Args>
+  Ret profiledHostCall(const F &f, Args... args) {
+    if (not HostApiProfiler::enabled()) [[likely]] {
+      return f(args...);
+    }
+    HostApiProfiler::Measure measure{method, (hostArgBytes(args) + ... + 0)};
+    if constexpr (std::is_void_v<Ret>) {
+      f(args...);
+    } else {
+      Ret result = f(args...);
+      measure.addBytes(hostArgBytes(result));
+      return result;
+    }
+  }
+
+}  // namespace kagome::runtime
@@ -6,7 +6,9 @@
 
 #include "runtime/module_instance.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <limits>
 
 #include "common/int_serialization.hpp"
 #include "runtime/memory_provider.hpp"
@@ -29,6 +31,21 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::runtime, ModuleInstance::Error, e) {
 
 namespace kagome::runtime {
   outcome::result<void> ModuleInstance::resetMemory() {
+    if (not memory_snapshot_) {
+      BOOST_OUTCOME_TRY(memory_snapshot_, makeMemorySnapshot());
+    }
+    auto &memory_provider = getEnvironment().memory_provider;
+    OUTCOME_TRY(const_cast<MemoryProvider &>(*memory_provider)
+                    .resetMemory(MemoryConfig{memory_snapshot_->heap_base}));
+    if (not memory_snapshot_->data.empty()) {
+      auto &memory = memory_provider->getCurrentMemory()->get();
+      memory.storeBuffer(memory_snapshot_->offset, memory_snapshot_->data);
+    }
+    return outcome::success();
+  }
+
+  outcome::result<ModuleInstance::MemorySnapshot>
+  ModuleInstance::makeMemorySnapshot() const {
     static auto log = log::createLogger("RuntimeEnvironmentFactory", "runtime");
 
     OUTCOME_TRY(opt_heap_base, getGlobal("__heap_base"));
@@ -38,15 +55,13 @@ namespace kagome::runtime {
       return ModuleInstance::Error::ABSENT_HEAP_BASE;
     }
     uint32_t heap_base = boost::get<int32_t>(*opt_heap_base);
-    auto &memory_provider = getEnvironment().memory_provider;
-    OUTCOME_TRY(const_cast<MemoryProvider &>(*memory_provider)
-                    .resetMemory(MemoryConfig{heap_base}));
-    auto &memory = memory_provider->getCurrentMemory()->get();
 
+    size_t min_data_segment_offset = std::numeric_limits<size_t>::max();
     size_t max_data_segment_end = 0;
     size_t segments_num = 0;
     forDataSegment([&](ModuleInstance::SegmentOffset offset,
                        ModuleInstance::SegmentData segment) {
+      min_data_segment_offset = std::min(min_data_segment_offset, offset);
       max_data_segment_end =
           std::max(max_data_segment_end, offset + segment.size());
       segments_num++;
@@ -61,11 +76,17 @@ namespace kagome::runtime {
           "__heap_base too low, allocations will overwrite wasm data segments");
     }
 
-    forDataSegment([&](auto offset, auto segment) {
-      memory.storeBuffer(offset, segment);
-    });
-
-    return outcome::success();
+    MemorySnapshot snapshot{heap_base, 0, {}};
+    if (segments_num != 0 and max_data_segment_end > min_data_segment_offset) {
+      // gaps between segments are zero, as in a new instance
+      snapshot.offset = min_data_segment_offset;
+      snapshot.data.resize(max_data_segment_end - min_data_segment_offset);
+      forDataSegment([&](auto offset, auto segment) {
+        std::ranges::copy(segment,
+                          snapshot.data.begin() + (offset - snapshot.offset));
+      });
+    }
+    return snapshot;
   }
 
   outcome::result<void> ModuleInstance::stateless() {
@@ -72,27 +72,44 @@ namespace kagome::runtime {
     KAGOME_PROFILE_END(code_retrieval)
 
     KAGOME_PROFILE_START(module_retrieval)
-    Item item;
-    OUTCOME_TRY(SAFE_UNIQUE(cache_)->outcome::result<void> {
+    return codeAtState(state, storage_state);
+  }
+
+  outcome::result<void> ModuleRepositoryImpl::precompileAt(
+      const storage::trie::RootHash &state) {
+    OUTCOME_TRY(item, codeAtState(state, state));
+    return runtime_instances_pool_->precompile(
+        item.hash, [&] { return item.code; }, {item.config});
+  }
+
+  outcome::result<ModuleRepositoryImpl::Item>
+  ModuleRepositoryImpl::codeAtState(
+      const storage::trie::RootHash &state,
+      const storage::trie::RootHash &storage_state) {
+    auto cached = SAFE_UNIQUE(cache_)->std::optional<Item> {
       if (auto r = cache_.get(state)) {
-        item = r->get();
-      } else {
-        auto code_res = code_provider_->getCodeAt(state);
-        if (not code_res) {
-          code_res = code_provider_->getCodeAt(storage_state);
-        }
-        auto &code_zstd = *code_res.value();
-        item.hash = hasher_->blake2b_256(code_zstd);
-        OUTCOME_TRY(code, uncompressCodeIfNeeded(code_zstd));
-        item.code = std::make_shared<Buffer>(code);
-        BOOST_OUTCOME_TRY(item.version, readEmbeddedVersion(code));
-        OUTCOME_TRY(batch, trie_storage_->getEphemeralBatchAt(storage_state));
-        BOOST_OUTCOME_TRY(item.config.heap_alloc_strategy,
-                          heapAllocStrategyHeappagesDefault(*batch));
-        cache_.put(state, item);
+        return r->get();
       }
-      return outcome::success();
-    });
+      return std::nullopt;
+    };
+    if (cached) {
+      return std::move(*cached);
+    }
+    // decompression and version reading are slow, don't block other states
+    Item item;
+    auto code_res = code_provider_->getCodeAt(state);
+    if (not code_res) {
+      code_res = code_provider_->getCodeAt(storage_state);
+    }
+    auto &code_zstd = *code_res.value();
+    item.hash = hasher_->blake2b_256(code_zstd);
+    OUTCOME_TRY(code, uncompressCodeIfNeeded(code_zstd));
+    item.code = std::make_shared<Buffer>(code);
+    BOOST_OUTCOME_TRY(item.version, readEmbeddedVersion(code));
+    OUTCOME_TRY(batch, trie_storage_->getEphemeralBatchAt(storage_state));
+    BOOST_OUTCOME_TRY(item.config.heap_alloc_strategy,
+                      heapAllocStrategyHeappagesDefault(*batch));
+    SAFE_UNIQUE(cache_) { cache_.put(state, item); };
     return item;
   }
 }  // namespace kagome::runtime
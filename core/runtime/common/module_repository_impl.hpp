@@ -52,6 +52,9 @@ namespace kagome::runtime {
     outcome::result<std::optional<primitives::Version>> embeddedVersion(
         const primitives::BlockHash &block_hash) override;
 
+    outcome::result<void> precompileAt(
+        const storage::trie::RootHash &state) override;
+
    private:
     struct Item {
       common::Hash256 hash;
@@ -63,6 +66,11 @@ namespace kagome::runtime {
     outcome::result<Item> codeAt(const primitives::BlockInfo &block,
                                  const storage::trie::RootHash &storage_state);
 
+    /// code set in the \arg state, cached by the state
+    outcome::result<Item> codeAtState(
+        const storage::trie::RootHash &state,
+        const storage::trie::RootHash &storage_state);
+
     std::shared_ptr<RuntimeInstancesPool> runtime_instances_pool_;
     std::shared_ptr<crypto::Hasher> hasher_;
     std::shared_ptr<blockchain::BlockHeaderRepository> block_header_repository_;
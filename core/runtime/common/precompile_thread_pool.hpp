@@ -0,0 +1,21 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "utils/thread_pool.hpp"
+#include "utils/watchdog.hpp"
+
+namespace kagome::runtime {
+  /// Thread compiling upcoming runtimes in background
+  class PrecompileThreadPool final : public ThreadPool {
+   public:
+    PrecompileThreadPool(std::shared_ptr<Watchdog> watchdog, Inject, ...)
+        : ThreadPool(std::move(watchdog), "rt_precompile", 1, std::nullopt) {}
+
+    PrecompileThreadPool(TestThreadPool test) : ThreadPool{std::move(test)} {}
+  };
+}  // namespace kagome::runtime
@@ -8,6 +8,7 @@
 
 #include "application/app_configuration.hpp"
 #include "common/monadic_utils.hpp"
+#include "runtime/common/host_api_profiler.hpp"
 #include "runtime/common/uncompress_code_if_needed.hpp"
 #include "runtime/instance_environment.hpp"
 #include "runtime/module.hpp"
@@ -49,6 +50,7 @@ namespace kagome::runtime {
         RuntimeContext &ctx,
         std::string_view name,
         common::BufferView encoded_args) const override {
+      HostApiProfiler::CallScope profiler_scope{name};
       return instance_->callExportFunction(ctx, name, encoded_args);
     }
 
@@ -69,6 +71,10 @@ namespace kagome::runtime {
       return instance_->resetEnvironment();
     }
 
+    outcome::result<void> resetMemory() override {
+      return instance_->resetMemory();
+    }
+
     outcome::result<void> stateless() override {
       return instance_->stateless();
     }
@@ -61,7 +61,7 @@ namespace kagome::runtime {
     outcome::result<void> precompile(
         const CodeHash &code_hash,
         const GetCode &get_code,
-        const RuntimeContext::ContextParams &config);
+        const RuntimeContext::ContextParams &config) override;
 
     std::optional<std::shared_ptr<const Module>> getModule(
         const CodeHash &code_hash, const RuntimeContext::ContextParams &config);
@@ -0,0 +1,91 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/runtime_instances_prewarm.hpp"
+
+#include "application/app_configuration.hpp"
+#include "blockchain/block_tree.hpp"
+#include "common/worker_thread_pool.hpp"
+#include "runtime/module_instance.hpp"
+#include "runtime/module_repository.hpp"
+#include "runtime/runtime_upgrade_tracker.hpp"
+#include "utils/pool_handler_ready_make.hpp"
+
+namespace kagome::runtime {
+
+  RuntimeInstancesPrewarm::RuntimeInstancesPrewarm(
+      std::shared_ptr<application::AppStateManager> app_state_manager,
+      const application::AppConfiguration &app_config,
+      common::WorkerThreadPool &worker_thread_pool,
+      primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+      std::shared_ptr<const blockchain::BlockTree> block_tree,
+      std::shared_ptr<RuntimeUpgradeTracker> runtime_upgrade_tracker,
+      std::shared_ptr<ModuleRepository> module_repo)
+      : logger_{log::createLogger("RuntimeInstancesPrewarm", "runtime")},
+        instances_{app_config.runtimeInstancesPrewarm()},
+        worker_pool_handler_{poolHandlerReadyMake(
+            this, app_state_manager, worker_thread_pool, logger_)},
+        chain_sub_{std::move(chain_sub_engine)},
+        block_tree_{std::move(block_tree)},
+        runtime_upgrade_tracker_{std::move(runtime_upgrade_tracker)},
+        module_repo_{std::move(module_repo)} {
+    BOOST_ASSERT(block_tree_ != nullptr);
+    BOOST_ASSERT(runtime_upgrade_tracker_ != nullptr);
+    BOOST_ASSERT(module_repo_ != nullptr);
+  }
+
+  bool RuntimeInstancesPrewarm::tryStart() {
+    if (instances_ == 0) {
+      return true;
+    }
+    chain_sub_.onHead([weak{weak_from_this()}] {
+      auto self = weak.lock();
+      if (not self) {
+        return;
+      }
+      self->worker_pool_handler_->execute([weak] {
+        if (auto self = weak.lock()) {
+          if (auto r = self->prewarm(); r.has_error()) {
+            SL_DEBUG(self->logger_, "prewarm error {}", r.error());
+          }
+        }
+      });
+    });
+    if (auto r = prewarm(); r.has_error()) {
+      SL_WARN(logger_, "prewarm error {}", r.error());
+    }
+    return true;
+  }
+
+  outcome::result<void> RuntimeInstancesPrewarm::prewarm() {
+    std::unique_lock lock{prewarm_mutex_, std::try_to_lock};
+    if (not lock.owns_lock()) {
+      return outcome::success();
+    }
+    auto best = block_tree_->bestBlock();
+    OUTCOME_TRY(code_state,
+                runtime_upgrade_tracker_->getLastCodeUpdateState(best));
+    if (code_state == warm_code_state_) {
+      return outcome::success();
+    }
+    OUTCOME_TRY(header, block_tree_->getBlockHeader(best.hash));
+    std::vector<std::shared_ptr<ModuleInstance>> instances;
+    instances.reserve(instances_);
+    // borrowed instances are held together, so the pool creates new ones
+    while (instances.size() < instances_) {
+      OUTCOME_TRY(instance,
+                  module_repo_->getInstanceAt(best, header.state_root));
+      instances.emplace_back(std::move(instance));
+    }
+    warm_code_state_ = code_state;
+    SL_VERBOSE(logger_,
+               "{} instances of runtime at block {} are ready",
+               instances.size(),
+               best);
+    return outcome::success();
+  }
+
+}  // namespace kagome::runtime
@@ -0,0 +1,79 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <mutex>
+#include <optional>
+
+#include "log/logger.hpp"
+#include "primitives/event_types.hpp"
+#include "storage/trie/types.hpp"
+
+namespace kagome {
+  class PoolHandlerReady;
+}  // namespace kagome
+
+namespace kagome::application {
+  class AppConfiguration;
+  class AppStateManager;
+}  // namespace kagome::application
+
+namespace kagome::blockchain {
+  class BlockTree;
+}  // namespace kagome::blockchain
+
+namespace kagome::common {
+  class WorkerThreadPool;
+}  // namespace kagome::common
+
+namespace kagome::runtime {
+  class ModuleRepository;
+  class RuntimeUpgradeTracker;
+
+  /**
+   * Keeps instances of the best block runtime in the instances pool, so that
+   * calls after start and after runtime upgrades don't wait for compilation
+   * and instantiation.
+   */
+  class RuntimeInstancesPrewarm
+      : public std::enable_shared_from_this<RuntimeInstancesPrewarm> {
+   public:
+    RuntimeInstancesPrewarm(
+        std::shared_ptr<application::AppStateManager> app_state_manager,
+        const application::AppConfiguration &app_config,
+        common::WorkerThreadPool &worker_thread_pool,
+        primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+        std::shared_ptr<const blockchain::BlockTree> block_tree,
+        std::shared_ptr<RuntimeUpgradeTracker> runtime_upgrade_tracker,
+        std::shared_ptr<ModuleRepository> module_repo);
+
+    /// Pre-warms the best block runtime and subscribes to new heads.
+    bool tryStart();
+
+    /**
+     * Instantiates the configured number of instances of the best block
+     * runtime, unless it was already done for this runtime. Instances return
+     * to the pool and stay there for later calls.
+     */
+    outcome::result<void> prewarm();
+
+   private:
+    log::Logger logger_;
+    size_t instances_;
+    std::shared_ptr<PoolHandlerReady> worker_pool_handler_;
+    primitives::events::ChainSub chain_sub_;
+    std::shared_ptr<const blockchain::BlockTree> block_tree_;
+    std::shared_ptr<RuntimeUpgradeTracker> runtime_upgrade_tracker_;
+    std::shared_ptr<ModuleRepository> module_repo_;
+
+    /// worker threads skip pre-warming while another one is doing it
+    std::mutex prewarm_mutex_;
+    /// state of the last code update of the pre-warmed runtime
+    std::optional<storage::trie::RootHash> warm_code_state_;
+  };
+
+}  // namespace kagome::runtime
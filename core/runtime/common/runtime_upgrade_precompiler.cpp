@@ -0,0 +1,70 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/runtime_upgrade_precompiler.hpp"
+
+#include "blockchain/block_header_repository.hpp"
+#include "runtime/common/precompile_thread_pool.hpp"
+#include "runtime/module_repository.hpp"
+#include "utils/pool_handler_ready_make.hpp"
+
+namespace kagome::runtime {
+  RuntimeUpgradePrecompiler::RuntimeUpgradePrecompiler(
+      std::shared_ptr<application::AppStateManager> app_state_manager,
+      PrecompileThreadPool &precompile_thread_pool,
+      primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+      std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
+      std::shared_ptr<ModuleRepository> module_repo)
+      : logger_{log::createLogger("RuntimeUpgradePrecompiler", "runtime")},
+        precompile_pool_handler_{poolHandlerReadyMake(
+            this, app_state_manager, precompile_thread_pool, logger_)},
+        chain_sub_{std::make_shared<primitives::events::ChainEventSubscriber>(
+            std::move(chain_sub_engine))},
+        header_repo_{std::move(header_repo)},
+        module_repo_{std::move(module_repo)} {
+    BOOST_ASSERT(header_repo_ != nullptr);
+    BOOST_ASSERT(module_repo_ != nullptr);
+  }
+
+  bool RuntimeUpgradePrecompiler::tryStart() {
+    primitives::events::subscribe(
+        *chain_sub_,
+        primitives::events::ChainEventType::kNewRuntime,
+        [weak{weak_from_this()}](
+            const primitives::events::ChainEventParams &event_params) {
+          auto self = weak.lock();
+          if (not self) {
+            return;
+          }
+          primitives::BlockHash block_hash =
+              boost::get<primitives::events::NewRuntimeEventParams>(
+                  event_params)
+                  .get();
+          self->precompile_pool_handler_->execute([weak, block_hash] {
+            if (auto self = weak.lock()) {
+              if (auto r = self->precompile(block_hash); r.has_error()) {
+                SL_WARN(self->logger_,
+                        "Failed to precompile runtime of block {}: {}",
+                        block_hash,
+                        r.error());
+              }
+            }
+          });
+        });
+    return true;
+  }
+
+  outcome::result<void> RuntimeUpgradePrecompiler::precompile(
+      const primitives::BlockHash &block_hash) {
+    OUTCOME_TRY(header, header_repo_->getBlockHeader(block_hash));
+    auto block = header.blockInfo();
+    SL_VERBOSE(logger_, "Precompiling runtime of block {}", block);
+    OUTCOME_TRY(module_repo_->precompileAt(header.state_root));
+    SL_INFO(logger_, "Runtime of block {} is precompiled", block);
+    return outcome::success();
+  }
+
+}  // namespace kagome::runtime
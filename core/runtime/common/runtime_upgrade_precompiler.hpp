@@ -0,0 +1,60 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "log/logger.hpp"
+#include "primitives/event_types.hpp"
+
+namespace kagome {
+  class PoolHandlerReady;
+}  // namespace kagome
+
+namespace kagome::application {
+  class AppStateManager;
+}  // namespace kagome::application
+
+namespace kagome::blockchain {
+  class BlockHeaderRepository;
+}  // namespace kagome::blockchain
+
+namespace kagome::runtime {
+  class ModuleRepository;
+  class PrecompileThreadPool;
+
+  /**
+   * Compiles the runtime set by an imported block into the modules cache on
+   * a dedicated thread, so that children of the block, which are the first
+   * to execute the new code, don't wait for compilation.
+   * The thread keeps the default priority: block import that needs the
+   * code earlier waits for this compilation, so it must not be starved by
+   * the other threads.
+   */
+  class RuntimeUpgradePrecompiler
+      : public std::enable_shared_from_this<RuntimeUpgradePrecompiler> {
+   public:
+    RuntimeUpgradePrecompiler(
+        std::shared_ptr<application::AppStateManager> app_state_manager,
+        PrecompileThreadPool &precompile_thread_pool,
+        primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+        std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
+        std::shared_ptr<ModuleRepository> module_repo);
+
+    /// Subscribes to new runtimes.
+    bool tryStart();
+
+    /// Compiles the runtime code in the state of the block
+    outcome::result<void> precompile(const primitives::BlockHash &block_hash);
+
+   private:
+    log::Logger logger_;
+    std::shared_ptr<PoolHandlerReady> precompile_pool_handler_;
+    primitives::events::ChainEventSubscriberPtr chain_sub_;
+    std::shared_ptr<blockchain::BlockHeaderRepository> header_repo_;
+    std::shared_ptr<ModuleRepository> module_repo_;
+  };
+
+}  // namespace kagome::runtime
@@ -57,30 +57,25 @@ namespace kagome::runtime {
       std::shared_ptr<storage::trie::TrieBatch> batch) {
     SL_DEBUG(logger_, "Setting storage provider to new batch");
     child_batches_.clear();
+    child_overlays_.clear();
     base_batch_ = batch;
-    transaction_stack_.clear();
-    transaction_stack_.emplace_back(
-        Transaction{std::make_shared<TopperTrieBatchImpl>(base_batch_), {}});
+    overlay_ = std::make_shared<TopperTrieBatchImpl>(base_batch_);
   }
 
   std::shared_ptr<TrieStorageProviderImpl::Batch>
   TrieStorageProviderImpl::getCurrentBatch() const {
-    if (transaction_stack_.empty()) {
+    if (overlay_ == nullptr) {
       throw std::runtime_error("TrieStorageProviderImpl::getCurrentBatch");
     }
-    return transaction_stack_.back().main_batch;
+    return overlay_;
   }
 
   outcome::result<std::optional<std::shared_ptr<storage::trie::TrieBatch>>>
   TrieStorageProviderImpl::findChildBatchAt(
       const common::Buffer &root_path) const {
-    for (auto transaction_it = transaction_stack_.rbegin();
-         transaction_it != transaction_stack_.rend();
-         transaction_it++) {
-      if (auto it = transaction_it->child_batches.find(root_path);
-          it != transaction_it->child_batches.end()) {
-        return it->second;
-      }
+    if (auto it = child_overlays_.find(root_path);
+        it != child_overlays_.end()) {
+      return it->second;
     }
     auto child_it = child_batches_.find(root_path);
     if (child_it == child_batches_.end()) {
@@ -119,109 +114,77 @@ namespace kagome::runtime {
   outcome::result<std::reference_wrapper<storage::trie::TrieBatch>>
   TrieStorageProviderImpl::getMutableChildBatchAt(
       const common::Buffer &root_path) {
-    // if we already have the batch, return it
-    if (not transaction_stack_.empty()) {
-      auto &top = transaction_stack_.back();
-      auto it = top.child_batches.find(root_path);
-      if (it != top.child_batches.end()) {
-        return *it->second;
-      }
-    }
-
-    // start with checking that the base batch exists, create one if it doesn't
-    std::shared_ptr<storage::trie::TrieBatch> base_batch{};
-    if (auto it = child_batches_.find(root_path); it == child_batches_.end()) {
-      OUTCOME_TRY(batch_ptr, createBaseChildBatchAt(root_path));
-      base_batch = batch_ptr;
-    } else {
-      base_batch = it->second;
-    }
-    auto highest_child_batch = base_batch;
-    for (auto &transaction : transaction_stack_) {
-      // if we have a batch at this level, just memorize it
-      if (auto it = transaction.child_batches.find(root_path);
-          it != transaction.child_batches.end()) {
-        highest_child_batch = it->second;
-      } else {
-        // if we don't have a batch at this level, create one
-        auto child_batch = std::make_shared<storage::trie::TopperTrieBatchImpl>(
-            highest_child_batch);
-        transaction.child_batches.insert({root_path, child_batch});
-        highest_child_batch = child_batch;
-      }
-    }
-
-    return *highest_child_batch;
+    if (auto it = child_overlays_.find(root_path);
+        it != child_overlays_.end()) {
+      return *it->second;
+    }
+    OUTCOME_TRY(base_batch, createBaseChildBatchAt(root_path));
+    auto overlay = std::make_shared<TopperTrieBatchImpl>(base_batch);
+    // join transactions which are already started
+    for (size_t i = 0; i < overlay_->transactionDepth(); ++i) {
+      overlay->startTransaction();
+    }
+    child_overlays_.emplace(root_path, overlay);
+    return *overlay;
   }
 
   outcome::result<storage::trie::RootHash> TrieStorageProviderImpl::commit(
       const std::optional<BufferView> &child, StateVersion version) {
     // TODO(turuslan): #2067, clone batch or implement delta_trie_root
-    auto child_apply =
-        [&](BufferView child,
-            storage::BufferStorage &map) -> outcome::result<void> {
-      for (auto &transaction : transaction_stack_) {
-        auto it = transaction.child_batches.find(child);
-        if (it == transaction.child_batches.end()) {
-          continue;
-        }
-        OUTCOME_TRY(it->second->apply(map));
-      }
-      return outcome::success();
-    };
     if (child) {
       OUTCOME_TRY(getChildBatchAt(*child));
       auto child_batch = child_batches_.at(*child);
-      OUTCOME_TRY(child_apply(*child, *child_batch));
+      if (auto it = child_overlays_.find(*child);
+          it != child_overlays_.end()) {
+        OUTCOME_TRY(it->second->apply(*child_batch));
+      }
       return child_batch->commit(version);
     }
-    auto batch = base_batch_;
-    for (auto &transaction : transaction_stack_) {
-      OUTCOME_TRY(transaction.main_batch->apply(*batch));
+    OUTCOME_TRY(overlay_->apply(*base_batch_));
+    for (auto &[root_path, overlay] : child_overlays_) {
+      OUTCOME_TRY(overlay->apply(*child_batches_.at(root_path)));
     }
-    for (auto &p : child_batches_) {
-      OUTCOME_TRY(getChildBatchAt(p.first));
-      auto child_batch = child_batches_.at(p.first);
-      OUTCOME_TRY(child_apply(p.first, *child_batch));
-    }
-    return batch->commit(version);
+    return base_batch_->commit(version);
   }
 
   outcome::result<void> TrieStorageProviderImpl::startTransaction() {
-    transaction_stack_.emplace_back(Transaction{
-        std::make_shared<TopperTrieBatchImpl>(getCurrentBatch()), {}});
+    overlay_->startTransaction();
+    for (auto &[root_path, overlay] : child_overlays_) {
+      overlay->startTransaction();
+    }
     SL_TRACE(logger_,
              "Start storage transaction, depth {}",
-             transaction_stack_.size());
+             overlay_->transactionDepth());
     return outcome::success();
   }
 
   outcome::result<void> TrieStorageProviderImpl::rollbackTransaction() {
-    if (transaction_stack_.size() <= 1) {
+    if (overlay_->transactionDepth() == 0) {
       return RuntimeExecutionError::NO_TRANSACTIONS_WERE_STARTED;
     }
 
     SL_TRACE(logger_,
              "Rollback storage transaction, depth {}",
-             transaction_stack_.size());
-    transaction_stack_.pop_back();
+             overlay_->transactionDepth());
+    overlay_->rollbackTransaction();
+    for (auto &[root_path, overlay] : child_overlays_) {
+      overlay->rollbackTransaction();
+    }
     return outcome::success();
   }
 
   outcome::result<void> TrieStorageProviderImpl::commitTransaction() {
-    if (transaction_stack_.size() <= 1) {
+    if (overlay_->transactionDepth() == 0) {
       return RuntimeExecutionError::NO_TRANSACTIONS_WERE_STARTED;
     }
 
-    OUTCOME_TRY(transaction_stack_.back().main_batch->writeBack());
-    for (auto &[root, child_batch] : transaction_stack_.back().child_batches) {
-      OUTCOME_TRY(child_batch->writeBack());
-    }
-
     SL_TRACE(logger_,
              "Commit storage transaction, depth {}",
-             transaction_stack_.size());
-    transaction_stack_.pop_back();
+             overlay_->transactionDepth());
+    overlay_->commitTransaction();
+    for (auto &[root_path, overlay] : child_overlays_) {
+      overlay->commitTransaction();
+    }
     return outcome::success();
   }
 
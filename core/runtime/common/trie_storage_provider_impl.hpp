@@ -68,15 +68,13 @@ namespace kagome::runtime {
     std::shared_ptr<storage::trie::TrieStorage> trie_storage_;
     std::shared_ptr<storage::trie::TrieSerializer> trie_serializer_;
 
-    struct Transaction {
-      // batch for the main trie in this transaction
-      std::shared_ptr<storage::trie::TopperTrieBatchImpl> main_batch;
-      // batches for child tries in this transaction
-      std::unordered_map<common::Buffer,
-                         std::shared_ptr<storage::trie::TopperTrieBatchImpl>>
-          child_batches;
-    };
-    std::vector<Transaction> transaction_stack_;
+    // changes of runtime calls with nested storage transactions
+    std::shared_ptr<storage::trie::TopperTrieBatchImpl> overlay_;
+
+    // changes of child tries, created when child trie is modified
+    std::unordered_map<common::Buffer,
+                       std::shared_ptr<storage::trie::TopperTrieBatchImpl>>
+        child_overlays_;
 
     // base trie batch (i.e. not an overlay used for storage transactions)
     std::shared_ptr<Batch> base_batch_;
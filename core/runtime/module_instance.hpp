@@ -121,9 +121,26 @@ namespace kagome::runtime {
     virtual const InstanceEnvironment &getEnvironment() const = 0;
     virtual outcome::result<void> resetEnvironment() = 0;
 
-    outcome::result<void> resetMemory();
+    /**
+     * Resets the heap allocator and restores data segments. The first reset
+     * copies heap base and data segments into a snapshot, later resets write
+     * the snapshot back with a single copy.
+     */
+    virtual outcome::result<void> resetMemory();
 
     virtual outcome::result<void> stateless();
+
+   private:
+    /// data segments merged into one image starting at the offset
+    struct MemorySnapshot {
+      uint32_t heap_base;
+      SegmentOffset offset;
+      common::Buffer data;
+    };
+
+    outcome::result<MemorySnapshot> makeMemorySnapshot() const;
+
+    std::optional<MemorySnapshot> memory_snapshot_;
   };
 
 }  // namespace kagome::runtime
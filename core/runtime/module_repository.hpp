@@ -49,6 +49,14 @@ namespace kagome::runtime {
      */
     virtual outcome::result<std::optional<primitives::Version>> embeddedVersion(
         const primitives::BlockHash &block_hash) = 0;
+
+    /**
+     * Compiles the runtime code set in the \arg state into the modules cache
+     * without instantiating it, so blocks executed on top of the state don't
+     * wait for compilation.
+     */
+    virtual outcome::result<void> precompileAt(
+        const storage::trie::RootHash &state) = 0;
   };
 
 }  // namespace kagome::runtime
@@ -30,6 +30,15 @@ namespace kagome::runtime {
     instantiateFromCode(const CodeHash &code_hash,
                         const GetCode &get_code,
                         const RuntimeContext::ContextParams &config) = 0;
+
+    /**
+     * Compiles the module into the cache and loads it, without creating
+     * instances
+     */
+    virtual outcome::result<void> precompile(
+        const CodeHash &code_hash,
+        const GetCode &get_code,
+        const RuntimeContext::ContextParams &config) = 0;
   };
 
 }  // namespace kagome::runtime
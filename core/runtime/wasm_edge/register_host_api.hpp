@@ -12,6 +12,7 @@
 
 #include "host_api/host_api.hpp"
 #include "log/logger.hpp"
+#include "runtime/common/host_api_profiler.hpp"
 #include "runtime/common/register_host_api.hpp"
 
 namespace kagome::runtime::wasm_edge {
@@ -109,7 +110,7 @@ namespace kagome::runtime::wasm_edge {
         f, array, std::make_index_sequence<sizeof...(Args)>());
   }
 
-  template <auto Method>
+  template <auto Method, HostMethod method>
   WasmEdge_Result host_method_wrapper(
       void *current_host_api,
       const WasmEdge_CallingFrameContext *call_frame_cxt,
@@ -124,14 +125,22 @@ namespace kagome::runtime::wasm_edge {
       if constexpr (std::is_void_v<Ret>) {
         call_with_array(
             [&host_api](auto... params) mutable {
-              std::invoke(Method, host_api, params...);
+              profiledHostCall<method, Ret>(
+                  [&](auto... values) {
+                    std::invoke(Method, host_api, values...);
+                  },
+                  params...);
             },
             std::span{params, std::tuple_size_v<Args>},
             Args{});
       } else {
         Ret res = call_with_array(
             [&host_api](auto... params) mutable -> Ret {
-              return std::invoke(Method, host_api, params...);
+              return profiledHostCall<method, Ret>(
+                  [&](auto... values) {
+                    return std::invoke(Method, host_api, values...);
+                  },
+                  params...);
             },
             std::span{params, std::tuple_size_v<Args>},
             Args{});
@@ -179,11 +188,11 @@ namespace kagome::runtime::wasm_edge {
     register_method(cb, module, data, name, rets, std::span(types));
   }
 
-  template <auto Method, typename Ret, typename... Args>
+  template <auto Method, HostMethod method, typename Ret, typename... Args>
   void register_host_method(WasmEdge_ModuleInstanceContext *module,
                             host_api::HostApi &host_api,
                             std::string_view name) {
-    WasmEdge_HostFunc_t cb = &host_method_wrapper<Method>;
+    WasmEdge_HostFunc_t cb = &host_method_wrapper<Method, method>;
     register_method<Ret, Args...>(cb, module, &host_api, name);
   }
 
@@ -207,6 +216,7 @@ namespace kagome::runtime::wasm_edge {
 
 #define REGISTER_HOST_METHOD(Ret, name, ...)            \
   register_host_method<&host_api::HostApi::name,        \
+                       HostMethod::name,                \
                        Ret __VA_OPT__(, ) __VA_ARGS__>( \
       instance, host_api, #name);                       \
   existing_imports.insert(#name);
@@ -8,6 +8,7 @@
 
 #include <unordered_set>
 
+#include "runtime/common/host_api_profiler.hpp"
 #include "runtime/common/register_host_api.hpp"
 #include "runtime/module_repository.hpp"
 #include "runtime/wavm/intrinsics/intrinsic_module.hpp"
@@ -61,21 +62,25 @@ namespace kagome::runtime::wavm {
     return WAVM::IR::ValueType::i64;
   }
 
-  template <auto Method, typename... Args>
-  auto host_method_thunk(WAVM::Runtime::ContextRuntimeData *, Args... args) {
-    return std::invoke(Method, peekHostApi(), args...);
+  template <auto Method, HostMethod method, typename Ret, typename... Args>
+  Ret host_method_thunk(WAVM::Runtime::ContextRuntimeData *, Args... args) {
+    return profiledHostCall<method, Ret>(
+        [](auto... values) {
+          return std::invoke(Method, peekHostApi(), values...);
+        },
+        args...);
   }
 
-  template <auto Method, typename Ret, typename... Args>
+  template <auto Method, HostMethod method, typename Ret, typename... Args>
   void registerMethod(IntrinsicModule &module, std::string_view name) {
     if constexpr (std::is_void_v<Ret>) {
       module.addFunction(
           name,
-          host_method_thunk<Method, Args...>,
+          host_method_thunk<Method, method, Ret, Args...>,
           WAVM::IR::FunctionType{{}, {get_wavm_type<Args>()...}});
     } else {
       module.addFunction(name,
-                         host_method_thunk<Method, Args...>,
+                         host_method_thunk<Method, method, Ret, Args...>,
                          WAVM::IR::FunctionType{{get_wavm_type<Ret>()},
                                                 {get_wavm_type<Args>()...}});
     }
@@ -85,9 +90,10 @@ namespace kagome::runtime::wavm {
     if (logger == nullptr) {
       logger = log::createLogger("Host API wrappers", "wavm");
     }
-#define REGISTER_HOST_METHOD(Ret, name, ...)                                \
-  registerMethod<&host_api::HostApi::name, Ret __VA_OPT__(, ) __VA_ARGS__>( \
-      module, #name);
+#define REGISTER_HOST_METHOD(Ret, name, ...)                  \
+  registerMethod<&host_api::HostApi::name,                    \
+                 HostMethod::name,                            \
+                 Ret __VA_OPT__(, ) __VA_ARGS__>(module, #name);
 
     REGISTER_HOST_METHODS
   }
@@ -15,6 +15,7 @@
 #include "common/buffer_or_view.hpp"
 #include "storage/face/batch_writeable.hpp"
 #include "storage/face/generic_maps.hpp"
+#include "storage/face/spaced_batch.hpp"
 #include "storage/face/write_batch.hpp"
 
 namespace kagome::storage::face {
@@ -34,8 +35,14 @@ namespace kagome::storage {
   using common::BufferOrView;
   using common::BufferView;
 
+  using BufferWriteable = face::Writeable<Buffer, Buffer>;
+
   using BufferBatch = face::WriteBatch<Buffer, Buffer>;
 
+  using BufferSpacedBatch = face::SpacedBatch<Buffer, Buffer>;
+
+  using BufferSpaceWriter = face::SpaceWriter<Buffer, Buffer>;
+
   using BufferStorage = face::GenericStorage<Buffer, Buffer>;
 
   using BufferStorageCursor = face::MapCursor<Buffer, Buffer>;
@@ -33,6 +33,24 @@ namespace kagome::storage::changes_trie {
      * Supposed to be called when an entry is removed from the tracked storage
      */
     virtual void onRemove(const common::BufferView &key) = 0;
+
+    /**
+     * Supposed to be called when an entry is put into a child trie of the
+     * tracked storage
+     */
+    virtual void onChildPut(const common::BufferView &key,
+                            const common::BufferView &value,
+                            bool new_entry) {
+      onPut(key, value, new_entry);
+    }
+
+    /**
+     * Supposed to be called when an entry is removed from a child trie of the
+     * tracked storage
+     */
+    virtual void onChildRemove(const common::BufferView &key) {
+      onRemove(key);
+    }
   };
 
 }  // namespace kagome::storage::changes_trie
@@ -32,6 +32,35 @@ namespace kagome::storage::changes_trie {
   void StorageChangesTrackerImpl::onPut(const common::BufferView &key,
                                         const common::BufferView &value,
                                         bool is_new_entry) {
+    if (child_keys_.contains(key)) {
+      ambiguous_ = true;
+    }
+    put(key, value, is_new_entry);
+  }
+
+  void StorageChangesTrackerImpl::onRemove(const common::BufferView &key) {
+    if (child_keys_.contains(key)) {
+      ambiguous_ = true;
+    }
+    remove(key);
+  }
+
+  void StorageChangesTrackerImpl::onChildPut(const common::BufferView &key,
+                                             const common::BufferView &value,
+                                             bool is_new_entry) {
+    onChildChange(key);
+    put(key, value, is_new_entry);
+  }
+
+  void StorageChangesTrackerImpl::onChildRemove(
+      const common::BufferView &key) {
+    onChildChange(key);
+    remove(key);
+  }
+
+  void StorageChangesTrackerImpl::put(const common::BufferView &key,
+                                      const common::BufferView &value,
+                                      bool is_new_entry) {
     auto it = actual_val_.find(key);
     if (it != actual_val_.end()) {
       it->second.emplace(value);
@@ -43,13 +72,38 @@ namespace kagome::storage::changes_trie {
     }
   }
 
-  void StorageChangesTrackerImpl::onRemove(const common::BufferView &key) {
+  void StorageChangesTrackerImpl::remove(const common::BufferView &key) {
     if (auto it = actual_val_.find(key); it != actual_val_.end()) {
       if (new_entries_.erase(it->first) != 0) {
         actual_val_.erase(it);
       } else {
         it->second.reset();
       }
+    } else {
+      // the entry may exist in the underlying storage
+      actual_val_.emplace(key, std::nullopt);
+    }
+  }
+
+  void StorageChangesTrackerImpl::onChildChange(const common::BufferView &key) {
+    // the same key was changed in the main trie
+    if (not child_keys_.contains(key) and actual_val_.contains(key)) {
+      ambiguous_ = true;
+    }
+    child_keys_.emplace(key);
+  }
+
+  std::optional<StorageChangesTrackerImpl::Changes>
+  StorageChangesTrackerImpl::mainTrieChanges() const {
+    if (ambiguous_) {
+      return std::nullopt;
+    }
+    Changes changes;
+    for (auto &[key, value] : actual_val_) {
+      if (not child_keys_.contains(key)) {
+        changes.emplace_hint(changes.end(), key, value);
+      }
     }
+    return changes;
   }
 }  // namespace kagome::storage::changes_trie
@@ -27,11 +27,32 @@ namespace kagome::storage::changes_trie {
                const common::BufferView &value,
                bool new_entry) override;
     void onRemove(const common::BufferView &key) override;
+    void onChildPut(const common::BufferView &key,
+                    const common::BufferView &value,
+                    bool new_entry) override;
+    void onChildRemove(const common::BufferView &key) override;
+
+    using Changes = std::map<common::Buffer, std::optional<common::Buffer>>;
+
+    /**
+     * @return changes of the main trie, nullopt if a key was changed both in
+     * the main trie and in a child trie, so changes can't be told apart
+     */
+    std::optional<Changes> mainTrieChanges() const;
 
    private:
+    void put(const common::BufferView &key,
+             const common::BufferView &value,
+             bool new_entry);
+    void remove(const common::BufferView &key);
+    void onChildChange(const common::BufferView &key);
+
     std::set<common::Buffer> new_entries_;  // entries that do not yet exist in
                                             // the underlying storage
-    std::map<common::Buffer, std::optional<common::Buffer>> actual_val_;
+    Changes actual_val_;
+    // keys changed in child tries, they share actual_val_ with the main trie
+    std::set<common::Buffer> child_keys_;
+    bool ambiguous_ = false;
 
     log::Logger logger_ =
         log::createLogger("Storage Changes Tracker", "changes_trie");
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <span>
+#include <vector>
+
 #include <outcome/outcome.hpp>
 
 #include "storage/face/owned_or_view.hpp"
@@ -42,5 +45,22 @@ namespace kagome::storage::face {
      */
     virtual outcome::result<std::optional<OwnedOrView<V>>> tryGet(
         const View<K> &key) const = 0;
+
+    /**
+     * @brief Get values of several keys at once. Storages which support
+     * batched lookups override it, others fall back to a series of tryGet
+     * @param keys list of keys
+     * @return values or std::nullopt, in the order of keys
+     */
+    virtual outcome::result<std::vector<std::optional<OwnedOrView<V>>>>
+    multiGet(std::span<const View<K>> keys) const {
+      std::vector<std::optional<OwnedOrView<V>>> values;
+      values.reserve(keys.size());
+      for (auto &key : keys) {
+        OUTCOME_TRY(value, tryGet(key));
+        values.emplace_back(std::move(value));
+      }
+      return values;
+    }
   };
 }  // namespace kagome::storage::face
@@ -0,0 +1,71 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "storage/face/writeable.hpp"
+#include "storage/spaces.hpp"
+
+namespace kagome::storage::face {
+
+  /**
+   * @brief Batch of writes to several spaces of one storage, which are
+   * committed together
+   * @tparam K key type
+   * @tparam V value type
+   */
+  template <typename K, typename V>
+  struct SpacedBatch {
+    virtual ~SpacedBatch() = default;
+
+    /**
+     * @brief Store value by key in space
+     */
+    virtual outcome::result<void> put(Space space,
+                                      const View<K> &key,
+                                      OwnedOrView<V> &&value) = 0;
+
+    /**
+     * @brief Remove value by key from space
+     */
+    virtual outcome::result<void> remove(Space space, const View<K> &key) = 0;
+
+    /**
+     * @brief Writes batch.
+     * @return error code in case of error.
+     */
+    virtual outcome::result<void> commit() = 0;
+
+    /**
+     * @brief Clear batch.
+     */
+    virtual void clear() = 0;
+  };
+
+  /**
+   * @brief Writes to one space of spaced batch
+   */
+  template <typename K, typename V>
+  class SpaceWriter : public Writeable<K, V> {
+   public:
+    SpaceWriter(SpacedBatch<K, V> &batch, Space space)
+        : batch_{batch}, space_{space} {}
+
+    outcome::result<void> put(const View<K> &key,
+                              OwnedOrView<V> &&value) override {
+      return batch_.put(space_, key, std::move(value));
+    }
+
+    outcome::result<void> remove(const View<K> &key) override {
+      return batch_.remove(space_, key);
+    }
+
+   private:
+    SpacedBatch<K, V> &batch_;
+    Space space_;
+  };
+
+}  // namespace kagome::storage::face
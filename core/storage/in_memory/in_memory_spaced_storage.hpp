@@ -35,7 +35,49 @@ namespace kagome::storage {
           .first->second;
     }
 
+    std::unique_ptr<BufferSpacedBatch> createBatch() override {
+      return std::make_unique<Batch>(*this);
+    }
+
    private:
+    class Batch : public BufferSpacedBatch {
+     public:
+      explicit Batch(InMemorySpacedStorage &db) : db{db} {}
+
+      outcome::result<void> put(Space space,
+                                const BufferView &key,
+                                BufferOrView &&value) override {
+        writes.emplace_back(space, Buffer{key}, value.intoBuffer());
+        return outcome::success();
+      }
+
+      outcome::result<void> remove(Space space,
+                                   const BufferView &key) override {
+        writes.emplace_back(space, Buffer{key}, std::nullopt);
+        return outcome::success();
+      }
+
+      outcome::result<void> commit() override {
+        for (auto &[space, key, value] : writes) {
+          if (value) {
+            OUTCOME_TRY(db.getSpace(space)->put(key, BufferView{*value}));
+          } else {
+            OUTCOME_TRY(db.getSpace(space)->remove(key));
+          }
+        }
+        writes.clear();
+        return outcome::success();
+      }
+
+      void clear() override {
+        writes.clear();
+      }
+
+     private:
+      InMemorySpacedStorage &db;
+      std::vector<std::tuple<Space, Buffer, std::optional<Buffer>>> writes;
+    };
+
     std::map<Space, std::shared_ptr<InMemoryStorage>> spaces;
   };
 
@@ -41,6 +41,9 @@ namespace kagome::storage {
 
   inline const common::Buffer kWarpSyncOp = ":kagome:WarpSync:op"_buf;
 
+  inline const common::Buffer kFlatStateRootLookupKey =
+      ":kagome:flat_state_root"_buf;
+
   inline const common::Buffer kFirstBlockSlot = ":kagome:first_block_slot"_buf;
 
   inline const common::Buffer kBabeConfigRepositoryImplIndexerPrefix =
@@ -128,6 +128,10 @@ namespace kagome::storage {
     return space_ptr;
   }
 
+  std::unique_ptr<BufferSpacedBatch> RocksDb::createBatch() {
+    return std::make_unique<RocksDbSpacedBatch>(weak_from_this());
+  }
+
   void RocksDb::dropColumn(kagome::storage::Space space) {
     auto space_name = spaceName(space);
     auto column_it =
@@ -263,6 +267,39 @@ namespace kagome::storage {
     return status_as_error(status);
   }
 
+  outcome::result<std::vector<std::optional<BufferOrView>>>
+  RocksDbSpace::multiGet(std::span<const BufferView> keys) const {
+    OUTCOME_TRY(rocks, use());
+    std::vector<rocksdb::Slice> slices;
+    slices.reserve(keys.size());
+    for (auto &key : keys) {
+      slices.emplace_back(make_slice(key));
+    }
+    std::vector<rocksdb::PinnableSlice> pinned(keys.size());
+    std::vector<rocksdb::Status> statuses(keys.size());
+    rocks->db_->MultiGet(rocks->ro_,
+                         column_,
+                         slices.size(),
+                         slices.data(),
+                         pinned.data(),
+                         statuses.data());
+    std::vector<std::optional<BufferOrView>> values;
+    values.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+      if (statuses[i].ok()) {
+        auto *data = reinterpret_cast<const uint8_t *>(  // NOLINT
+            pinned[i].data());
+        auto buf = Buffer(data, data + pinned[i].size());
+        values.emplace_back(BufferOrView(std::move(buf)));
+      } else if (statuses[i].IsNotFound()) {
+        values.emplace_back(std::nullopt);
+      } else {
+        return status_as_error(statuses[i]);
+      }
+    }
+    return values;
+  }
+
   outcome::result<void> RocksDbSpace::put(const BufferView &key,
                                           BufferOrView &&value) {
     OUTCOME_TRY(rocks, use());
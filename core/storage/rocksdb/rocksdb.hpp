@@ -52,6 +52,8 @@ namespace kagome::storage {
 
     std::shared_ptr<BufferStorage> getSpace(Space space) override;
 
+    std::unique_ptr<BufferSpacedBatch> createBatch() override;
+
     /**
      * Implementation specific way to erase the whole space data.
      * Not exposed at SpacedStorage level as only used in pruner.
@@ -71,6 +73,7 @@ namespace kagome::storage {
 
     friend class RocksDbSpace;
     friend class RocksDbBatch;
+    friend class RocksDbSpacedBatch;
 
    private:
     RocksDb();
@@ -106,6 +109,9 @@ namespace kagome::storage {
     outcome::result<std::optional<BufferOrView>> tryGet(
         const BufferView &key) const override;
 
+    outcome::result<std::vector<std::optional<BufferOrView>>> multiGet(
+        std::span<const BufferView> keys) const override;
+
     outcome::result<void> put(const BufferView &key,
                               BufferOrView &&value) override;
 
@@ -114,6 +120,7 @@ namespace kagome::storage {
     void compact(const Buffer &first, const Buffer &last);
 
     friend class RocksDbBatch;
+    friend class RocksDbSpacedBatch;
 
    private:
     // gather storage instance from weak ptr
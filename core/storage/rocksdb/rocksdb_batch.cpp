@@ -40,4 +40,49 @@ namespace kagome::storage {
   void RocksDbBatch::clear() {
     batch_.Clear();
   }
+
+  RocksDbSpacedBatch::RocksDbSpacedBatch(std::weak_ptr<RocksDb> db)
+      : db_{std::move(db)} {}
+
+  outcome::result<void> RocksDbSpacedBatch::put(Space space,
+                                                const BufferView &key,
+                                                BufferOrView &&value) {
+    OUTCOME_TRY(handle, column(space));
+    batch_.Put(handle, make_slice(key), make_slice(value));
+    return outcome::success();
+  }
+
+  outcome::result<void> RocksDbSpacedBatch::remove(Space space,
+                                                   const BufferView &key) {
+    OUTCOME_TRY(handle, column(space));
+    batch_.Delete(handle, make_slice(key));
+    return outcome::success();
+  }
+
+  outcome::result<void> RocksDbSpacedBatch::commit() {
+    auto rocks = db_.lock();
+    if (!rocks) {
+      return DatabaseError::STORAGE_GONE;
+    }
+    auto status = rocks->db_->Write(rocks->wo_, &batch_);
+    if (status.ok()) {
+      return outcome::success();
+    }
+
+    return status_as_error(status);
+  }
+
+  void RocksDbSpacedBatch::clear() {
+    batch_.Clear();
+  }
+
+  outcome::result<rocksdb::ColumnFamilyHandle *> RocksDbSpacedBatch::column(
+      Space space) {
+    auto rocks = db_.lock();
+    if (!rocks) {
+      return DatabaseError::STORAGE_GONE;
+    }
+    auto &space_db = static_cast<RocksDbSpace &>(*rocks->getSpace(space));
+    return space_db.column_;
+  }
 }  // namespace kagome::storage
@@ -30,4 +30,26 @@ namespace kagome::storage {
     RocksDbSpace &db_;
     rocksdb::WriteBatch batch_;
   };
+
+  /// Writes to several columns with one rocksdb batch
+  class RocksDbSpacedBatch : public BufferSpacedBatch {
+   public:
+    explicit RocksDbSpacedBatch(std::weak_ptr<RocksDb> db);
+
+    outcome::result<void> put(Space space,
+                              const BufferView &key,
+                              BufferOrView &&value) override;
+
+    outcome::result<void> remove(Space space, const BufferView &key) override;
+
+    outcome::result<void> commit() override;
+
+    void clear() override;
+
+   private:
+    outcome::result<rocksdb::ColumnFamilyHandle *> column(Space space);
+
+    std::weak_ptr<RocksDb> db_;
+    rocksdb::WriteBatch batch_;
+  };
 }  // namespace kagome::storage
@@ -23,6 +23,9 @@ namespace kagome::storage {
         "trie_value",
         "dispute_data",
         "beefy_justification",
+        "flat_state",
+        "availability_storage",
+        "trie_pruner",
     };
     static_assert(kNames.size() == Space::kTotal - 1);
 
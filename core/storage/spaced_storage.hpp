@@ -7,6 +7,7 @@
 #pragma once
 
 #include <memory>
+#include <stdexcept>
 
 #include "outcome/outcome.hpp"
 #include "storage/buffer_map_types.hpp"
@@ -25,6 +26,14 @@ namespace kagome::storage {
      * @return a pointer buffer storage for a space
      */
     virtual std::shared_ptr<BufferStorage> getSpace(Space space) = 0;
+
+    /**
+     * Creates batch of writes to several spaces, which are committed
+     * atomically
+     */
+    virtual std::unique_ptr<BufferSpacedBatch> createBatch() {
+      throw std::logic_error{"SpacedStorage::createBatch not implemented"};
+    }
   };
 
 }  // namespace kagome::storage
@@ -23,6 +23,9 @@ namespace kagome::storage {
     kTrieValue,
     kDisputeData,
     kBeefyJustification,
+    kFlatState,
+    kAvailabilityStorage,
+    kTriePruner,
 
     kTotal
   };
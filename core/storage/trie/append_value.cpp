@@ -0,0 +1,42 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/append_value.hpp"
+
+#include "scale/scale.hpp"
+
+namespace kagome::storage::trie {
+  outcome::result<AppendValue> AppendValue::decode(
+      common::BufferView encoded) {
+    AppendValue value;
+    if (encoded.empty()) {
+      return value;
+    }
+    scale::ScaleDecoderStream s{encoded};
+    try {
+      scale::CompactInteger count;
+      s >> count;
+      value.count = count.convert_to<size_t>();
+    } catch (std::system_error &e) {
+      return outcome::failure(e.code());
+    }
+    value.items = common::Buffer{encoded.subspan(s.currentIndex())};
+    return value;
+  }
+
+  void AppendValue::append(common::BufferView encoded_items, size_t count) {
+    items.put(encoded_items);
+    this->count += count;
+  }
+
+  common::Buffer AppendValue::encode() const {
+    common::Buffer encoded{
+        scale::encode(scale::CompactInteger{count}).value()};
+    encoded.reserve(encoded.size() + items.size());
+    encoded.put(items);
+    return encoded;
+  }
+}  // namespace kagome::storage::trie
@@ -0,0 +1,30 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "common/buffer.hpp"
+#include "outcome/outcome.hpp"
+
+namespace kagome::storage::trie {
+  /**
+   * SCALE encoded vector value written by `ext_storage_append`.
+   * Keeps items and their count separately, so appending item doesn't
+   * re-encode whole value, which is encoded once when it's read or written.
+   */
+  struct AppendValue {
+    /// Decodes vector length prefix, empty value is empty vector
+    static outcome::result<AppendValue> decode(common::BufferView encoded);
+
+    /// Appends `count` already encoded items
+    void append(common::BufferView encoded_items, size_t count);
+
+    common::Buffer encode() const;
+
+    common::Buffer items;
+    size_t count = 0;
+  };
+}  // namespace kagome::storage::trie
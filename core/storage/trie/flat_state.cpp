@@ -0,0 +1,398 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/flat_state.hpp"
+
+#include <soralog/util.hpp>
+
+#include "storage/predefined_keys.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_cursor_impl.hpp"
+
+OUTCOME_CPP_DEFINE_CATEGORY(kagome::storage::trie, FlatState::Error, e) {
+  using E = kagome::storage::trie::FlatState::Error;
+  switch (e) {
+    case E::STATE_NOT_COVERED:
+      return "State is not covered by the flat state";
+    case E::VALUE_NOT_LOADED:
+      return "Trie value could not be loaded while rebuilding the flat state";
+    case E::STOPPED:
+      return "Flat state rebuild was stopped";
+  }
+  return "Unknown FlatState error";
+}
+
+namespace kagome::storage::trie {
+
+  FlatState::FlatState(
+      std::shared_ptr<SpacedStorage> storage,
+      std::shared_ptr<TrieSerializer> serializer,
+      primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+      size_t max_diffs_size)
+      : storage_{std::move(storage)},
+        db_{storage_->getSpace(Space::kFlatState)},
+        meta_{storage_->getSpace(Space::kDefault)},
+        serializer_{std::move(serializer)},
+        chain_sub_{std::move(chain_sub_engine)},
+        max_diffs_size_{max_diffs_size},
+        logger_{log::createLogger("FlatState", "storage")} {
+    BOOST_ASSERT(serializer_ != nullptr);
+
+    if (auto root = meta_->tryGet(kFlatStateRootLookupKey); not root) {
+      SL_WARN(logger_, "Failed to load flat state root: {}", root.error());
+    } else if (root.value()) {
+      if (auto hash = RootHash::fromSpan(*root.value())) {
+        state_.unsafeGet().base = hash.value();
+        SL_INFO(logger_, "Flat state is at state {}", hash.value());
+      }
+    }
+
+    chain_sub_.onFinalize([this](const primitives::BlockHeader &header) {
+      onFinalized(header.number, header.state_root);
+    });
+  }
+
+  FlatState::~FlatState() {
+    stop_ = true;
+    if (rebuild_thread_.joinable()) {
+      rebuild_thread_.join();
+    }
+  }
+
+  std::optional<FlatState::Lookup> FlatState::tryGet(
+      const RootHash &state_root, common::BufferView key) const {
+    std::optional<uint64_t> generation;
+    auto found = state_.sharedAccess(
+        [&](const State &state) -> std::optional<Lookup> {
+          if (not state.base) {
+            return std::nullopt;
+          }
+          common::Buffer key_buffer{key};
+          auto root = state_root;
+          // while the flat copy is written to another state, only its
+          // descendants read the same values before and after the write
+          auto moved = not state.moving_to.has_value();
+          // bounded, recorded diffs may form a cycle
+          for (size_t i = 0; root != *state.base; ++i) {
+            moved = moved or root == state.moving_to;
+            auto it = state.diffs.find(root);
+            if (it == state.diffs.end() or i == state.diffs.size()) {
+              return std::nullopt;
+            }
+            auto &[parent, diff, size] = *it->second;
+            if (auto entry = diff.find(key_buffer); entry != diff.end()) {
+              return Lookup{entry->second};
+            }
+            root = parent;
+          }
+          if (moved) {
+            generation = state.generation;
+          }
+          return std::nullopt;
+        });
+    if (not generation) {
+      return found;
+    }
+    // read without the lock, so disk reads don't stall writers
+    auto value = db_->tryGet(key);
+    auto unchanged = state_.sharedAccess([&](const State &state) {
+      return state.generation == *generation;
+    });
+    if (not unchanged) {
+      // the flat copy started changing, the value may be of other state
+      return std::nullopt;
+    }
+    if (not value) {
+      return Lookup{value.error()};
+    }
+    if (not value.value()) {
+      return Lookup{std::nullopt};
+    }
+    return Lookup{value.value()->intoBuffer()};
+  }
+
+  void FlatState::onBlockExecuted(primitives::BlockNumber number,
+                                  const RootHash &parent_root,
+                                  const RootHash &state_root,
+                                  Diff diff) {
+    if (parent_root == state_root) {
+      return;
+    }
+    size_t size = 0;
+    for (auto &[key, value] : diff) {
+      size += key.size() + (value ? value->size() : 0);
+    }
+    auto state_diff = std::make_shared<const StateDiff>(
+        StateDiff{parent_root, std::move(diff), size});
+    state_.exclusiveAccess([&](State &state) {
+      if (state.base == state_root) {
+        return;
+      }
+      if (state.diffs_size + size > max_diffs_size_) {
+        SL_DEBUG(logger_,
+                 "Unfinalized diffs take too much memory, state {} of block "
+                 "#{} is not recorded",
+                 state_root,
+                 number);
+        state.dropped = std::max(state.dropped.value_or(0), number);
+        return;
+      }
+      // the first recorded chain is kept to avoid cycles
+      if (state.diffs.try_emplace(state_root, std::move(state_diff)).second) {
+        state.diffs_size += size;
+      }
+    });
+  }
+
+  void FlatState::onFinalized(primitives::BlockNumber number,
+                              const RootHash &state_root) {
+    auto follow = state_.exclusiveAccess([&](State &state) {
+      state.finalized = std::make_pair(number, state_root);
+      // otherwise the following thread reaches the state
+      return not std::exchange(state.following, true);
+    });
+    if (follow) {
+      followFinalized(false);
+    }
+  }
+
+  outcome::result<void> FlatState::rebuild(const RootHash &state_root) {
+    SL_INFO(logger_, "Rebuild flat state at state {}", state_root);
+    state_.exclusiveAccess([&](State &state) {
+      state.base.reset();
+      ++state.generation;
+    });
+    OUTCOME_TRY(clear());
+
+    size_t total = 0;
+    std::optional<common::Buffer> last_key;
+    while (true) {
+      if (stop_) {
+        return Error::STOPPED;
+      }
+      // a fresh trie per chunk, so loaded nodes don't accumulate in memory
+      OUTCOME_TRY(trie, serializer_->retrieveTrie(state_root, nullptr));
+      PolkadotTrieCursorImpl cursor{trie};
+      if (last_key) {
+        OUTCOME_TRY(cursor.seekUpperBound(*last_key));
+      } else {
+        OUTCOME_TRY(cursor.next());
+      }
+      auto batch = db_->batch();
+      for (size_t i = 0; i < kRebuildChunk and cursor.isValid(); ++i) {
+        auto key = cursor.key().value();
+        auto value = cursor.value();
+        if (not value) {
+          return Error::VALUE_NOT_LOADED;
+        }
+        OUTCOME_TRY(batch->put(key, value->intoBuffer()));
+        last_key = std::move(key);
+        OUTCOME_TRY(cursor.next());
+      }
+      OUTCOME_TRY(batch->commit());
+      if (not cursor.isValid()) {
+        break;
+      }
+      total += kRebuildChunk;
+      SL_VERBOSE(logger_, "Flat state rebuild, {} entries written", total);
+    }
+    OUTCOME_TRY(
+        meta_->put(kFlatStateRootLookupKey, common::BufferView{state_root}));
+
+    state_.exclusiveAccess([&](State &state) {
+      state.base = state_root;
+      pruneDiffs(state);
+    });
+    SL_INFO(logger_, "Flat state rebuilt at state {}", state_root);
+    return outcome::success();
+  }
+
+  std::optional<RootHash> FlatState::baseRoot() const {
+    return state_.sharedAccess([](const State &state) { return state.base; });
+  }
+
+  std::optional<FlatState::Chain> FlatState::chain(
+      const State &state, const RootHash &state_root) {
+    if (not state.base) {
+      return std::nullopt;
+    }
+    Chain chain;
+    auto root = state_root;
+    while (root != *state.base) {
+      auto it = state.diffs.find(root);
+      if (it == state.diffs.end() or chain.size() == state.diffs.size()) {
+        return std::nullopt;
+      }
+      chain.emplace_back(it->second);
+      root = it->second->parent;
+    }
+    return chain;
+  }
+
+  void FlatState::followFinalized(bool on_rebuild_thread) {
+    enum class Step { kDone, kMove, kRebuild };
+    while (not stop_) {
+      RootHash target;
+      Chain diffs;
+      auto step = state_.exclusiveAccess([&](State &state) {
+        BOOST_ASSERT(state.following and state.finalized);
+        auto &[number, state_root] = *state.finalized;
+        target = state_root;
+        if (state.base == state_root) {
+          pruneDiffs(state);
+          state.following = false;
+          return Step::kDone;
+        }
+        if (auto found = chain(state, state_root)) {
+          diffs = std::move(*found);
+          state.moving_to = state_root;
+          ++state.generation;
+          return Step::kMove;
+        }
+        state.base.reset();
+        if (state.dropped and number <= *state.dropped) {
+          SL_DEBUG(logger_,
+                   "Flat state rebuild at state {} is postponed until import "
+                   "catches up with finality",
+                   state_root);
+          // finalized states are never read through diffs again
+          for (auto root = state_root; state.diffs.contains(root);) {
+            auto parent = state.diffs.at(root)->parent;
+            eraseDiff(state, root);
+            root = parent;
+          }
+          state.following = false;
+          return Step::kDone;
+        }
+        return Step::kRebuild;
+      });
+      if (step == Step::kDone) {
+        return;
+      }
+      if (step == Step::kRebuild) {
+        if (not on_rebuild_thread) {
+          startRebuild();
+          return;
+        }
+        if (auto r = rebuild(target); not r) {
+          SL_WARN(logger_,
+                  "Flat state rebuild at state {} failed: {}",
+                  target,
+                  r.error());
+          state_.exclusiveAccess([](State &state) { state.following = false; });
+          return;
+        }
+        continue;
+      }
+      // written without the lock, readers of other states use the trie
+      auto r = moveTo(target, diffs);
+      if (not r) {
+        SL_WARN(logger_,
+                "Can't move flat state to finalized state {}: {}",
+                target,
+                r.error());
+      }
+      auto done = state_.exclusiveAccess([&](State &state) {
+        state.moving_to.reset();
+        if (not r) {
+          // the flat copy is still at the base, next finalization retries
+          state.following = false;
+          return true;
+        }
+        state.base = target;
+        pruneDiffs(state);
+        return false;
+      });
+      if (done) {
+        return;
+      }
+    }
+  }
+
+  outcome::result<void> FlatState::moveTo(const RootHash &state_root,
+                                          const Chain &diffs) {
+    // oldest diffs first, so newer values override older ones
+    std::map<common::BufferView, const std::optional<common::Buffer> *>
+        changes;
+    for (auto it = diffs.rbegin(); it != diffs.rend(); ++it) {
+      for (auto &[key, value] : (*it)->diff) {
+        changes[key] = &value;
+      }
+    }
+
+    // the root is written with the entries, so it always matches them
+    auto batch = storage_->createBatch();
+    for (auto &[key, value] : changes) {
+      if (*value) {
+        OUTCOME_TRY(batch->put(
+            Space::kFlatState, key, common::BufferView{**value}));
+      } else {
+        OUTCOME_TRY(batch->remove(Space::kFlatState, key));
+      }
+    }
+    OUTCOME_TRY(batch->put(Space::kDefault,
+                           kFlatStateRootLookupKey,
+                           common::BufferView{state_root}));
+    OUTCOME_TRY(batch->commit());
+    SL_DEBUG(logger_,
+             "Flat state moved to state {}, {} entries changed",
+             state_root,
+             changes.size());
+    return outcome::success();
+  }
+
+  void FlatState::eraseDiff(State &state, const RootHash &state_root) {
+    if (auto it = state.diffs.find(state_root); it != state.diffs.end()) {
+      state.diffs_size -= it->second->size;
+      state.diffs.erase(it);
+    }
+  }
+
+  void FlatState::pruneDiffs(State &state) {
+    if (not state.base) {
+      state.diffs.clear();
+      state.diffs_size = 0;
+      return;
+    }
+    eraseDiff(state, *state.base);
+    // states which don't descend from the base are finalized or discarded
+    std::vector<RootHash> obsolete;
+    for (auto &[root, diff] : state.diffs) {
+      if (not chain(state, root)) {
+        obsolete.emplace_back(root);
+      }
+    }
+    for (auto &root : obsolete) {
+      eraseDiff(state, root);
+    }
+  }
+
+  void FlatState::startRebuild() {
+    if (rebuild_thread_.joinable()) {
+      // previous rebuild thread has stopped following, so it's finishing
+      rebuild_thread_.join();
+    }
+    rebuild_thread_ = std::thread{[this] {
+      soralog::util::setThreadName("flat_state");
+      followFinalized(true);
+    }};
+  }
+
+  outcome::result<void> FlatState::clear() {
+    OUTCOME_TRY(meta_->remove(kFlatStateRootLookupKey));
+    auto cursor = db_->cursor();
+    OUTCOME_TRY(cursor->seekFirst());
+    while (cursor->isValid()) {
+      auto batch = db_->batch();
+      for (size_t i = 0; i < kRebuildChunk and cursor->isValid(); ++i) {
+        OUTCOME_TRY(batch->remove(cursor->key().value()));
+        OUTCOME_TRY(cursor->next());
+      }
+      OUTCOME_TRY(batch->commit());
+    }
+    return outcome::success();
+  }
+
+}  // namespace kagome::storage::trie
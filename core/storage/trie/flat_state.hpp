@@ -0,0 +1,147 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <thread>
+#include <unordered_map>
+
+#include "log/logger.hpp"
+#include "primitives/event_types.hpp"
+#include "storage/spaced_storage.hpp"
+#include "storage/trie/serialization/trie_serializer.hpp"
+#include "utils/safe_object.hpp"
+
+namespace kagome::storage::trie {
+
+  /**
+   * Flat key/value copy of the main trie of the last finalized state, plus
+   * in-memory diffs of executed unfinalized states on top of it.
+   * Serves storage reads of covered states with a single database lookup
+   * instead of a trie walk, tries are still used for roots and proofs.
+   * A state is covered when a chain of recorded diffs leads from it to the
+   * flat copy, otherwise lookups fall back to the trie.
+   */
+  class FlatState {
+   public:
+    enum class Error {
+      STATE_NOT_COVERED = 1,
+      VALUE_NOT_LOADED,
+      STOPPED,
+    };
+
+    /// changed entries of a state, nullopt value means the entry was removed
+    using Diff = std::map<common::Buffer, std::optional<common::Buffer>>;
+    /// lookup result, nullopt means there is no such key in the state
+    using Lookup = outcome::result<std::optional<common::Buffer>>;
+
+    /// max total size of keys and values of unfinalized diffs in memory
+    static constexpr size_t kMaxDiffsSize = 256 << 20;
+    /// number of entries written or removed per batch and loaded per trie
+    /// during rebuild
+    static constexpr size_t kRebuildChunk = 1 << 16;
+
+    FlatState(std::shared_ptr<SpacedStorage> storage,
+              std::shared_ptr<TrieSerializer> serializer,
+              primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+              size_t max_diffs_size = kMaxDiffsSize);
+    ~FlatState();
+
+    /**
+     * @return value of the key in the state, nullopt if the state is not
+     * covered by the flat state
+     */
+    std::optional<Lookup> tryGet(const RootHash &state_root,
+                                 common::BufferView key) const;
+
+    /**
+     * Records main trie changes of an executed block
+     */
+    void onBlockExecuted(primitives::BlockNumber number,
+                         const RootHash &parent_root,
+                         const RootHash &state_root,
+                         Diff diff);
+
+    /**
+     * Moves the flat copy to the finalized state, schedules a background
+     * rebuild if the state is not covered. Rebuild is postponed while diffs
+     * of newer blocks are dropped, because import is far ahead of finality
+     * and the rebuilt copy couldn't follow it.
+     */
+    void onFinalized(primitives::BlockNumber number,
+                     const RootHash &state_root);
+
+    /**
+     * Replaces the flat copy with entries of the state loaded from the trie
+     */
+    outcome::result<void> rebuild(const RootHash &state_root);
+
+    /**
+     * @return state of the flat copy, nullopt if it is not built yet
+     */
+    std::optional<RootHash> baseRoot() const;
+
+   private:
+    struct StateDiff {
+      RootHash parent;
+      Diff diff;
+      size_t size;
+    };
+
+    struct State {
+      std::optional<RootHash> base;
+      std::unordered_map<RootHash, std::shared_ptr<const StateDiff>> diffs;
+      size_t diffs_size = 0;
+      /// newest block which diff was dropped because of the memory limit
+      std::optional<primitives::BlockNumber> dropped;
+      std::optional<std::pair<primitives::BlockNumber, RootHash>> finalized;
+      /// the flat copy is written to the state, base is changed after that
+      std::optional<RootHash> moving_to;
+      /// a thread follows finalized state, moving or rebuilding the flat copy
+      bool following = false;
+      /// incremented before the flat copy is written, database reads made
+      /// without the lock are dropped if it changed meanwhile
+      uint64_t generation = 0;
+    };
+
+    using Chain = std::vector<std::shared_ptr<const StateDiff>>;
+
+    /// @return diffs from the state down to the base, newest first
+    static std::optional<Chain> chain(const State &state,
+                                      const RootHash &state_root);
+
+    /**
+     * Moves or rebuilds the flat copy until it reaches the finalized state,
+     * must be called by the thread which set `State::following`
+     */
+    void followFinalized(bool on_rebuild_thread);
+    outcome::result<void> moveTo(const RootHash &state_root,
+                                 const Chain &diffs);
+    void eraseDiff(State &state, const RootHash &state_root);
+    void pruneDiffs(State &state);
+    // rebuild thread follows finalized state after the rebuild
+    void startRebuild();
+    outcome::result<void> clear();
+
+    std::shared_ptr<SpacedStorage> storage_;
+    std::shared_ptr<BufferStorage> db_;
+    std::shared_ptr<BufferStorage> meta_;
+    std::shared_ptr<TrieSerializer> serializer_;
+    primitives::events::ChainSub chain_sub_;
+    const size_t max_diffs_size_;
+
+    SafeObject<State> state_;
+    std::thread rebuild_thread_;
+    std::atomic_bool stop_ = false;
+
+    log::Logger logger_;
+  };
+
+}  // namespace kagome::storage::trie
+
+OUTCOME_HPP_DECLARE_ERROR(kagome::storage::trie, FlatState::Error);
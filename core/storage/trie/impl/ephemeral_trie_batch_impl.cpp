@@ -23,6 +23,7 @@ namespace kagome::storage::trie {
   outcome::result<std::tuple<bool, uint32_t>>
   EphemeralTrieBatchImpl::clearPrefix(const BufferView &prefix,
                                       std::optional<uint64_t> limit) {
+    onPrefixCleared(prefix);
     return trie_->clearPrefix(prefix, limit, [](const auto &, auto &&) {
       return outcome::success();
     });
@@ -30,10 +31,12 @@ namespace kagome::storage::trie {
 
   outcome::result<void> EphemeralTrieBatchImpl::put(const BufferView &key,
                                                     BufferOrView &&value) {
+    onModified(key);
     return trie_->put(key, std::move(value));
   }
 
   outcome::result<void> EphemeralTrieBatchImpl::remove(const BufferView &key) {
+    onModified(key);
     return trie_->remove(key);
   }
 
@@ -33,10 +33,12 @@ namespace kagome::storage::trie {
       std::shared_ptr<TrieSerializer> serializer,
       TrieChangesTrackerOpt changes,
       std::shared_ptr<PolkadotTrie> trie,
-      std::shared_ptr<storage::trie_pruner::TriePruner> state_pruner)
+      std::shared_ptr<storage::trie_pruner::TriePruner> state_pruner,
+      bool is_child)
       : TrieBatchBase{std::move(codec), std::move(serializer), std::move(trie)},
         changes_{std::move(changes)},
-        state_pruner_{std::move(state_pruner)} {
+        state_pruner_{std::move(state_pruner)},
+        is_child_{is_child} {
     BOOST_ASSERT((changes_.has_value() && changes_.value() != nullptr)
                  or not changes_.has_value());
     BOOST_ASSERT(state_pruner_ != nullptr);
@@ -45,8 +47,8 @@ namespace kagome::storage::trie {
   outcome::result<RootHash> PersistentTrieBatchImpl::commit(
       StateVersion version) {
     OUTCOME_TRY(commitChildren(version));
-    OUTCOME_TRY(state_pruner_->addNewState(*trie_, version));
-    OUTCOME_TRY(root, serializer_->storeTrie(*trie_, version));
+    OUTCOME_TRY(root,
+                state_pruner_->storeNewState(*trie_, version, *serializer_));
     SL_TRACE_FUNC_CALL(logger_, root);
     return root;
   }
@@ -55,10 +57,15 @@ namespace kagome::storage::trie {
   PersistentTrieBatchImpl::clearPrefix(const BufferView &prefix,
                                        std::optional<uint64_t> limit) {
     SL_TRACE_VOID_FUNC_CALL(logger_, prefix);
+    onPrefixCleared(prefix);
     return trie_->clearPrefix(
         prefix, limit, [&](const auto &key, auto &&) -> outcome::result<void> {
           if (changes_.has_value()) {
-            changes_.value()->onRemove(key);
+            if (is_child_) {
+              changes_.value()->onChildRemove(key);
+            } else {
+              changes_.value()->onRemove(key);
+            }
           }
           return outcome::success();
         });
@@ -69,20 +76,30 @@ namespace kagome::storage::trie {
     OUTCOME_TRY(contains, trie_->contains(key));
     bool is_new_entry = not contains;
     auto value_copy = value.mut();
+    onModified(key);
     auto res = trie_->put(key, std::move(value));
     if (res and changes_.has_value()) {
       SL_TRACE_VOID_FUNC_CALL(logger_, key, value_copy);
 
-      changes_.value()->onPut(key, value_copy, is_new_entry);
+      if (is_child_) {
+        changes_.value()->onChildPut(key, value_copy, is_new_entry);
+      } else {
+        changes_.value()->onPut(key, value_copy, is_new_entry);
+      }
     }
     return res;
   }
 
   outcome::result<void> PersistentTrieBatchImpl::remove(const BufferView &key) {
+    onModified(key);
     OUTCOME_TRY(trie_->remove(key));
     if (changes_.has_value()) {
       SL_TRACE_VOID_FUNC_CALL(logger_, key);
-      changes_.value()->onRemove(key);
+      if (is_child_) {
+        changes_.value()->onChildRemove(key);
+      } else {
+        changes_.value()->onRemove(key);
+      }
     }
     return outcome::success();
   }
@@ -92,7 +109,7 @@ namespace kagome::storage::trie {
   PersistentTrieBatchImpl::createFromTrieHash(const RootHash &trie_hash) {
     OUTCOME_TRY(trie, serializer_->retrieveTrie(trie_hash, nullptr));
     return std::make_unique<PersistentTrieBatchImpl>(
-        codec_, serializer_, changes_, trie, state_pruner_);
+        codec_, serializer_, changes_, trie, state_pruner_, true);
   }
 
 }  // namespace kagome::storage::trie
@@ -34,7 +34,8 @@ namespace kagome::storage::trie {
         std::shared_ptr<TrieSerializer> serializer,
         TrieChangesTrackerOpt changes,
         std::shared_ptr<PolkadotTrie> trie,
-        std::shared_ptr<storage::trie_pruner::TriePruner> state_pruner);
+        std::shared_ptr<storage::trie_pruner::TriePruner> state_pruner,
+        bool is_child = false);
     ~PersistentTrieBatchImpl() override = default;
 
     outcome::result<RootHash> commit(StateVersion version) override;
@@ -53,6 +54,7 @@ namespace kagome::storage::trie {
    private:
     TrieChangesTrackerOpt changes_;
     std::shared_ptr<storage::trie_pruner::TriePruner> state_pruner_;
+    bool is_child_;
   };
 
 }  // namespace kagome::storage::trie
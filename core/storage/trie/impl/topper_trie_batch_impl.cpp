@@ -6,9 +6,13 @@
 
 #include "storage/trie/impl/topper_trie_batch_impl.hpp"
 
+#include <algorithm>
+
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/assert.hpp>
 
 #include "common/buffer.hpp"
+#include "storage/trie/append_value.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_cursor.hpp"
 #include "storage/trie/polkadot_trie/trie_error.hpp"
 
@@ -23,7 +27,7 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::storage::trie,
       return "Topper trie batches do not support child trie batch creation";
     case E::COMMIT_NOT_SUPPORTED:
       return "Topper trie batches do not support committing changes, use "
-             "writeBack instead";
+             "apply instead";
     case E::CURSOR_NEXT_INVALID:
       return "TopperTrieCursor::next() called on invalid cursor";
     case E::CURSOR_SEEK_LAST_NOT_IMPLEMENTED:
@@ -51,11 +55,8 @@ namespace kagome::storage::trie {
 
   outcome::result<std::optional<BufferOrView>> TopperTrieBatchImpl::tryGet(
       const BufferView &key) const {
-    if (auto it = cache_.find(key); it != cache_.end()) {
-      if (it->second.has_value()) {
-        return BufferView{it->second.value()};
-      }
-      return std::nullopt;
+    if (auto it = changes_.find(key); it != changes_.end()) {
+      return valueOf(key, it->second);
     }
     if (auto p = parent_.lock(); p != nullptr) {
       return p->tryGet(key);
@@ -73,8 +74,8 @@ namespace kagome::storage::trie {
 
   outcome::result<bool> TopperTrieBatchImpl::contains(
       const BufferView &key) const {
-    if (auto it = cache_.find(key); it != cache_.end()) {
-      return it->second.has_value();
+    if (auto it = changes_.find(key); it != changes_.end()) {
+      return not isRemoved(it->second);
     }
     if (auto p = parent_.lock(); p != nullptr) {
       return p->contains(key);
@@ -84,22 +85,27 @@ namespace kagome::storage::trie {
 
   outcome::result<void> TopperTrieBatchImpl::put(const BufferView &key,
                                                  BufferOrView &&value) {
-    cache_.insert_or_assign(Buffer{key}, value.intoBuffer());
+    auto &version = current(key);
+    version.set = true;
+    version.value = value.intoBuffer();
+    version.appended.reset();
     return outcome::success();
   }
 
   outcome::result<void> TopperTrieBatchImpl::remove(const BufferView &key) {
-    cache_.insert_or_assign(Buffer{key}, std::nullopt);
-
+    auto &version = current(key);
+    version.set = true;
+    version.value.reset();
+    version.appended.reset();
     return outcome::success();
   }
 
   outcome::result<std::tuple<bool, uint32_t>> TopperTrieBatchImpl::clearPrefix(
       const BufferView &prefix, std::optional<uint64_t>) {
-    for (auto it = cache_.lower_bound(prefix);
-         it != cache_.end() && startsWith(it->first, prefix);
+    for (auto it = changes_.lower_bound(prefix);
+         it != changes_.end() && startsWith(it->first, prefix);
          ++it) {
-      it->second = std::nullopt;
+      OUTCOME_TRY(remove(it->first));
     }
 
     if (parent_.lock() != nullptr) {
@@ -108,20 +114,73 @@ namespace kagome::storage::trie {
     return Error::PARENT_EXPIRED;
   }
 
-  outcome::result<void> TopperTrieBatchImpl::writeBack() {
-    if (auto p = parent_.lock()) {
-      return apply(*p);
+  outcome::result<void> TopperTrieBatchImpl::append(const BufferView &key,
+                                                    BufferView encoded_items,
+                                                    size_t count) {
+    auto &version = current(key);
+    if (not version.appended) {
+      version.appended.emplace();
+    }
+    version.appended->append(encoded_items, count);
+    return outcome::success();
+  }
+
+  void TopperTrieBatchImpl::startTransaction() {
+    journal_.emplace_back();
+  }
+
+  void TopperTrieBatchImpl::rollbackTransaction() {
+    BOOST_ASSERT(not journal_.empty());
+    for (auto &key : journal_.back()) {
+      auto it = changes_.find(key);
+      BOOST_ASSERT(it != changes_.end());
+      it->second.pop_back();
+      if (it->second.empty()) {
+        changes_.erase(it);
+      }
+    }
+    journal_.pop_back();
+  }
+
+  void TopperTrieBatchImpl::commitTransaction() {
+    BOOST_ASSERT(not journal_.empty());
+    auto keys = std::move(journal_.back());
+    journal_.pop_back();
+    auto depth = journal_.size();
+    for (auto &key : keys) {
+      auto &versions = changes_.find(key)->second;
+      auto top = std::move(versions.back());
+      versions.pop_back();
+      top.depth = depth;
+      if (versions.empty() or versions.back().depth != depth) {
+        versions.emplace_back(std::move(top));
+        if (depth != 0) {
+          journal_.back().emplace_back(std::move(key));
+        }
+        continue;
+      }
+      auto &prev = versions.back();
+      if (top.set) {
+        prev = std::move(top);
+      } else if (not prev.appended) {
+        prev.appended = std::move(top.appended);
+      } else {
+        // only items appended in transaction are copied
+        prev.appended->append(top.appended->items, top.appended->count);
+      }
     }
-    return Error::PARENT_EXPIRED;
   }
 
   outcome::result<void> TopperTrieBatchImpl::apply(
       storage::BufferStorage &map) {
-    for (auto &[k, v] : cache_) {
-      if (v) {
-        OUTCOME_TRY(map.put(k, BufferView{*v}));
+    // may be applied more than once, and appending twice is not idempotent
+    OUTCOME_TRY(detachFromParent());
+    for (auto &[key, versions] : changes_) {
+      OUTCOME_TRY(value, valueOf(key, versions));
+      if (value) {
+        OUTCOME_TRY(map.put(key, std::move(*value)));
       } else {
-        OUTCOME_TRY(map.remove(k));
+        OUTCOME_TRY(map.remove(key));
       }
     }
     return outcome::success();
@@ -136,16 +195,104 @@ namespace kagome::storage::trie {
     return Error::CHILD_BATCH_NOT_SUPPORTED;
   }
 
+  TopperTrieBatchImpl::Version &TopperTrieBatchImpl::current(
+      const BufferView &key) {
+    auto &versions = changes_[Buffer{key}];
+    auto depth = journal_.size();
+    if (versions.empty() or versions.back().depth != depth) {
+      if (depth != 0) {
+        journal_.back().emplace_back(key);
+      }
+      versions.emplace_back().depth = depth;
+    }
+    return versions.back();
+  }
+
+  outcome::result<std::optional<BufferOrView>> TopperTrieBatchImpl::valueOf(
+      const BufferView &key, const Versions &versions) const {
+    // last version which sets value, items are appended by it and later ones
+    auto first = versions.end();
+    while (first != versions.begin()) {
+      --first;
+      if (first->set) {
+        break;
+      }
+    }
+    std::optional<BufferOrView> base;
+    if (first->set) {
+      if (first->value) {
+        base.emplace(BufferView{*first->value});
+      }
+    } else if (auto p = parent_.lock(); p != nullptr) {
+      OUTCOME_TRY(parent_value, p->tryGet(key));
+      base = std::move(parent_value);
+    } else {
+      return Error::PARENT_EXPIRED;
+    }
+    auto appended = std::any_of(first, versions.end(), [](const Version &v) {
+      return v.appended.has_value();
+    });
+    if (not appended) {
+      return std::move(base);
+    }
+    AppendValue value;
+    if (base) {
+      auto decoded = AppendValue::decode(base->view());
+      if (not decoded) {
+        // append to non-vector value is ignored
+        return std::move(base);
+      }
+      value = std::move(decoded.value());
+    }
+    for (auto it = first; it != versions.end(); ++it) {
+      if (it->appended) {
+        value.append(it->appended->items, it->appended->count);
+      }
+    }
+    return BufferOrView{value.encode()};
+  }
+
+  bool TopperTrieBatchImpl::isRemoved(const Versions &versions) {
+    for (auto it = versions.rbegin(); it != versions.rend(); ++it) {
+      if (it->appended) {
+        return false;
+      }
+      if (it->set) {
+        return not it->value;
+      }
+    }
+    return false;
+  }
+
+  outcome::result<void> TopperTrieBatchImpl::detachFromParent() {
+    auto p = parent_.lock();
+    if (p == nullptr) {
+      return Error::PARENT_EXPIRED;
+    }
+    for (auto &[key, versions] : changes_) {
+      auto &first = versions.front();
+      if (first.set) {
+        continue;
+      }
+      OUTCOME_TRY(value, p->tryGet(key));
+      first.set = true;
+      if (value) {
+        first.value = value->intoBuffer();
+      }
+    }
+    return outcome::success();
+  }
+
   TopperTrieCursor::TopperTrieCursor(std::shared_ptr<TopperTrieBatchImpl> batch,
                                      std::unique_ptr<PolkadotTrieCursor> cursor)
       : parent_batch_{std::move(batch)},
         parent_cursor_{std::move(cursor)},
-        overlay_it_{parent_batch_->cache_.end()} {}
+        overlay_it_{parent_batch_->changes_.end()} {}
 
   outcome::result<bool> TopperTrieCursor::seekFirst() {
     OUTCOME_TRY(parent_cursor_->seekFirst());
     cached_parent_key_ = parent_cursor_->key();
-    overlay_it_ = parent_batch_->cache_.begin();
+    overlay_it_ = parent_batch_->changes_.begin();
     choose();
     OUTCOME_TRY(skipRemoved());
     return outcome::success();
@@ -179,15 +326,22 @@ namespace kagome::storage::trie {
   }
 
   std::optional<BufferOrView> TopperTrieCursor::value() const {
-    return choice_.overlay ? Buffer{*overlay_it_->second}
-                           : parent_cursor_->value();
+    if (not choice_.overlay) {
+      return parent_cursor_->value();
+    }
+    auto value =
+        parent_batch_->valueOf(overlay_it_->first, overlay_it_->second);
+    if (not value or not value.value()) {
+      return std::nullopt;
+    }
+    return value.value()->intoBuffer();
   }
 
   outcome::result<void> TopperTrieCursor::seekLowerBound(
       const BufferView &key) {
     OUTCOME_TRY(parent_cursor_->seekLowerBound(key));
     cached_parent_key_ = parent_cursor_->key();
-    overlay_it_ = parent_batch_->cache_.lower_bound(key);
+    overlay_it_ = parent_batch_->changes_.lower_bound(key);
     choose();
     OUTCOME_TRY(skipRemoved());
     return outcome::success();
@@ -197,14 +351,14 @@ namespace kagome::storage::trie {
       const BufferView &key) {
     OUTCOME_TRY(parent_cursor_->seekUpperBound(key));
     cached_parent_key_ = parent_cursor_->key();
-    overlay_it_ = parent_batch_->cache_.upper_bound(key);
+    overlay_it_ = parent_batch_->changes_.upper_bound(key);
     choose();
     OUTCOME_TRY(skipRemoved());
     return outcome::success();
   }
 
   void TopperTrieCursor::choose() {
-    if (overlay_it_ != parent_batch_->cache_.end()
+    if (overlay_it_ != parent_batch_->changes_.end()
         and (not cached_parent_key_
              or *cached_parent_key_ >= overlay_it_->first)) {
       choice_ = Choice{cached_parent_key_ == overlay_it_->first, true};
@@ -222,7 +376,7 @@ namespace kagome::storage::trie {
       return false;
     }
     if (choice_.overlay) {
-      return not overlay_it_->second;
+      return TopperTrieBatchImpl::isRemoved(overlay_it_->second);
     }
     return false;
   }
@@ -13,6 +13,13 @@
 #include "outcome/outcome.hpp"
 
 namespace kagome::storage::trie {
+  /**
+   * Changes on top of parent batch, with nested transactions used by runtime.
+   * Each changed key keeps stack of versions, one per transaction depth
+   * which changed it, and each open transaction keeps journal of keys it
+   * changed. So reads don't walk transactions, and commit or rollback of
+   * transaction only touches keys changed in it.
+   */
   class TopperTrieBatchImpl final
       : public TrieBatch,
         public std::enable_shared_from_this<TopperTrieBatchImpl> {
@@ -40,18 +47,59 @@ namespace kagome::storage::trie {
     outcome::result<void> remove(const BufferView &key) override;
     outcome::result<std::tuple<bool, uint32_t>> clearPrefix(
         const BufferView &prefix, std::optional<uint64_t> limit) override;
+    outcome::result<void> append(const BufferView &key,
+                                 BufferView encoded_items,
+                                 size_t count) override;
+
+    /// Starts nested transaction
+    void startTransaction();
 
-    outcome::result<void> writeBack();
+    /// Discards changes of innermost transaction
+    void rollbackTransaction();
+
+    /// Moves changes of innermost transaction to enclosing one
+    void commitTransaction();
+
+    /// Number of open transactions
+    size_t transactionDepth() const {
+      return journal_.size();
+    }
 
     virtual outcome::result<RootHash> commit(StateVersion version) override;
 
     virtual outcome::result<std::optional<std::shared_ptr<TrieBatch>>>
     createChildBatch(common::BufferView path) override;
 
+    /// Writes changes to storage, appends are written as whole values
     outcome::result<void> apply(storage::BufferStorage &map);
 
    private:
-    std::map<Buffer, std::optional<Buffer>> cache_;
+    struct Version {
+      size_t depth = 0;
+      /// `value` replaces previous value, otherwise only items are appended
+      bool set = false;
+      /// nullopt if removed
+      std::optional<Buffer> value;
+      /// items appended after value
+      std::optional<AppendValue> appended;
+    };
+    using Versions = std::vector<Version>;
+
+    /// Version of key at current depth, created if needed
+    Version &current(const BufferView &key);
+
+    outcome::result<std::optional<BufferOrView>> valueOf(
+        const BufferView &key, const Versions &versions) const;
+
+    static bool isRemoved(const Versions &versions);
+
+    /// Stores parent values of appended keys, so changes may be applied
+    /// to parent more than once
+    outcome::result<void> detachFromParent();
+
+    std::map<Buffer, Versions> changes_;
+    /// keys changed in each open transaction
+    std::vector<std::vector<Buffer>> journal_;
     std::weak_ptr<TrieBatch> parent_;
 
     friend class TopperTrieCursor;
@@ -99,7 +147,7 @@ namespace kagome::storage::trie {
     std::shared_ptr<TopperTrieBatchImpl> parent_batch_;
     std::unique_ptr<PolkadotTrieCursor> parent_cursor_;
     std::optional<Buffer> cached_parent_key_;
-    decltype(TopperTrieBatchImpl::cache_)::iterator overlay_it_;
+    decltype(TopperTrieBatchImpl::changes_)::iterator overlay_it_;
     Choice choice_{false, false};
   };
 }  // namespace kagome::storage::trie
@@ -8,6 +8,7 @@
 
 #include "storage/trie/polkadot_trie/polkadot_trie.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_cursor_impl.hpp"
+#include "storage/trie/polkadot_trie/trie_error.hpp"
 
 #include <iostream>
 
@@ -26,11 +27,25 @@ namespace kagome::storage::trie {
 
   outcome::result<BufferOrView> TrieBatchBase::get(
       const BufferView &key) const {
+    if (auto lookup = flatTryGet(key)) {
+      OUTCOME_TRY(value, std::move(*lookup));
+      if (not value) {
+        return TrieError::NO_VALUE;
+      }
+      return BufferOrView{std::move(*value)};
+    }
     return trie_->get(key);
   }
 
   outcome::result<std::optional<BufferOrView>> TrieBatchBase::tryGet(
       const BufferView &key) const {
+    if (auto lookup = flatTryGet(key)) {
+      OUTCOME_TRY(value, std::move(*lookup));
+      if (not value) {
+        return std::nullopt;
+      }
+      return BufferOrView{std::move(*value)};
+    }
     return trie_->tryGet(key);
   }
 
@@ -39,6 +54,10 @@ namespace kagome::storage::trie {
   }
 
   outcome::result<bool> TrieBatchBase::contains(const BufferView &key) const {
+    if (auto lookup = flatTryGet(key)) {
+      OUTCOME_TRY(value, std::move(*lookup));
+      return value.has_value();
+    }
     return trie_->contains(key);
   }
 
@@ -72,4 +91,45 @@ namespace kagome::storage::trie {
     return outcome::success();
   }
 
+  void TrieBatchBase::setFlatState(std::shared_ptr<const FlatState> flat_state,
+                                   const RootHash &state_root) {
+    flat_state_ = std::move(flat_state);
+    flat_state_root_ = state_root;
+    modified_.clear();
+    cleared_prefixes_.clear();
+  }
+
+  void TrieBatchBase::onModified(const BufferView &key) {
+    if (flat_state_ != nullptr) {
+      modified_.emplace(key);
+    }
+  }
+
+  void TrieBatchBase::onPrefixCleared(const BufferView &prefix) {
+    if (flat_state_ == nullptr) {
+      return;
+    }
+    if (cleared_prefixes_.size() == kMaxClearedPrefixes) {
+      // checking every read against many prefixes costs more than the trie
+      flat_state_.reset();
+      return;
+    }
+    cleared_prefixes_.emplace_back(prefix);
+  }
+
+  std::optional<FlatState::Lookup> TrieBatchBase::flatTryGet(
+      const BufferView &key) const {
+    if (flat_state_ == nullptr
+        or (not modified_.empty()
+            and modified_.contains(common::Buffer{key}))) {
+      return std::nullopt;
+    }
+    for (auto &prefix : cleared_prefixes_) {
+      if (startsWith(key, prefix)) {
+        return std::nullopt;
+      }
+    }
+    return flat_state_->tryGet(flat_state_root_, key);
+  }
+
 }  // namespace kagome::storage::trie
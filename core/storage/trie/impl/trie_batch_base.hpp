@@ -8,10 +8,13 @@
 
 #include "storage/trie/trie_batches.hpp"
 
+#include <unordered_set>
+
 #include <boost/range.hpp>
 #include <boost/range/adaptors.hpp>
 
 #include "log/logger.hpp"
+#include "storage/trie/flat_state.hpp"
 #include "storage/trie/serialization/trie_serializer.hpp"
 
 namespace kagome::storage::trie {
@@ -39,12 +42,24 @@ namespace kagome::storage::trie {
     virtual outcome::result<std::optional<std::shared_ptr<TrieBatch>>>
     createChildBatch(common::BufferView path) override;
 
+    /**
+     * Serves reads of keys not modified by the batch from the flat state,
+     * the trie must be at the state when the flat state is set
+     */
+    void setFlatState(std::shared_ptr<const FlatState> flat_state,
+                      const RootHash &state_root);
+
    protected:
     virtual outcome::result<std::unique_ptr<TrieBatchBase>> createFromTrieHash(
         const RootHash &trie_hash) = 0;
 
     outcome::result<void> commitChildren(StateVersion version);
 
+    /// stop reading the key from the flat state
+    void onModified(const BufferView &key);
+    /// stop reading keys with the prefix from the flat state
+    void onPrefixCleared(const BufferView &prefix);
+
     log::Logger logger_ = log::createLogger("TrieBatch", "storage");
 
     std::shared_ptr<Codec> codec_;
@@ -52,8 +67,17 @@ namespace kagome::storage::trie {
     std::shared_ptr<PolkadotTrie> trie_;
 
    private:
+    static constexpr size_t kMaxClearedPrefixes = 16;
+
+    std::optional<FlatState::Lookup> flatTryGet(const BufferView &key) const;
+
     std::unordered_map<common::Buffer, std::shared_ptr<TrieBatchBase>>
         child_batches_;
+
+    std::shared_ptr<const FlatState> flat_state_;
+    RootHash flat_state_root_;
+    std::unordered_set<common::Buffer> modified_;
+    std::vector<common::Buffer> cleared_prefixes_;
   };
 
 }  // namespace kagome::storage::trie
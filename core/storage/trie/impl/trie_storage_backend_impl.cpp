@@ -43,6 +43,11 @@ namespace kagome::storage::trie {
     return storage_->contains(key);
   }
 
+  outcome::result<std::vector<std::optional<BufferOrView>>>
+  TrieStorageBackendImpl::multiGet(std::span<const BufferView> keys) const {
+    return storage_->multiGet(keys);
+  }
+
   outcome::result<void> TrieStorageBackendImpl::put(const BufferView &key,
                                                     BufferOrView &&value) {
     return storage_->put(key, std::move(value));
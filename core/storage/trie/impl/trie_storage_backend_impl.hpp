@@ -26,6 +26,8 @@ namespace kagome::storage::trie {
     outcome::result<std::optional<BufferOrView>> tryGet(
         const BufferView &key) const override;
     outcome::result<bool> contains(const BufferView &key) const override;
+    outcome::result<std::vector<std::optional<BufferOrView>>> multiGet(
+        std::span<const BufferView> keys) const override;
 
     outcome::result<void> put(const BufferView &key,
                               BufferOrView &&value) override;
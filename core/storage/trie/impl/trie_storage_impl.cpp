@@ -19,31 +19,41 @@ namespace kagome::storage::trie {
       const std::shared_ptr<PolkadotTrieFactory> &trie_factory,
       std::shared_ptr<Codec> codec,
       std::shared_ptr<TrieSerializer> serializer,
-      std::shared_ptr<storage::trie_pruner::TriePruner> state_pruner) {
+      std::shared_ptr<storage::trie_pruner::TriePruner> state_pruner,
+      std::shared_ptr<const FlatState> flat_state) {
     // will never be used, so content of the callback doesn't matter
     auto empty_trie = trie_factory->createEmpty();
     // ensure retrieval of empty trie succeeds
     OUTCOME_TRY(serializer->storeTrie(*empty_trie, StateVersion::V0));
-    return std::unique_ptr<TrieStorageImpl>(new TrieStorageImpl(
-        std::move(codec), std::move(serializer), std::move(state_pruner)));
+    return std::unique_ptr<TrieStorageImpl>(
+        new TrieStorageImpl(std::move(codec),
+                            std::move(serializer),
+                            std::move(state_pruner),
+                            std::move(flat_state)));
   }
 
   outcome::result<std::unique_ptr<TrieStorageImpl>>
   TrieStorageImpl::createFromStorage(
       std::shared_ptr<Codec> codec,
       std::shared_ptr<TrieSerializer> serializer,
-      std::shared_ptr<storage::trie_pruner::TriePruner> state_pruner) {
-    return std::unique_ptr<TrieStorageImpl>(new TrieStorageImpl(
-        std::move(codec), std::move(serializer), std::move(state_pruner)));
+      std::shared_ptr<storage::trie_pruner::TriePruner> state_pruner,
+      std::shared_ptr<const FlatState> flat_state) {
+    return std::unique_ptr<TrieStorageImpl>(
+        new TrieStorageImpl(std::move(codec),
+                            std::move(serializer),
+                            std::move(state_pruner),
+                            std::move(flat_state)));
   }
 
   TrieStorageImpl::TrieStorageImpl(
       std::shared_ptr<Codec> codec,
       std::shared_ptr<TrieSerializer> serializer,
-      std::shared_ptr<storage::trie_pruner::TriePruner> state_pruner)
+      std::shared_ptr<storage::trie_pruner::TriePruner> state_pruner,
+      std::shared_ptr<const FlatState> flat_state)
       : codec_{std::move(codec)},
         serializer_{std::move(serializer)},
         state_pruner_{std::move(state_pruner)},
+        flat_state_{std::move(flat_state)},
         logger_{log::createLogger("TrieStorage", "storage")} {
     BOOST_ASSERT(codec_ != nullptr);
     BOOST_ASSERT(state_pruner_ != nullptr);
@@ -57,16 +67,24 @@ namespace kagome::storage::trie {
              "Initialize persistent trie batch with root: {}",
              root.toHex());
     OUTCOME_TRY(trie, serializer_->retrieveTrie(root, nullptr));
-    return std::make_unique<PersistentTrieBatchImpl>(
+    auto batch = std::make_unique<PersistentTrieBatchImpl>(
         codec_, serializer_, changes_tracker, std::move(trie), state_pruner_);
+    if (flat_state_ != nullptr) {
+      batch->setFlatState(flat_state_, root);
+    }
+    return batch;
   }
 
   outcome::result<std::unique_ptr<TrieBatch>>
   TrieStorageImpl::getEphemeralBatchAt(const RootHash &root) const {
     SL_DEBUG(logger_, "Initialize ephemeral trie batch with root: {}", root);
     OUTCOME_TRY(trie, serializer_->retrieveTrie(root, nullptr));
-    return std::make_unique<EphemeralTrieBatchImpl>(
+    auto batch = std::make_unique<EphemeralTrieBatchImpl>(
         codec_, std::move(trie), serializer_, nullptr);
+    if (flat_state_ != nullptr) {
+      batch->setFlatState(flat_state_, root);
+    }
+    return batch;
   }
 
   outcome::result<std::unique_ptr<TrieBatch>>
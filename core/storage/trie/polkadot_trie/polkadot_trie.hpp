@@ -31,16 +31,26 @@ namespace kagome::storage::trie {
     using ValueRetrieveFunction =
         std::function<outcome::result<std::optional<common::Buffer>>(
             const common::Hash256 & /* value hash */)>;
+    /**
+     * Replaces dummy children of a branch with the actual nodes, loading them
+     * in one batch
+     */
+    using ChildrenPrefetchFunction =
+        std::function<outcome::result<void>(BranchNode &)>;
 
     struct RetrieveFunctions {
       RetrieveFunctions()
           : retrieve_node{defaultNodeRetrieve},
-            retrieve_value{defaultValueRetrieve} {}
+            retrieve_value{defaultValueRetrieve},
+            prefetch_children{defaultChildrenPrefetch} {}
 
       RetrieveFunctions(NodeRetrieveFunction retrieve_node,
-                        ValueRetrieveFunction retrieve_value)
+                        ValueRetrieveFunction retrieve_value,
+                        ChildrenPrefetchFunction prefetch_children =
+                            defaultChildrenPrefetch)
           : retrieve_node{std::move(retrieve_node)},
-            retrieve_value{std::move(retrieve_value)} {}
+            retrieve_value{std::move(retrieve_value)},
+            prefetch_children{std::move(prefetch_children)} {}
 
       inline static outcome::result<NodePtr> defaultNodeRetrieve(
           const std::shared_ptr<OpaqueTrieNode> &node) {
@@ -56,8 +66,14 @@ namespace kagome::storage::trie {
         return TrieError::VALUE_RETRIEVE_NOT_PROVIDED;
       }
 
+      inline static outcome::result<void> defaultChildrenPrefetch(
+          BranchNode &) {
+        return outcome::success();
+      }
+
       NodeRetrieveFunction retrieve_node;
       ValueRetrieveFunction retrieve_value;
+      ChildrenPrefetchFunction prefetch_children;
     };
 
     /**
@@ -96,6 +112,13 @@ namespace kagome::storage::trie {
     virtual outcome::result<NodePtr> retrieveChild(const BranchNode &parent,
                                                    uint8_t idx) = 0;
 
+    /**
+     * Loads all children of \arg parent which are not retrieved yet at once,
+     * used before visiting the whole subtree
+     */
+    virtual outcome::result<void> prefetchChildren(
+        const BranchNode &parent) const = 0;
+
     /**
      * Retrieve value from hash if value is not present.
      */
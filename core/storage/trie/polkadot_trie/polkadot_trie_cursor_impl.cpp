@@ -63,6 +63,7 @@ namespace kagome::storage::trie {
 
   outcome::result<bool> PolkadotTrieCursorImpl::seekFirst() {
     state_ = UninitializedState{};
+    nexts_since_seek_ = 0;
     SAFE_VOID_CALL(next())
     return isValid();
   }
@@ -74,6 +75,7 @@ namespace kagome::storage::trie {
   }
 
   outcome::result<bool> PolkadotTrieCursorImpl::seekLast() {
+    nexts_since_seek_ = 0;
     auto *current = trie_->getRoot().get();
     if (current == nullptr) {
       state_ = UninitializedState{};
@@ -176,6 +178,7 @@ namespace kagome::storage::trie {
 
   outcome::result<void> PolkadotTrieCursorImpl::seekLowerBound(
       const common::BufferView &key) {
+    nexts_since_seek_ = 0;
     if (trie_->getRoot() == nullptr) {
       SL_TRACE(log_, "Seek lower bound for {} -> null root", key);
       state_ = UninitializedState{};
@@ -240,6 +243,11 @@ namespace kagome::storage::trie {
                                                uint8_t min_idx) {
     BOOST_ASSERT(std::holds_alternative<SearchState>(state_));
     auto &search_state = std::get<SearchState>(state_);
+    if (min_idx == 0 and nexts_since_seek_ > 1) {
+      // iterating a range, children of the subtree will be visited in order
+      OUTCOME_TRY(trie_->prefetchChildren(
+          dynamic_cast<const BranchNode &>(parent)));
+    }
     for (uint8_t i = min_idx; i < BranchNode::kMaxChildren; i++) {
       auto &branch = dynamic_cast<const BranchNode &>(parent);
       if (branch.children.at(i)) {
@@ -264,6 +272,7 @@ namespace kagome::storage::trie {
     if (trie_->getRoot() == nullptr) {
       return outcome::success();
     }
+    ++nexts_since_seek_;
 
     if (key().has_value()) {
       SL_TRACE(log_, "Searching next key, current is {}", key().value());
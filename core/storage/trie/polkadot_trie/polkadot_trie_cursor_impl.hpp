@@ -176,6 +176,10 @@ namespace kagome::storage::trie {
     using CursorState = std::
         variant<UninitializedState, SearchState, InvalidState, ReachedEndState>;
     CursorState state_;
+
+    /// next() calls since the last seek, from the second one the cursor
+    /// iterates a range and prefetches children of the branches it enters
+    size_t nexts_since_seek_ = 0;
   };
 
 }  // namespace kagome::storage::trie
@@ -27,20 +27,24 @@ namespace kagome::storage::trie {
 
   class OpaqueNodeStorage final {
    public:
-    OpaqueNodeStorage(PolkadotTrie::NodeRetrieveFunction node_retriever,
-                      PolkadotTrie::ValueRetrieveFunction value_retriever,
-                      std::shared_ptr<TrieNode> root)
+    OpaqueNodeStorage(
+        PolkadotTrie::NodeRetrieveFunction node_retriever,
+        PolkadotTrie::ValueRetrieveFunction value_retriever,
+        PolkadotTrie::ChildrenPrefetchFunction children_prefetcher,
+        std::shared_ptr<TrieNode> root)
         : retrieve_node_{std::move(node_retriever)},
           retrieve_value_{std::move(value_retriever)},
+          prefetch_children_{std::move(children_prefetcher)},
           root_{std::move(root)} {}
 
     static outcome::result<std::unique_ptr<OpaqueNodeStorage>> createAt(
         std::shared_ptr<OpaqueTrieNode> root,
         PolkadotTrie::NodeRetrieveFunction node_retriever,
-        PolkadotTrie::ValueRetrieveFunction value_retriever) {
+        PolkadotTrie::ValueRetrieveFunction value_retriever,
+        PolkadotTrie::ChildrenPrefetchFunction children_prefetcher) {
       OUTCOME_TRY(root_node, node_retriever(root));
-      return std::unique_ptr<OpaqueNodeStorage>{
-          new OpaqueNodeStorage{node_retriever, value_retriever, root_node}};
+      return std::unique_ptr<OpaqueNodeStorage>{new OpaqueNodeStorage{
+          node_retriever, value_retriever, children_prefetcher, root_node}};
     }
 
     [[nodiscard]] const std::shared_ptr<TrieNode> &getRoot() {
@@ -77,8 +81,16 @@ namespace kagome::storage::trie {
       return child;
     }
 
+    [[nodiscard]] outcome::result<void> prefetchChildren(
+        const BranchNode &parent) const {
+      // SAFETY: same as in getChild, only opaque children are replaced
+      auto &mut_parent = const_cast<BranchNode &>(parent);
+      return prefetch_children_(mut_parent);
+    }
+
     PolkadotTrie::NodeRetrieveFunction retrieve_node_;
     PolkadotTrie::ValueRetrieveFunction retrieve_value_;
+    PolkadotTrie::ChildrenPrefetchFunction prefetch_children_;
     std::shared_ptr<TrieNode> root_;
   };
 }  // namespace kagome::storage::trie
@@ -228,6 +240,11 @@ namespace {
         // remove all children one by one according to limit
         if (parent->isBranch()) {
           auto &branch = dynamic_cast<BranchNode &>(*parent);
+          // without limit the whole subtree is going to be visited, with
+          // limit only few children may be loaded
+          if (not limit) {
+            OUTCOME_TRY(node_storage.prefetchChildren(branch));
+          }
           for (uint8_t child_idx = 0; child_idx < branch.kMaxChildren;
                child_idx++) {
             if (branch.children[child_idx] != nullptr) {
@@ -316,6 +333,7 @@ namespace kagome::storage::trie {
       : nodes_{std::make_unique<OpaqueNodeStorage>(
           std::move(retrieve_functions.retrieve_node),
           std::move(retrieve_functions.retrieve_value),
+          std::move(retrieve_functions.prefetch_children),
           nullptr)},
         logger_{log::createLogger("PolkadotTrie", "trie")} {}
 
@@ -324,6 +342,7 @@ namespace kagome::storage::trie {
       : nodes_{std::make_unique<OpaqueNodeStorage>(
           std::move(retrieve_functions.retrieve_node),
           std::move(retrieve_functions.retrieve_value),
+          std::move(retrieve_functions.prefetch_children),
           root)},
         logger_{log::createLogger("PolkadotTrie", "trie")} {}
 
@@ -602,6 +621,11 @@ namespace kagome::storage::trie {
     return nodes_->getChild(parent, idx);
   }
 
+  outcome::result<void> PolkadotTrieImpl::prefetchChildren(
+      const BranchNode &parent) const {
+    return nodes_->prefetchChildren(parent);
+  }
+
   outcome::result<void> PolkadotTrieImpl::retrieveValue(
       ValueAndHash &value) const {
     if (value.hash && !value.value) {
@@ -92,6 +92,9 @@ namespace kagome::storage::trie {
     outcome::result<NodePtr> retrieveChild(const BranchNode &parent,
                                            uint8_t idx) override;
 
+    outcome::result<void> prefetchChildren(
+        const BranchNode &parent) const override;
+
     outcome::result<void> retrieveValue(ValueAndHash &value) const override;
 
    private:
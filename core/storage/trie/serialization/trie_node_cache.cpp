@@ -0,0 +1,78 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/serialization/trie_node_cache.hpp"
+
+namespace {
+  constexpr auto trieNodeCacheHitsMetricName = "kagome_trie_node_cache_hits";
+  constexpr auto trieNodeCacheMissesMetricName =
+      "kagome_trie_node_cache_misses";
+}  // namespace
+
+namespace kagome::storage::trie {
+
+  TrieNodeCache::TrieNodeCache(size_t capacity) {
+    auto shard_capacity = std::max<size_t>(1, capacity / kShards);
+    for (auto &shard : shards_) {
+      shard = std::make_unique<Shard>(shard_capacity);
+    }
+
+    metrics_registry_->registerCounterFamily(
+        trieNodeCacheHitsMetricName,
+        "Number of trie node lookups served from the decoded node cache");
+    metric_hits_ =
+        metrics_registry_->registerCounterMetric(trieNodeCacheHitsMetricName);
+    metrics_registry_->registerCounterFamily(
+        trieNodeCacheMissesMetricName,
+        "Number of trie node lookups which had to decode a node from the "
+        "database");
+    metric_misses_ =
+        metrics_registry_->registerCounterMetric(trieNodeCacheMissesMetricName);
+  }
+
+  std::shared_ptr<TrieNode> TrieNodeCache::get(const MerkleHash &hash) {
+    auto node = shard(hash).exclusiveAccess(
+        [&](auto &lru) -> std::shared_ptr<const TrieNode> {
+          if (auto cached = lru.get(hash)) {
+            return cached->get();
+          }
+          return nullptr;
+        });
+    if (node == nullptr) {
+      metric_misses_->inc();
+      return nullptr;
+    }
+    metric_hits_->inc();
+    return clone(*node);
+  }
+
+  void TrieNodeCache::put(const MerkleHash &hash, const TrieNode &node) {
+    std::shared_ptr<const TrieNode> copy = clone(node);
+    shard(hash).exclusiveAccess(
+        [&](auto &lru) { lru.put(hash, std::move(copy)); });
+  }
+
+  size_t TrieNodeCache::size() {
+    size_t size = 0;
+    for (auto &shard : shards_) {
+      size += shard->exclusiveAccess([](auto &lru) { return lru.size(); });
+    }
+    return size;
+  }
+
+  std::shared_ptr<TrieNode> TrieNodeCache::clone(const TrieNode &node) {
+    if (node.isBranch()) {
+      return std::make_shared<BranchNode>(
+          static_cast<const BranchNode &>(node));
+    }
+    return std::make_shared<LeafNode>(static_cast<const LeafNode &>(node));
+  }
+
+  TrieNodeCache::Shard &TrieNodeCache::shard(const MerkleHash &hash) {
+    return *shards_[hash[0] % kShards];
+  }
+
+}  // namespace kagome::storage::trie
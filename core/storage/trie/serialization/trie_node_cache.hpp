@@ -0,0 +1,71 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+
+#include "metrics/metrics.hpp"
+#include "storage/trie/polkadot_trie/trie_node.hpp"
+#include "utils/lru.hpp"
+#include "utils/safe_object.hpp"
+
+namespace kagome::storage::trie {
+
+  /**
+   * Process-wide bounded cache of decoded trie nodes, keyed by node hash.
+   * Nodes are content-addressed, so an entry never becomes stale even if the
+   * node is pruned from the database.
+   * Cached nodes are immutable and shared between all tries. Every lookup
+   * returns a shallow private copy (children stay shared dummy nodes), so a
+   * trie may modify the returned node without affecting other readers.
+   */
+  class TrieNodeCache {
+   public:
+    static constexpr size_t kDefaultCapacity = 1 << 16;
+
+    /**
+     * @param capacity max number of cached nodes, must not be zero
+     */
+    explicit TrieNodeCache(size_t capacity = kDefaultCapacity);
+
+    /**
+     * @return private copy of the cached node or nullptr if absent
+     */
+    std::shared_ptr<TrieNode> get(const MerkleHash &hash);
+
+    /**
+     * Stores a copy of a freshly decoded node.
+     * Node children must be dummy nodes.
+     */
+    void put(const MerkleHash &hash, const TrieNode &node);
+
+    size_t size();
+
+    /**
+     * @return shallow copy of a node, children pointers are shared
+     */
+    static std::shared_ptr<TrieNode> clone(const TrieNode &node);
+
+   private:
+    static constexpr size_t kShards = 16;
+
+    using Shard =
+        SafeObject<Lru<MerkleHash, std::shared_ptr<const TrieNode>>,
+                   std::mutex>;
+
+    Shard &shard(const MerkleHash &hash);
+
+    std::array<std::unique_ptr<Shard>, kShards> shards_;
+
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    metrics::Counter *metric_hits_;
+    metrics::Counter *metric_misses_;
+  };
+
+}  // namespace kagome::storage::trie
@@ -35,6 +35,14 @@ namespace kagome::storage::trie {
     virtual outcome::result<RootHash> storeTrie(PolkadotTrie &trie,
                                                 StateVersion version) = 0;
 
+    /**
+     * Puts trie nodes to \param batch without committing it, so they are
+     * written together with other changes
+     */
+    virtual outcome::result<RootHash> storeTrie(PolkadotTrie &trie,
+                                                StateVersion version,
+                                                BufferWriteable &batch) = 0;
+
     /**
      * Fetches a trie from the storage. A nullptr is returned in case that there
      * is no entry for provided key.
@@ -6,21 +6,90 @@
 
 #include "storage/trie/serialization/trie_serializer_impl.hpp"
 
+#include <unordered_map>
+
 #include "common/monadic_utils.hpp"
 #include "outcome/outcome.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_factory.hpp"
 #include "storage/trie/polkadot_trie/trie_node.hpp"
 #include "storage/trie/serialization/codec.hpp"
+#include "storage/trie/serialization/trie_node_cache.hpp"
 #include "storage/trie/trie_storage_backend.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace {
+  using kagome::common::BufferOrView;
+  using kagome::common::Hash256;
+  using namespace kagome::storage::trie;
+
+  /// Levels of the trie encoded by the committing thread itself, subtrees
+  /// below them are encoded in parallel
+  constexpr size_t kParallelCommitDepth = 2;
+
+  using NodeWrites = std::vector<std::pair<Hash256, BufferOrView>>;
+
+  /// Dirty subtree encoded by a worker thread
+  struct SubtreeJob {
+    const TrieNode *node;
+    std::optional<MerkleValue> merkle_value{};
+    NodeWrites writes{};
+    outcome::result<void> result = outcome::success();
+  };
+
+  /// Collects dirty subtrees below the top levels of the trie
+  void collectSubtreeJobs(const BranchNode &branch,
+                          size_t depth,
+                          std::vector<SubtreeJob> &jobs) {
+    for (auto &child : branch.children) {
+      auto node = dynamic_cast<const TrieNode *>(child.get());
+      if (node == nullptr) {
+        continue;
+      }
+      if (node->isBranch() and depth + 1 < kParallelCommitDepth) {
+        collectSubtreeJobs(
+            static_cast<const BranchNode &>(*node), depth + 1, jobs);
+      } else {
+        jobs.emplace_back(SubtreeJob{node});
+      }
+    }
+  }
+
+  /// Copies top levels of the trie, replacing encoded subtrees with dummies
+  std::shared_ptr<BranchNode> substituteEncodedSubtrees(
+      const BranchNode &branch,
+      const std::unordered_map<const TrieNode *, MerkleValue> &encoded) {
+    auto copy = std::make_shared<BranchNode>(branch);
+    for (auto &child : copy->children) {
+      auto node = dynamic_cast<const TrieNode *>(child.get());
+      if (node == nullptr) {
+        continue;
+      }
+      if (auto it = encoded.find(node); it != encoded.end()) {
+        child = std::make_shared<DummyNode>(it->second);
+      } else {
+        child = substituteEncodedSubtrees(
+            static_cast<const BranchNode &>(*node), encoded);
+      }
+    }
+    return copy;
+  }
+}  // namespace
 
 namespace kagome::storage::trie {
   TrieSerializerImpl::TrieSerializerImpl(
       std::shared_ptr<PolkadotTrieFactory> factory,
       std::shared_ptr<Codec> codec,
-      std::shared_ptr<TrieStorageBackend> node_backend)
+      std::shared_ptr<TrieStorageBackend> node_backend,
+      std::shared_ptr<TrieNodeCache> node_cache,
+      std::shared_ptr<ThreadPool> commit_pool,
+      size_t commit_threads)
       : trie_factory_{std::move(factory)},
         codec_{std::move(codec)},
-        node_backend_{std::move(node_backend)} {
+        node_backend_{std::move(node_backend)},
+        node_cache_{std::move(node_cache)},
+        commit_pool_{std::move(commit_pool)},
+        commit_threads_{commit_pool_ ? std::max<size_t>(1, commit_threads)
+                                     : 1} {
     BOOST_ASSERT(trie_factory_ != nullptr);
     BOOST_ASSERT(codec_ != nullptr);
     BOOST_ASSERT(node_backend_ != nullptr);
@@ -32,10 +101,19 @@ namespace kagome::storage::trie {
 
   outcome::result<RootHash> TrieSerializerImpl::storeTrie(
       PolkadotTrie &trie, StateVersion version) {
+    auto batch = node_backend_->batch();
+    BOOST_ASSERT(batch != nullptr);
+    OUTCOME_TRY(root, storeTrie(trie, version, *batch));
+    OUTCOME_TRY(batch->commit());
+    return root;
+  }
+
+  outcome::result<RootHash> TrieSerializerImpl::storeTrie(
+      PolkadotTrie &trie, StateVersion version, BufferWriteable &batch) {
     if (trie.getRoot() == nullptr) {
       return getEmptyRootHash();
     }
-    return storeRootNode(*trie.getRoot(), version);
+    return storeRootNode(*trie.getRoot(), version, batch);
   }
 
   outcome::result<std::shared_ptr<PolkadotTrie>>
@@ -53,32 +131,43 @@ namespace kagome::storage::trie {
       OUTCOME_TRY(value, retrieveValue(hash, on_node_loaded));
       return value;
     };
+    PolkadotTrie::ChildrenPrefetchFunction p =
+        [this, on_node_loaded](BranchNode &parent) -> outcome::result<void> {
+      return prefetchChildren(parent, on_node_loaded);
+    };
     if (db_key == getEmptyRootHash()) {
-      return trie_factory_->createEmpty(
-          PolkadotTrie::RetrieveFunctions{std::move(f), std::move(v)});
+      return trie_factory_->createEmpty(PolkadotTrie::RetrieveFunctions{
+          std::move(f), std::move(v), std::move(p)});
     }
     OUTCOME_TRY(root, retrieveNode(db_key, on_node_loaded));
     return trie_factory_->createFromRoot(
         std::move(root),
-        PolkadotTrie::RetrieveFunctions{std::move(f), std::move(v)});
+        PolkadotTrie::RetrieveFunctions{
+            std::move(f), std::move(v), std::move(p)});
   }
 
   outcome::result<RootHash> TrieSerializerImpl::storeRootNode(
-      TrieNode &node, StateVersion version) {
-    auto batch = node_backend_->batch();
-    BOOST_ASSERT(batch != nullptr);
+      TrieNode &node, StateVersion version, BufferWriteable &batch) {
+    // copy of the top of the trie with encoded subtrees substituted
+    std::shared_ptr<TrieNode> top;
+    if (commit_threads_ > 1 and node.isBranch()) {
+      OUTCOME_TRY(substituted,
+                  storeSubtreesParallel(
+                      static_cast<const BranchNode &>(node), version, batch));
+      top = std::move(substituted);
+    }
 
     OUTCOME_TRY(
         enc,
         codec_->encodeNode(
-            node,
+            top != nullptr ? *top : node,
             version,
             [&](Codec::Visitee visitee) -> outcome::result<void> {
               if (auto child_data = std::get_if<Codec::ChildData>(&visitee);
                   child_data != nullptr) {
                 if (child_data->merkle_value.isHash()) {
-                  return batch->put(child_data->merkle_value.asBuffer(),
-                                    std::move(child_data->encoding));
+                  return batch.put(child_data->merkle_value.asBuffer(),
+                                   std::move(child_data->encoding));
                 } else {
                   return outcome::success();  // nodes which encoding is shorter
                                               // than its hash are not stored in
@@ -86,17 +175,72 @@ namespace kagome::storage::trie {
                 }
               }
               auto value_data = std::get<Codec::ValueData>(visitee);
+              if (top != nullptr) {
+                // substituted top is destroyed before caller commits batch
+                return batch.put(value_data.hash,
+                                 common::Buffer{value_data.value});
+              }
               // value_data.value is a reference to a buffer stored outside of
               // this lambda, so taking its view should be okay
-              return batch->put(value_data.hash, value_data.value.view());
+              return batch.put(value_data.hash, value_data.value.view());
             }));
     auto hash = codec_->hash256(enc);
-    OUTCOME_TRY(batch->put(hash, std::move(enc)));
-    OUTCOME_TRY(batch->commit());
+    OUTCOME_TRY(batch.put(hash, std::move(enc)));
 
     return hash;
   }
 
+  outcome::result<std::shared_ptr<TrieNode>>
+  TrieSerializerImpl::storeSubtreesParallel(const BranchNode &root,
+                                            StateVersion version,
+                                            BufferWriteable &batch) {
+    std::vector<SubtreeJob> jobs;
+    collectSubtreeJobs(root, 0, jobs);
+
+    auto encode = [&](SubtreeJob &job) -> outcome::result<void> {
+      OUTCOME_TRY(
+          enc,
+          codec_->encodeNode(
+              *job.node,
+              version,
+              [&](Codec::Visitee visitee) -> outcome::result<void> {
+                if (auto child_data = std::get_if<Codec::ChildData>(&visitee);
+                    child_data != nullptr) {
+                  if (child_data->merkle_value.isHash()) {
+                    job.writes.emplace_back(
+                        *child_data->merkle_value.asHash(),
+                        std::move(child_data->encoding));
+                  }
+                  return outcome::success();
+                }
+                auto &value_data = std::get<Codec::ValueData>(visitee);
+                job.writes.emplace_back(value_data.hash,
+                                        value_data.value.view());
+                return outcome::success();
+              }));
+      auto merkle_value = codec_->merkleValue(enc);
+      if (merkle_value.isHash()) {
+        job.writes.emplace_back(*merkle_value.asHash(), std::move(enc));
+      }
+      job.merkle_value = merkle_value;
+      return outcome::success();
+    };
+
+    parallelFor(*commit_pool_, jobs.size(), commit_threads_, [&](size_t i) {
+      jobs[i].result = encode(jobs[i]);
+    });
+
+    std::unordered_map<const TrieNode *, MerkleValue> encoded;
+    for (auto &job : jobs) {
+      OUTCOME_TRY(job.result);
+      for (auto &[key, value] : job.writes) {
+        OUTCOME_TRY(batch.put(key, std::move(value)));
+      }
+      encoded.emplace(job.node, *job.merkle_value);
+    }
+    return substituteEncodedSubtrees(root, encoded);
+  }
+
   outcome::result<PolkadotTrie::NodePtr> TrieSerializerImpl::retrieveNode(
       const std::shared_ptr<OpaqueTrieNode> &node,
       const OnNodeLoaded &on_node_loaded) const {
@@ -112,8 +256,16 @@ namespace kagome::storage::trie {
     if (db_key.asHash() == getEmptyRootHash()) {
       return nullptr;
     }
+    auto hash = db_key.asHash();
+    // proof recorders need the encoded node, so they always go to the backend
+    auto use_cache = node_cache_ != nullptr and hash and not on_node_loaded;
+    if (use_cache) {
+      if (auto node = node_cache_->get(*hash)) {
+        return node;
+      }
+    }
     BufferOrView enc;
-    if (auto hash = db_key.asHash()) {
+    if (hash) {
       BOOST_OUTCOME_TRY(enc, node_backend_->get(*hash));
       if (on_node_loaded) {
         on_node_loaded(*hash, enc);
@@ -124,9 +276,57 @@ namespace kagome::storage::trie {
     }
     OUTCOME_TRY(n, codec_->decodeNode(enc));
     auto node = std::dynamic_pointer_cast<TrieNode>(n);
+    if (node_cache_ != nullptr and hash and node != nullptr) {
+      node_cache_->put(*hash, *node);
+    }
     return node;
   }
 
+  outcome::result<void> TrieSerializerImpl::prefetchChildren(
+      BranchNode &parent, const OnNodeLoaded &on_node_loaded) const {
+    // proof recorders must see only the nodes which are actually accessed
+    if (on_node_loaded) {
+      return outcome::success();
+    }
+    std::vector<uint8_t> indices;
+    std::vector<BufferView> keys;
+    for (uint8_t i = 0; i < BranchNode::kMaxChildren; ++i) {
+      auto dummy = std::dynamic_pointer_cast<DummyNode>(parent.children[i]);
+      // nodes shorter than a hash are inlined and decoded lazily
+      if (dummy == nullptr or not dummy->db_key.isHash()) {
+        continue;
+      }
+      if (node_cache_ != nullptr) {
+        if (auto node = node_cache_->get(*dummy->db_key.asHash())) {
+          parent.children[i] = std::move(node);
+          continue;
+        }
+      }
+      indices.emplace_back(i);
+      keys.emplace_back(dummy->db_key.asBuffer());
+    }
+    if (keys.empty()) {
+      return outcome::success();
+    }
+    OUTCOME_TRY(encs, node_backend_->multiGet(keys));
+    for (size_t i = 0; i < keys.size(); ++i) {
+      // leave missing nodes as dummies, the error is reported on access
+      if (not encs[i]) {
+        continue;
+      }
+      OUTCOME_TRY(n, codec_->decodeNode(*encs[i]));
+      auto node = std::dynamic_pointer_cast<TrieNode>(n);
+      if (node == nullptr) {
+        continue;
+      }
+      if (node_cache_ != nullptr) {
+        node_cache_->put(MerkleHash::fromSpan(keys[i]).value(), *node);
+      }
+      parent.children[indices[i]] = std::move(node);
+    }
+    return outcome::success();
+  }
+
   outcome::result<std::optional<common::Buffer>>
   TrieSerializerImpl::retrieveValue(const common::Hash256 &hash,
                                     const OnNodeLoaded &on_node_loaded) const {
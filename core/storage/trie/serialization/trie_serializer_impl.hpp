@@ -10,10 +10,15 @@
 
 #include "storage/buffer_map_types.hpp"
 
+namespace kagome {
+  class ThreadPool;
+}  // namespace kagome
+
 namespace kagome::storage::trie {
   class Codec;
   class PolkadotTrieFactory;
   class TrieStorageBackend;
+  class TrieNodeCache;
   struct BranchNode;
   struct TrieNode;
 }  // namespace kagome::storage::trie
@@ -22,9 +27,18 @@ namespace kagome::storage::trie {
 
   class TrieSerializerImpl : public TrieSerializer {
    public:
+    /**
+     * @param commit_pool pool lending threads to encode dirty subtrees on
+     * commit, nullptr means the sequential commit
+     * @param commit_threads max number of threads encoding dirty subtrees on
+     * commit, including the committing one, 1 means the sequential commit
+     */
     TrieSerializerImpl(std::shared_ptr<PolkadotTrieFactory> factory,
                        std::shared_ptr<Codec> codec,
-                       std::shared_ptr<TrieStorageBackend> node_backend);
+                       std::shared_ptr<TrieStorageBackend> node_backend,
+                       std::shared_ptr<TrieNodeCache> node_cache = nullptr,
+                       std::shared_ptr<ThreadPool> commit_pool = nullptr,
+                       size_t commit_threads = 1);
     ~TrieSerializerImpl() override = default;
 
     RootHash getEmptyRootHash() const override;
@@ -32,6 +46,10 @@ namespace kagome::storage::trie {
     outcome::result<RootHash> storeTrie(PolkadotTrie &trie,
                                         StateVersion version) override;
 
+    outcome::result<RootHash> storeTrie(PolkadotTrie &trie,
+                                        StateVersion version,
+                                        BufferWriteable &batch) override;
+
     outcome::result<std::shared_ptr<PolkadotTrie>> retrieveTrie(
         RootHash db_key, OnNodeLoaded on_node_loaded) const override;
 
@@ -56,16 +74,38 @@ namespace kagome::storage::trie {
         const OnNodeLoaded &on_node_loaded) const override;
 
    private:
+    /**
+     * Replaces dummy children of a branch with decoded nodes, reading all of
+     * them from the backend with a single batched lookup
+     */
+    outcome::result<void> prefetchChildren(
+        BranchNode &parent, const OnNodeLoaded &on_node_loaded) const;
+
     /**
      * Writes a node to a persistent storage, recursively storing its
      * descendants as well. Then replaces the node children to dummy nodes to
      * avoid memory waste
      */
     outcome::result<RootHash> storeRootNode(TrieNode &node,
-                                            StateVersion version);
+                                            StateVersion version,
+                                            BufferWriteable &batch);
+
+    /**
+     * Encodes dirty subtrees below the top levels of a trie on up to
+     * `commit_threads_` threads of `commit_pool_` and puts their nodes and
+     * values to the batch.
+     * @return copy of the top levels with encoded subtrees replaced by dummy
+     * nodes, so that it encodes to the same root hash
+     */
+    outcome::result<std::shared_ptr<TrieNode>> storeSubtreesParallel(
+        const BranchNode &root, StateVersion version, BufferWriteable &batch);
 
     std::shared_ptr<PolkadotTrieFactory> trie_factory_;
     std::shared_ptr<Codec> codec_;
     std::shared_ptr<TrieStorageBackend> node_backend_;
+    // optional, shared between all serializers of the process
+    std::shared_ptr<TrieNodeCache> node_cache_;
+    std::shared_ptr<ThreadPool> commit_pool_;
+    size_t commit_threads_;
   };
 }  // namespace kagome::storage::trie
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "storage/buffer_map_types.hpp"
+#include "storage/trie/append_value.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_cursor.hpp"
 #include "storage/trie/types.hpp"
 
@@ -39,5 +40,27 @@ namespace kagome::storage::trie {
 
     virtual outcome::result<std::optional<std::shared_ptr<TrieBatch>>>
     createChildBatch(common::BufferView path) = 0;
+
+    /**
+     * Append `count` encoded items to SCALE encoded vector stored by key,
+     * or store new vector if there is no value.
+     * Append is ignored if stored value is not a vector.
+     * Batches may defer encoding of the vector until it's read.
+     */
+    virtual outcome::result<void> append(const BufferView &key,
+                                         BufferView encoded_items,
+                                         size_t count) {
+      OUTCOME_TRY(encoded, tryGet(key));
+      AppendValue value;
+      if (encoded) {
+        auto decoded = AppendValue::decode(encoded->view());
+        if (not decoded) {
+          return outcome::success();
+        }
+        value = std::move(decoded.value());
+      }
+      value.append(encoded_items, count);
+      return put(key, value.encode());
+    }
   };
 }  // namespace kagome::storage::trie
@@ -0,0 +1,156 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/trie_diff.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+#include "storage/trie/serialization/trie_serializer.hpp"
+
+namespace kagome::storage::trie {
+  namespace {
+    /// position of the walk along the key in one of tries
+    struct Side {
+      /// next node on the path, null when the walk has ended
+      std::shared_ptr<OpaqueTrieNode> node;
+      /// number of key nibbles before the node
+      size_t offset = 0;
+      /// value of the key, when the walk has reached it
+      ValueAndHash value;
+    };
+
+    const MerkleValue *merkleValue(
+        const std::shared_ptr<OpaqueTrieNode> &node) {
+      if (auto dummy = dynamic_cast<const DummyNode *>(node.get())) {
+        return &dummy->db_key;
+      }
+      return nullptr;
+    }
+
+    bool sameSubtree(const Side &l, const Side &r) {
+      if (l.node == nullptr or r.node == nullptr or l.offset != r.offset) {
+        return false;
+      }
+      auto l_merkle = merkleValue(l.node), r_merkle = merkleValue(r.node);
+      return l_merkle != nullptr and r_merkle != nullptr
+         and std::ranges::equal(l_merkle->asBuffer(), r_merkle->asBuffer());
+    }
+
+    class Walker {
+     public:
+      explicit Walker(const TrieSerializer &serializer)
+          : serializer_{serializer} {}
+
+      /// @return value of the key in `to` state, if it differs
+      outcome::result<std::optional<std::optional<common::Buffer>>> diff(
+          const RootHash &from, const RootHash &to, const KeyNibbles &key) {
+        Side l{std::make_shared<DummyNode>(from)};
+        Side r{std::make_shared<DummyNode>(to)};
+        while (l.node != nullptr or r.node != nullptr) {
+          if (sameSubtree(l, r)) {
+            return std::nullopt;
+          }
+          // advance the side which is behind, or both
+          constexpr auto kEnd = std::numeric_limits<size_t>::max();
+          auto offset = std::min(l.node ? l.offset : kEnd,
+                                 r.node ? r.offset : kEnd);
+          for (auto side : {&l, &r}) {
+            if (side->node != nullptr and side->offset == offset) {
+              OUTCOME_TRY(advance(*side, key));
+            }
+          }
+        }
+        if (l.value.hash and r.value.hash) {
+          if (*l.value.hash == *r.value.hash) {
+            return std::nullopt;
+          }
+        }
+        OUTCOME_TRY(l_value, loadValue(l.value));
+        OUTCOME_TRY(r_value, loadValue(r.value));
+        if (l_value == r_value) {
+          return std::nullopt;
+        }
+        return std::make_optional(std::move(r_value));
+      }
+
+     private:
+      outcome::result<void> advance(Side &side, const KeyNibbles &key) {
+        OUTCOME_TRY(node, load(side.node));
+        side.node.reset();
+        if (node == nullptr) {
+          return outcome::success();
+        }
+        auto &partial = node->getKeyNibbles();
+        auto end = side.offset + partial.size();
+        if (end > key.size()
+            or not std::equal(
+                partial.begin(), partial.end(), key.begin() + side.offset)) {
+          return outcome::success();
+        }
+        if (end == key.size()) {
+          side.value = node->getValue();
+          return outcome::success();
+        }
+        if (node->isBranch()) {
+          side.node = dynamic_cast<const BranchNode &>(*node).children.at(
+              key[end]);
+          side.offset = end + 1;
+        }
+        return outcome::success();
+      }
+
+      /// nodes near root are shared by paths of all keys
+      outcome::result<std::shared_ptr<TrieNode>> load(
+          const std::shared_ptr<OpaqueTrieNode> &node) {
+        auto merkle = merkleValue(node);
+        auto hash = merkle != nullptr ? merkle->asHash() : std::nullopt;
+        if (hash) {
+          if (auto it = nodes_.find(*hash); it != nodes_.end()) {
+            return it->second;
+          }
+        }
+        OUTCOME_TRY(loaded, serializer_.retrieveNode(node, {}));
+        if (hash) {
+          nodes_.emplace(*hash, loaded);
+        }
+        return loaded;
+      }
+
+      outcome::result<std::optional<common::Buffer>> loadValue(
+          const ValueAndHash &value) const {
+        if (value.value or not value.hash) {
+          return value.value;
+        }
+        return serializer_.retrieveValue(*value.hash, {});
+      }
+
+      const TrieSerializer &serializer_;
+      std::unordered_map<common::Hash256, std::shared_ptr<TrieNode>> nodes_;
+    };
+  }  // namespace
+
+  outcome::result<std::vector<TrieDiffChange>> diffTries(
+      const TrieSerializer &serializer,
+      const RootHash &from,
+      const RootHash &to,
+      std::span<const common::Buffer> keys) {
+    std::vector<TrieDiffChange> changes;
+    if (from == to) {
+      return changes;
+    }
+    Walker walker{serializer};
+    for (auto &key : keys) {
+      OUTCOME_TRY(value,
+                  walker.diff(from, to, KeyNibbles::fromByteBuffer(key)));
+      if (value) {
+        changes.emplace_back(TrieDiffChange{key, std::move(*value)});
+      }
+    }
+    return changes;
+  }
+}  // namespace kagome::storage::trie
@@ -0,0 +1,36 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <span>
+
+#include "common/buffer.hpp"
+#include "storage/trie/types.hpp"
+
+namespace kagome::storage::trie {
+  class TrieSerializer;
+
+  struct TrieDiffChange {
+    /// view of one of compared keys
+    common::BufferView key;
+    /// value in the new state
+    std::optional<common::Buffer> value;
+  };
+
+  /**
+   * Finds keys with different values in two states.
+   * Both tries are walked together along each key, the walk stops when the
+   * subtrees containing the key have equal merkle values, so nodes of
+   * unchanged subtrees are not loaded.
+   * @return changes in order of keys
+   */
+  outcome::result<std::vector<TrieDiffChange>> diffTries(
+      const TrieSerializer &serializer,
+      const RootHash &from,
+      const RootHash &to,
+      std::span<const common::Buffer> keys);
+}  // namespace kagome::storage::trie
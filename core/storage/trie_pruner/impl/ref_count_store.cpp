@@ -0,0 +1,250 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie_pruner/impl/ref_count_store.hpp"
+
+#include <boost/assert.hpp>
+
+#include "scale/scale.hpp"
+#include "storage/map_prefix/prefix.hpp"
+
+namespace kagome::storage::trie_pruner {
+  namespace {
+    constexpr uint8_t kNodePrefix = 'n';
+    constexpr uint8_t kValuePrefix = 'v';
+    constexpr uint8_t kImmortalPrefix = 'i';
+    constexpr uint8_t kDiscardedPrefix = 'd';
+    constexpr uint8_t kQueuePrefix = 'q';
+    constexpr uint8_t kProgressPrefix = 'p';
+    const common::Buffer kInfoKey = common::Buffer::fromString(":info");
+    // keys removed with one batch by `clear`
+    constexpr size_t kClearBatchSize = 10000;
+
+    common::Buffer key(uint8_t prefix, const common::Hash256 &hash) {
+      common::Buffer key;
+      key.reserve(1 + hash.size());
+      key.putUint8(prefix).put(hash);
+      return key;
+    }
+
+    common::Buffer prefixBuffer(uint8_t prefix) {
+      common::Buffer buffer;
+      buffer.putUint8(prefix);
+      return buffer;
+    }
+
+    // big endian, so cursor iterates queue in order
+    common::Buffer queueKey(uint64_t position,
+                            uint8_t prefix = kQueuePrefix) {
+      auto key = prefixBuffer(prefix);
+      for (auto shift = 56; shift >= 0; shift -= 8) {
+        key.putUint8(static_cast<uint8_t>(position >> shift));
+      }
+      return key;
+    }
+
+    uint64_t queuePosition(common::BufferView key) {
+      uint64_t position = 0;
+      for (auto byte : key) {
+        position = (position << 8) | byte;
+      }
+      return position;
+    }
+  }  // namespace
+
+  RefCountStore::RefCountStore(std::shared_ptr<BufferStorage> db)
+      : db_{std::move(db)} {
+    BOOST_ASSERT(db_ != nullptr);
+  }
+
+  outcome::result<size_t> RefCountStore::node(const common::Hash256 &hash) {
+    return getCount(key(kNodePrefix, hash));
+  }
+
+  void RefCountStore::setNode(const common::Hash256 &hash, size_t count) {
+    setCount(key(kNodePrefix, hash), count);
+  }
+
+  outcome::result<size_t> RefCountStore::value(const common::Hash256 &hash) {
+    return getCount(key(kValuePrefix, hash));
+  }
+
+  void RefCountStore::setValue(const common::Hash256 &hash, size_t count) {
+    setCount(key(kValuePrefix, hash), count);
+  }
+
+  outcome::result<bool> RefCountStore::immortal(const common::Hash256 &hash) {
+    OUTCOME_TRY(raw, get(key(kImmortalPrefix, hash)));
+    return raw.has_value();
+  }
+
+  void RefCountStore::setImmortal(const common::Hash256 &hash) {
+    pending_[key(kImmortalPrefix, hash)] = common::Buffer{};
+  }
+
+  outcome::result<bool> RefCountStore::discarded(const common::Hash256 &root) {
+    OUTCOME_TRY(raw, get(key(kDiscardedPrefix, root)));
+    return raw.has_value();
+  }
+
+  void RefCountStore::setDiscarded(const common::Hash256 &root,
+                                   bool discarded) {
+    auto &pending = pending_[key(kDiscardedPrefix, root)];
+    if (discarded) {
+      pending = common::Buffer{};
+    } else {
+      pending.reset();
+    }
+  }
+
+  outcome::result<std::optional<common::Buffer>> RefCountStore::info() {
+    return get(kInfoKey);
+  }
+
+  void RefCountStore::setInfo(common::Buffer info) {
+    pending_[kInfoKey] = std::move(info);
+  }
+
+  void RefCountStore::enqueue(const common::Hash256 &root) {
+    pending_[queueKey(next_position_++)] = common::Buffer{root};
+  }
+
+  outcome::result<std::optional<std::pair<uint64_t, common::Hash256>>>
+  RefCountStore::front() {
+    MapPrefix queue{prefixBuffer(kQueuePrefix), db_};
+    auto cursor = queue.cursor();
+    OUTCOME_TRY(cursor->seekFirst());
+    if (not cursor->isValid()) {
+      return std::nullopt;
+    }
+    OUTCOME_TRY(root, common::Hash256::fromSpan(cursor->value()->view()));
+    return std::make_optional(
+        std::make_pair(queuePosition(*cursor->key()), root));
+  }
+
+  void RefCountStore::pop(uint64_t position) {
+    pending_[queueKey(position)].reset();
+    pending_[queueKey(position, kProgressPrefix)].reset();
+  }
+
+  outcome::result<std::optional<std::vector<common::Hash256>>>
+  RefCountStore::progress(uint64_t position) {
+    OUTCOME_TRY(raw, get(queueKey(position, kProgressPrefix)));
+    if (not raw) {
+      return std::nullopt;
+    }
+    OUTCOME_TRY(nodes, scale::decode<std::vector<common::Hash256>>(*raw));
+    return std::make_optional(std::move(nodes));
+  }
+
+  void RefCountStore::setProgress(uint64_t position,
+                                  const std::vector<common::Hash256> &nodes) {
+    pending_[queueKey(position, kProgressPrefix)] =
+        common::Buffer{scale::encode(nodes).value()};
+  }
+
+  outcome::result<size_t> RefCountStore::loadQueue() {
+    MapPrefix queue{prefixBuffer(kQueuePrefix), db_};
+    auto cursor = queue.cursor();
+    size_t size = 0;
+    OUTCOME_TRY(cursor->seekFirst());
+    while (cursor->isValid()) {
+      ++size;
+      next_position_ = queuePosition(*cursor->key()) + 1;
+      OUTCOME_TRY(cursor->next());
+    }
+    return size;
+  }
+
+  outcome::result<void> RefCountStore::commit() {
+    if (pending_.empty()) {
+      return outcome::success();
+    }
+    auto batch = db_->batch();
+    OUTCOME_TRY(write(*batch));
+    return batch->commit();
+  }
+
+  outcome::result<void> RefCountStore::write(BufferWriteable &batch) {
+    for (auto &[key, value] : pending_) {
+      if (value) {
+        OUTCOME_TRY(batch.put(key, std::move(*value)));
+      } else {
+        OUTCOME_TRY(batch.remove(key));
+      }
+    }
+    pending_.clear();
+    return outcome::success();
+  }
+
+  void RefCountStore::discard() {
+    pending_.clear();
+  }
+
+  outcome::result<void> RefCountStore::clear() {
+    pending_.clear();
+    next_position_ = 0;
+    // counts without info are incomplete, so column left partially cleared
+    // by crash is cleared again on start
+    OUTCOME_TRY(db_->remove(kInfoKey));
+    auto cursor = db_->cursor();
+    OUTCOME_TRY(cursor->seekFirst());
+    while (cursor->isValid()) {
+      auto batch = db_->batch();
+      for (size_t i = 0; i < kClearBatchSize and cursor->isValid(); ++i) {
+        OUTCOME_TRY(batch->remove(*cursor->key()));
+        OUTCOME_TRY(cursor->next());
+      }
+      OUTCOME_TRY(batch->commit());
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> RefCountStore::forNodes(
+      const std::function<void(const common::Hash256 &, size_t)> &f) {
+    MapPrefix nodes{prefixBuffer(kNodePrefix), db_};
+    auto cursor = nodes.cursor();
+    OUTCOME_TRY(cursor->seekFirst());
+    while (cursor->isValid()) {
+      OUTCOME_TRY(hash, common::Hash256::fromSpan(*cursor->key()));
+      OUTCOME_TRY(count, getCount(key(kNodePrefix, hash)));
+      f(hash, count);
+      OUTCOME_TRY(cursor->next());
+    }
+    return outcome::success();
+  }
+
+  outcome::result<std::optional<common::Buffer>> RefCountStore::get(
+      const common::Buffer &key) {
+    if (auto it = pending_.find(key); it != pending_.end()) {
+      return it->second;
+    }
+    OUTCOME_TRY(raw, db_->tryGet(key));
+    if (not raw) {
+      return std::nullopt;
+    }
+    return std::make_optional(raw->intoBuffer());
+  }
+
+  outcome::result<size_t> RefCountStore::getCount(const common::Buffer &key) {
+    OUTCOME_TRY(raw, get(key));
+    if (not raw) {
+      return 0;
+    }
+    OUTCOME_TRY(count, scale::decode<scale::CompactInteger>(*raw));
+    return count.convert_to<size_t>();
+  }
+
+  void RefCountStore::setCount(common::Buffer key, size_t count) {
+    if (count == 0) {
+      pending_[std::move(key)].reset();
+      return;
+    }
+    pending_[std::move(key)] =
+        common::Buffer{scale::encode(scale::CompactInteger{count}).value()};
+  }
+
+}  // namespace kagome::storage::trie_pruner
@@ -0,0 +1,97 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "common/blob.hpp"
+#include "common/buffer.hpp"
+#include "storage/buffer_map_types.hpp"
+
+namespace kagome::storage::trie_pruner {
+
+  /**
+   * Reference counts of trie nodes and values used by pruner.
+   * Counts are kept in database column, so pruner memory doesn't grow with
+   * state size and counts don't need to be rebuilt on start.
+   * Changes are accumulated in memory and written by `commit` with one batch.
+   * Counts are SCALE compact encoded, zero counts are not stored.
+   * Column also keeps queue of state roots waiting to be pruned and nodes
+   * left to visit in partially pruned state.
+   */
+  class RefCountStore {
+   public:
+    explicit RefCountStore(std::shared_ptr<BufferStorage> db);
+
+    outcome::result<size_t> node(const common::Hash256 &hash);
+    void setNode(const common::Hash256 &hash, size_t count);
+
+    outcome::result<size_t> value(const common::Hash256 &hash);
+    void setValue(const common::Hash256 &hash, size_t count);
+
+    /// Node was in storage before pruner indexed it, so it's never removed
+    outcome::result<bool> immortal(const common::Hash256 &hash);
+    void setImmortal(const common::Hash256 &hash);
+
+    /// State of discarded block is queued, marker is removed once it's pruned
+    outcome::result<bool> discarded(const common::Hash256 &root);
+    void setDiscarded(const common::Hash256 &root, bool discarded);
+
+    /// Encoded pruner info, present only when counts are complete
+    outcome::result<std::optional<common::Buffer>> info();
+    void setInfo(common::Buffer info);
+
+    /// Appends state root to prune queue
+    void enqueue(const common::Hash256 &root);
+
+    /// First queued state root and its position
+    outcome::result<std::optional<std::pair<uint64_t, common::Hash256>>>
+    front();
+
+    /// Removes queued state root and its progress
+    void pop(uint64_t position);
+
+    /// Nodes left to visit in queued state, if its pruning was started
+    outcome::result<std::optional<std::vector<common::Hash256>>> progress(
+        uint64_t position);
+    void setProgress(uint64_t position,
+                     const std::vector<common::Hash256> &nodes);
+
+    /// Counts queued state roots, must be called before `enqueue`
+    outcome::result<size_t> loadQueue();
+
+    /// Writes accumulated changes
+    outcome::result<void> commit();
+
+    /// Puts accumulated changes to batch committed by caller
+    outcome::result<void> write(BufferWriteable &batch);
+
+    /// Drops accumulated changes, e.g. after failure
+    void discard();
+
+    /// Removes all counts from database in bounded batches
+    outcome::result<void> clear();
+
+    /// Calls `f(hash, count)` for each stored node count
+    outcome::result<void> forNodes(
+        const std::function<void(const common::Hash256 &, size_t)> &f);
+
+   private:
+    outcome::result<std::optional<common::Buffer>> get(
+        const common::Buffer &key);
+    outcome::result<size_t> getCount(const common::Buffer &key);
+    void setCount(common::Buffer key, size_t count);
+
+    std::shared_ptr<BufferStorage> db_;
+    uint64_t next_position_ = 0;
+    std::unordered_map<common::Buffer, std::optional<common::Buffer>>
+        pending_;
+  };
+
+}  // namespace kagome::storage::trie_pruner
@@ -10,6 +10,7 @@
 
 #include <fmt/std.h>
 #include <boost/assert.hpp>
+#include <libp2p/common/final_action.hpp>
 
 #include "application/app_configuration.hpp"
 #include "application/app_state_manager.hpp"
@@ -22,6 +23,7 @@
 #include "storage/trie/serialization/polkadot_codec.hpp"
 #include "storage/trie/serialization/trie_serializer.hpp"
 #include "storage/trie/trie_storage_backend.hpp"
+#include "storage/trie_pruner/impl/trie_pruner_thread_pool.hpp"
 
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::storage::trie_pruner,
                             TriePrunerImpl::Error,
@@ -36,6 +38,13 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::storage::trie_pruner,
 }
 
 namespace kagome::storage::trie_pruner {
+  constexpr auto backlogMetricName = "kagome_trie_pruner_backlog";
+  constexpr auto prunedStatesMetricName =
+      "kagome_trie_pruner_pruned_states_total";
+  constexpr auto removedNodesMetricName =
+      "kagome_trie_pruner_removed_nodes_total";
+  constexpr auto skippedStatesMetricName =
+      "kagome_trie_pruner_skipped_states_total";
 
   template <typename F,
             std::enable_if_t<std::is_invocable_r_v<outcome::result<void>,
@@ -65,20 +74,41 @@ namespace kagome::storage::trie_pruner {
       std::shared_ptr<const storage::trie::Codec> codec,
       std::shared_ptr<storage::SpacedStorage> storage,
       std::shared_ptr<const crypto::Hasher> hasher,
-      std::shared_ptr<const application::AppConfiguration> config)
-      : node_storage_{node_storage},
+      std::shared_ptr<const application::AppConfiguration> config,
+      std::shared_ptr<TriePrunerThreadPool> thread_pool)
+      : ref_counts_{storage->getSpace(kTriePruner)},
+        node_storage_{node_storage},
         serializer_{serializer},
         codec_{codec},
         storage_{storage},
         hasher_{hasher},
         pruning_depth_{config->statePruningDepth()},
-        thorough_pruning_{config->enableThoroughPruning()} {
+        thorough_pruning_{config->enableThoroughPruning()},
+        thread_handler_{thread_pool->handlerStarted()} {
     BOOST_ASSERT(node_storage_ != nullptr);
     BOOST_ASSERT(serializer_ != nullptr);
     BOOST_ASSERT(codec_ != nullptr);
     BOOST_ASSERT(storage_ != nullptr);
     BOOST_ASSERT(hasher_ != nullptr);
 
+    metrics_registry_->registerGaugeFamily(
+        backlogMetricName, "Number of states waiting to be pruned");
+    metric_backlog_ =
+        metrics_registry_->registerGaugeMetric(backlogMetricName);
+    metrics_registry_->registerCounterFamily(prunedStatesMetricName,
+                                             "Number of pruned states");
+    metric_pruned_states_ =
+        metrics_registry_->registerCounterMetric(prunedStatesMetricName);
+    metrics_registry_->registerCounterFamily(
+        removedNodesMetricName, "Number of trie nodes removed by pruner");
+    metric_removed_nodes_ =
+        metrics_registry_->registerCounterMetric(removedNodesMetricName);
+    metrics_registry_->registerCounterFamily(
+        skippedStatesMetricName,
+        "Number of states left unpruned after failed attempts");
+    metric_skipped_states_ =
+        metrics_registry_->registerCounterMetric(skippedStatesMetricName);
+
     app_state_manager->takeControl(*this);
   }
 
@@ -103,6 +133,36 @@ namespace kagome::storage::trie_pruner {
         return false;
       }
     }
+
+    auto index_info_res = ref_counts_.info();
+    if (!index_info_res) {
+      SL_ERROR(logger_,
+               "Failed to obtain trie pruner ref counts metadata: {}",
+               index_info_res.error());
+      return false;
+    }
+    if (auto &index_info = index_info_res.value(); index_info.has_value()) {
+      auto info_res = scale::decode<TriePrunerInfo>(*index_info);
+      if (!info_res) {
+        SL_ERROR(logger_,
+                 "Failed to decode pruner ref counts info: {}",
+                 info_res.error());
+        return false;
+      }
+      // written in one batch with ref counts, so it is never behind them
+      last_pruned_block_ = info_res.value().last_pruned_block;
+      index_ready_ = true;
+    }
+
+    auto backlog_res = ref_counts_.loadQueue();
+    if (!backlog_res) {
+      SL_ERROR(logger_,
+               "Failed to load trie pruner queue: {}",
+               backlog_res.error());
+      return false;
+    }
+    backlog_ = backlog_res.value();
+    metric_backlog_->set(backlog_);
     SL_DEBUG(
         logger_,
         "Initialize trie pruner with pruning depth {}, last pruned block {}",
@@ -111,6 +171,15 @@ namespace kagome::storage::trie_pruner {
     return true;
   }
 
+  bool TriePrunerImpl::start() {
+    std::unique_lock lock{mutex_};
+    // states queued before restart
+    if (backlog_ != 0) {
+      schedulePruneNext();
+    }
+    return true;
+  }
+
   class Encoder {
    public:
     explicit Encoder(const trie::Codec &codec, log::Logger logger)
@@ -174,11 +243,10 @@ namespace kagome::storage::trie_pruner {
   outcome::result<void> TriePrunerImpl::pruneFinalized(
       const primitives::BlockHeader &block) {
     std::unique_lock lock{mutex_};
-    auto node_batch = node_storage_->batch();
-    OUTCOME_TRY(prune(*node_batch, block.state_root));
-    OUTCOME_TRY(node_batch->commit());
-
+    libp2p::common::FinalAction discard{[&] { ref_counts_.discard(); }};
     last_pruned_block_ = block.blockInfo();
+    // queue and last pruned block are written in one batch
+    OUTCOME_TRY(enqueue(block.state_root));
     OUTCOME_TRY(savePersistentState());
     return outcome::success();
   }
@@ -186,139 +254,245 @@ namespace kagome::storage::trie_pruner {
   outcome::result<void> TriePrunerImpl::pruneDiscarded(
       const primitives::BlockHeader &block) {
     std::unique_lock lock{mutex_};
+    libp2p::common::FinalAction discard{[&] { ref_counts_.discard(); }};
+    // block may be discarded again while its state is still queued
+    OUTCOME_TRY(discarded, ref_counts_.discarded(block.state_root));
+    if (discarded) {
+      return outcome::success();
+    }
     // should prune even when pruning depth is none
-    auto node_batch = node_storage_->batch();
-    auto value_batch = node_storage_->batch();
-    OUTCOME_TRY(prune(*node_batch, block.state_root));
-    OUTCOME_TRY(node_batch->commit());
-    OUTCOME_TRY(value_batch->commit());
+    ref_counts_.setDiscarded(block.state_root, true);
+    OUTCOME_TRY(enqueue(block.state_root));
     return outcome::success();
   }
 
-  outcome::result<void> TriePrunerImpl::prune(BufferBatch &node_batch,
-                                              const trie::RootHash &root_hash) {
-    auto trie_res = serializer_->retrieveTrie(root_hash, nullptr);
-    if (trie_res.has_error()
-        && trie_res.error() == storage::DatabaseError::NOT_FOUND) {
-      SL_TRACE(logger_,
-               "Failed to obtain trie from storage, the state {} is probably "
-               "already pruned or has never been executed.",
-               root_hash);
-      return outcome::success();
+  outcome::result<void> TriePrunerImpl::enqueue(
+      const storage::trie::RootHash &state) {
+    ref_counts_.enqueue(state);
+    OUTCOME_TRY(commitRefCounts());
+    ++backlog_;
+    metric_backlog_->set(backlog_);
+    schedulePruneNext();
+    return outcome::success();
+  }
+
+  void TriePrunerImpl::schedulePruneNext() {
+    if (prune_scheduled_) {
+      return;
     }
-    KAGOME_PROFILE_START_L(logger_, prune_state);
+    prune_scheduled_ = true;
+    // one slice per task, so other operations may take mutex between
+    thread_handler_->execute([weak{weak_from_this()}] {
+      auto self = weak.lock();
+      if (not self) {
+        return;
+      }
+      auto r = self->pruneNext();
+      if (r.has_error()) {
+        SL_ERROR(self->logger_, "Failed to prune state: {}", r.error());
+      }
+      std::unique_lock lock{self->mutex_};
+      self->prune_scheduled_ = false;
+      if (r.has_error() or r.value()) {
+        self->schedulePruneNext();
+      }
+    });
+  }
 
-    OUTCOME_TRY(trie, trie_res);
-    if (trie->getRoot() == nullptr) {
-      SL_DEBUG(logger_, "Attempt to prune a trie with a null root");
-      return outcome::success();
+  outcome::result<bool> TriePrunerImpl::pruneNext() {
+    std::unique_lock lock{mutex_};
+    libp2p::common::FinalAction discard{[&] { ref_counts_.discard(); }};
+    OUTCOME_TRY(front, ref_counts_.front());
+    if (not front) {
+      return false;
+    }
+    auto &[position, state_root] = *front;
+    auto r = pruneSlice(position, state_root);
+    if (r) {
+      prune_attempts_ = 0;
+      return true;
+    }
+    ref_counts_.discard();
+    if (++prune_attempts_ < kMaxPruneAttempts) {
+      return r.as_failure();
+    }
+    // otherwise state would stay at the front of queue forever, its remaining
+    // nodes are left in storage
+    SL_WARN(logger_,
+            "Skip pruning state {} after {} failed attempts: {}",
+            state_root,
+            prune_attempts_,
+            r.error());
+    prune_attempts_ = 0;
+    ref_counts_.pop(position);
+    ref_counts_.setDiscarded(state_root, false);
+    OUTCOME_TRY(commitRefCounts());
+    if (backlog_ != 0) {
+      --backlog_;
+    }
+    metric_backlog_->set(backlog_);
+    metric_skipped_states_->inc();
+    return true;
+  }
+
+  outcome::result<void> TriePrunerImpl::pruneQueued() {
+    while (true) {
+      OUTCOME_TRY(pruned, pruneNext());
+      if (not pruned) {
+        return outcome::success();
+      }
+    }
+  }
+
+  outcome::result<void> TriePrunerImpl::pruneSlice(
+      uint64_t position, const trie::RootHash &root_hash) {
+    std::vector<PruneEntry> queued_nodes;
+    OUTCOME_TRY(progress, ref_counts_.progress(position));
+    if (progress) {
+      for (auto &hash : *progress) {
+        queued_nodes.push_back({hash, std::make_shared<trie::DummyNode>(hash)});
+      }
+    } else {
+      auto trie_res = serializer_->retrieveTrie(root_hash, nullptr);
+      if (trie_res.has_error()
+          && trie_res.error() == storage::DatabaseError::NOT_FOUND) {
+        SL_TRACE(logger_,
+                 "Failed to obtain trie from storage, the state {} is probably "
+                 "already pruned or has never been executed.",
+                 root_hash);
+      } else {
+        OUTCOME_TRY(trie, trie_res);
+        if (trie->getRoot() == nullptr) {
+          SL_DEBUG(logger_, "Attempt to prune a trie with a null root");
+        } else {
+          logger_->debug("Prune state root {}", root_hash);
+          queued_nodes.push_back({root_hash, trie->getRoot()});
+          // child tries are found through main trie, so they are queued
+          // before any of its nodes is removed
+          OUTCOME_TRY(forEachChildTrie(
+              *trie,
+              [&](common::BufferView,
+                  const trie::RootHash &child_hash) -> outcome::result<void> {
+                auto child = std::make_shared<trie::DummyNode>(child_hash);
+                queued_nodes.push_back({child_hash, std::move(child)});
+                return outcome::success();
+              }));
+        }
+      }
     }
 
-    OUTCOME_TRY(
-        forEachChildTrie(*trie,
-                         [this, &node_batch](common::BufferView child_key,
-                                             const trie::RootHash &child_hash) {
-                           return prune(node_batch, child_hash);
-                         }));
+    auto node_batch = node_storage_->batch();
+    OUTCOME_TRY(prune(*node_batch, queued_nodes));
+    if (queued_nodes.empty()) {
+      ref_counts_.pop(position);
+      ref_counts_.setDiscarded(root_hash, false);
+    } else {
+      std::vector<common::Hash256> hashes;
+      hashes.reserve(queued_nodes.size());
+      for (auto &entry : queued_nodes) {
+        hashes.push_back(entry.hash);
+      }
+      ref_counts_.setProgress(position, hashes);
+    }
+    // ref counts and progress are written before nodes are removed, so crash
+    // in between leaves unreferenced nodes instead of pruning them twice
+    OUTCOME_TRY(commitRefCounts());
+    OUTCOME_TRY(node_batch->commit());
+    if (queued_nodes.empty()) {
+      if (backlog_ != 0) {
+        --backlog_;
+      }
+      metric_backlog_->set(backlog_);
+      metric_pruned_states_->inc();
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> TriePrunerImpl::prune(
+      BufferBatch &node_batch, std::vector<PruneEntry> &queued_nodes) {
+    KAGOME_PROFILE_START_L(logger_, prune_state);
 
     size_t nodes_removed = 0;
     size_t values_removed = 0;
     size_t nodes_unknown = 0;
     size_t values_unknown = 0;
 
-    struct Entry {
-      common::Hash256 hash;
-      std::shared_ptr<trie::TrieNode> node;
-      size_t depth;
-    };
-    std::vector<Entry> queued_nodes;
-    queued_nodes.push_back({root_hash, trie->getRoot(), 0});
-
     Encoder encoder{*codec_, logger_};
 
-    logger_->debug("Prune state root {}", root_hash);
-
     // iterate nodes, decrement their ref count and delete if ref count becomes
     // zero
-    while (!queued_nodes.empty()) {
-      auto [hash, node, depth] = queued_nodes.back();
+    while (!queued_nodes.empty() && nodes_removed < kPruneSliceNodes) {
+      auto [hash, opaque_node] = queued_nodes.back();
       queued_nodes.pop_back();
-      auto ref_count_it = ref_count_.find(hash);
-      if (ref_count_it == ref_count_.end()) {
+      OUTCOME_TRY(ref_count, ref_counts_.node(hash));
+      if (ref_count == 0) {
         nodes_unknown++;
         continue;
       }
+      ref_count--;
+      ref_counts_.setNode(hash, ref_count);
+      SL_TRACE(logger_, "Prune - Node {}, ref count {}", hash, ref_count);
+      if (ref_count != 0) {
+        continue;
+      }
 
-      auto &ref_count = ref_count_it->second;
-      if (ref_count == 0) {
-        SL_WARN(logger_,
-                "Pruner encountered an unindexed node {} while pruning, this "
-                "indicates a bug",
-                hash);
+      OUTCOME_TRY(immortal, ref_counts_.immortal(hash));
+      if (immortal) {
         continue;
       }
-      ref_count--;
-      SL_TRACE(logger_,
-               "Prune - {} - Node {}, ref count {}",
-               depth,
-               hash,
-               ref_count);
-
-      if (immortal_nodes_.find(hash) == immortal_nodes_.end()
-          && ref_count == 0) {
-        nodes_removed++;
-        ref_count_.erase(ref_count_it);
-        OUTCOME_TRY(node_batch.remove(hash));
-        auto hash_opt = node->getValue().hash;
-        if (hash_opt.has_value()) {
-          auto &value_hash = *hash_opt;
-          auto value_ref_it = value_ref_count_.find(value_hash);
-          if (value_ref_it == value_ref_count_.end()) {
-            values_unknown++;
-          } else {
-            auto &value_ref_count = value_ref_it->second;
-            value_ref_count--;
-            if (value_ref_count == 0) {
-              OUTCOME_TRY(node_batch.remove(value_hash));
-              value_ref_count_.erase(value_ref_it);
-              values_removed++;
-            }
+      OUTCOME_TRY(node, serializer_->retrieveNode(opaque_node, nullptr));
+      nodes_removed++;
+      OUTCOME_TRY(node_batch.remove(hash));
+      if (node == nullptr) {
+        continue;
+      }
+      auto hash_opt = node->getValue().hash;
+      if (hash_opt.has_value()) {
+        auto &value_hash = *hash_opt;
+        OUTCOME_TRY(value_ref_count, ref_counts_.value(value_hash));
+        if (value_ref_count == 0) {
+          values_unknown++;
+        } else {
+          value_ref_count--;
+          ref_counts_.setValue(value_hash, value_ref_count);
+          if (value_ref_count == 0) {
+            OUTCOME_TRY(node_batch.remove(value_hash));
+            values_removed++;
           }
         }
-        if (node->isBranch()) {
-          auto branch = static_cast<const trie::BranchNode &>(*node);
-          for (auto opaque_child : branch.children) {
-            if (opaque_child != nullptr) {
-              auto dummy_child =
-                  dynamic_cast<const trie::DummyNode *>(opaque_child.get());
-              std::optional<trie::MerkleValue> child_merkle_value;
-              if (dummy_child != nullptr) {
-                child_merkle_value = encoder.getMerkleValue(*dummy_child);
-              } else {
-                // used for tests
-                auto node =
-                    dynamic_cast<const trie::TrieNode *>(opaque_child.get());
-                BOOST_ASSERT(node != nullptr);
-                BOOST_OUTCOME_TRY(
-                    child_merkle_value,
-                    encoder.getMerkleValue(*node, trie::StateVersion::V0));
-              }
-              BOOST_ASSERT(child_merkle_value.has_value());
-              if (child_merkle_value->isHash()) {
-                SL_TRACE(logger_,
-                         "Prune - Child {}",
-                         child_merkle_value->asBuffer());
-                OUTCOME_TRY(child,
-                            serializer_->retrieveNode(opaque_child, nullptr));
-                queued_nodes.push_back(
-                    {*child_merkle_value->asHash(), child, depth + 1});
-              }
-            }
+      }
+      if (node->isBranch()) {
+        auto &branch = static_cast<const trie::BranchNode &>(*node);
+        for (auto &opaque_child : branch.children) {
+          if (opaque_child == nullptr) {
+            continue;
+          }
+          auto dummy_child =
+              dynamic_cast<const trie::DummyNode *>(opaque_child.get());
+          std::optional<trie::MerkleValue> child_merkle_value;
+          if (dummy_child != nullptr) {
+            child_merkle_value = encoder.getMerkleValue(*dummy_child);
+          } else {
+            // used for tests
+            auto child =
+                dynamic_cast<const trie::TrieNode *>(opaque_child.get());
+            BOOST_ASSERT(child != nullptr);
+            BOOST_OUTCOME_TRY(
+                child_merkle_value,
+                encoder.getMerkleValue(*child, trie::StateVersion::V0));
+          }
+          BOOST_ASSERT(child_merkle_value.has_value());
+          if (child_merkle_value->isHash()) {
+            SL_TRACE(
+                logger_, "Prune - Child {}", child_merkle_value->asBuffer());
+            queued_nodes.push_back(
+                {*child_merkle_value->asHash(), opaque_child});
           }
         }
       }
     }
 
+    metric_removed_nodes_->inc(nodes_removed);
     SL_DEBUG(logger_, "Removed {} nodes", nodes_removed);
     if (nodes_unknown > 0) {
       SL_WARN(logger_,
@@ -340,18 +514,40 @@ namespace kagome::storage::trie_pruner {
   outcome::result<void> TriePrunerImpl::addNewState(
       const storage::trie::RootHash &state_root, trie::StateVersion version) {
     std::unique_lock lock{mutex_};
+    libp2p::common::FinalAction discard{[&] { ref_counts_.discard(); }};
     OUTCOME_TRY(trie, serializer_->retrieveTrie(state_root));
     OUTCOME_TRY(addNewStateWith(*trie, version));
+    OUTCOME_TRY(commitRefCounts());
     return outcome::success();
   }
 
   outcome::result<void> TriePrunerImpl::addNewState(
       const trie::PolkadotTrie &new_trie, trie::StateVersion version) {
     std::unique_lock lock{mutex_};
+    libp2p::common::FinalAction discard{[&] { ref_counts_.discard(); }};
     OUTCOME_TRY(addNewStateWith(new_trie, version));
+    OUTCOME_TRY(commitRefCounts());
     return outcome::success();
   }
 
+  outcome::result<trie::RootHash> TriePrunerImpl::storeNewState(
+      trie::PolkadotTrie &new_trie,
+      trie::StateVersion version,
+      trie::TrieSerializer &serializer) {
+    std::unique_lock lock{mutex_};
+    libp2p::common::FinalAction discard{[&] { ref_counts_.discard(); }};
+    OUTCOME_TRY(addNewStateWith(new_trie, version));
+    // crash can't leave nodes without counts or counts without nodes
+    auto batch = storage_->createBatch();
+    BufferSpaceWriter nodes{*batch, kTrieNode};
+    OUTCOME_TRY(root, serializer.storeTrie(new_trie, version, nodes));
+    BufferSpaceWriter ref_counts{*batch, kTriePruner};
+    OUTCOME_TRY(setRefCountsInfo());
+    OUTCOME_TRY(ref_counts_.write(ref_counts));
+    OUTCOME_TRY(batch->commit());
+    return root;
+  }
+
   outcome::result<storage::trie::RootHash> TriePrunerImpl::addNewStateWith(
       const trie::PolkadotTrie &new_trie, trie::StateVersion version) {
     if (new_trie.getRoot() == nullptr) {
@@ -359,7 +555,6 @@ namespace kagome::storage::trie_pruner {
       return outcome::success();
     }
 
-    SL_DEBUG(logger_, "Ref count map size is {}", ref_count_.size());
     KAGOME_PROFILE_START_L(logger_, register_state);
 
     struct Entry {
@@ -376,13 +571,19 @@ namespace kagome::storage::trie_pruner {
     SL_DEBUG(logger_, "Add new state with hash: {}", root_hash.asBuffer());
     queued_nodes.push_back({new_trie.getRoot(), *root_hash.asHash()});
 
+    // the same state may be added again after its block was discarded
+    OUTCOME_TRY(discarded, ref_counts_.discarded(*root_hash.asHash()));
+    if (discarded) {
+      ref_counts_.setDiscarded(*root_hash.asHash(), false);
+    }
+
     size_t referenced_nodes_num = 0;
     size_t referenced_values_num = 0;
 
     while (!queued_nodes.empty()) {
       auto [node, hash] = queued_nodes.back();
       queued_nodes.pop_back();
-      auto &ref_count = ref_count_[hash];
+      OUTCOME_TRY(ref_count, ref_counts_.node(hash));
       if (ref_count == 0 && !thorough_pruning_) {
         OUTCOME_TRY(hash_is_in_storage, node_storage_->contains(hash));
         if (hash_is_in_storage) {
@@ -393,10 +594,11 @@ namespace kagome::storage::trie_pruner {
               "Node {} is unindexed, but already in storage, make it immortal",
               hash.toHex());
           ref_count++;
-          immortal_nodes_.emplace(hash);
+          ref_counts_.setImmortal(hash);
         }
       }
       ref_count++;
+      ref_counts_.setNode(hash, ref_count);
       SL_TRACE(logger_, "Add node {}, ref count {}", hash.toHex(), ref_count);
 
       referenced_nodes_num++;
@@ -405,12 +607,13 @@ namespace kagome::storage::trie_pruner {
       if (is_new_node_with_value) {
         auto value_hash_opt = encoder.getValueHash(*node, version);
         if (value_hash_opt) {
-          auto &value_ref_count = value_ref_count_[*value_hash_opt];
+          OUTCOME_TRY(value_ref_count, ref_counts_.value(*value_hash_opt));
           OUTCOME_TRY(contains_value, node_storage_->contains(*value_hash_opt));
           if (value_ref_count == 0 && contains_value && !thorough_pruning_) {
             value_ref_count++;
           }
           value_ref_count++;
+          ref_counts_.setValue(*value_hash_opt, value_ref_count);
           referenced_values_num++;
         }
       }
@@ -444,18 +647,25 @@ namespace kagome::storage::trie_pruner {
           return outcome::success();
         }));
     SL_DEBUG(logger_,
-             "Referenced {} nodes and {} values. Ref count map size: {}",
+             "Referenced {} nodes and {} values",
              referenced_nodes_num,
-             referenced_values_num,
-             ref_count_.size());
+             referenced_values_num);
     return *root_hash.asHash();
   }
 
   outcome::result<void> TriePrunerImpl::recoverState(
       const blockchain::BlockTree &block_tree) {
     std::unique_lock lock{mutex_};
+    libp2p::common::FinalAction discard{[&] { ref_counts_.discard(); }};
     static log::Logger logger =
         log::createLogger("PrunerStateRecovery", "storage");
+    if (index_ready_) {
+      SL_INFO(logger,
+              "Trie pruner ref counts are loaded from database, last pruned "
+              "block {}",
+              last_pruned_block_);
+      return outcome::success();
+    }
     auto last_pruned_block = last_pruned_block_;
     if (!last_pruned_block.has_value()) {
       if (block_tree.bestBlock().number != 0) {
@@ -480,7 +690,12 @@ namespace kagome::storage::trie_pruner {
             genesis_header,
             block_tree.getBlockHeader(block_tree.getGenesisBlockHash()));
         OUTCOME_TRY(trie, serializer_->retrieveTrie(genesis_header.state_root));
+        OUTCOME_TRY(ref_counts_.clear());
+        backlog_ = 0;
+        metric_backlog_->set(backlog_);
         OUTCOME_TRY(addNewStateWith(*trie, trie::StateVersion::V0));
+        index_ready_ = true;
+        OUTCOME_TRY(commitRefCounts());
       }
     } else {
       OUTCOME_TRY(base_block_header,
@@ -507,7 +722,11 @@ namespace kagome::storage::trie_pruner {
              "Restore state - last pruned block {}",
              last_pruned_block.blockInfo());
 
-    ref_count_.clear();
+    index_ready_ = false;
+    // queued states are not counted anymore, so they are left unpruned
+    OUTCOME_TRY(ref_counts_.clear());
+    backlog_ = 0;
+    metric_backlog_->set(backlog_);
 
     std::queue<primitives::BlockHash> block_queue;
 
@@ -526,6 +745,7 @@ namespace kagome::storage::trie_pruner {
       }
       OUTCOME_TRY(base_tree, std::move(base_tree_res));
       OUTCOME_TRY(addNewStateWith(*base_tree, trie::StateVersion::V0));
+      OUTCOME_TRY(ref_counts_.commit());
       OUTCOME_TRY(children, block_tree.getChildren(base_block_hash));
       for (auto child : children) {
         block_queue.push(child);
@@ -551,6 +771,7 @@ namespace kagome::storage::trie_pruner {
       }
       OUTCOME_TRY(tree, tree_res);
       OUTCOME_TRY(addNewStateWith(*tree, trie::StateVersion::V0));
+      OUTCOME_TRY(ref_counts_.commit());
 
       OUTCOME_TRY(children, block_tree.getChildren(block_hash));
       for (auto child : children) {
@@ -558,10 +779,28 @@ namespace kagome::storage::trie_pruner {
       }
     }
     last_pruned_block_ = last_pruned_block.blockInfo();
+    index_ready_ = true;
+    OUTCOME_TRY(commitRefCounts());
     OUTCOME_TRY(savePersistentState());
     return outcome::success();
   }
 
+  outcome::result<void> TriePrunerImpl::commitRefCounts() {
+    OUTCOME_TRY(setRefCountsInfo());
+    return ref_counts_.commit();
+  }
+
+  outcome::result<void> TriePrunerImpl::setRefCountsInfo() {
+    if (index_ready_) {
+      OUTCOME_TRY(enc_info,
+                  scale::encode(TriePrunerInfo{
+                      last_pruned_block_,
+                  }));
+      ref_counts_.setInfo(common::Buffer{std::move(enc_info)});
+    }
+    return outcome::success();
+  }
+
   outcome::result<void> TriePrunerImpl::savePersistentState() const {
     OUTCOME_TRY(enc_info,
                 scale::encode(TriePrunerInfo{
@@ -576,6 +815,7 @@ namespace kagome::storage::trie_pruner {
   void TriePrunerImpl::restoreStateAtFinalized(
       const blockchain::BlockTree &block_tree) {
     std::unique_lock lock{mutex_};
+    libp2p::common::FinalAction discard{[&] { ref_counts_.discard(); }};
     auto header_res =
         block_tree.getBlockHeader(block_tree.getLastFinalized().hash);
     if (header_res.has_error()) {
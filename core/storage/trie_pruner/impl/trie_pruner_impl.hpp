@@ -20,7 +20,9 @@
 #include "common/buffer.hpp"
 #include "log/logger.hpp"
 #include "log/profiling_logger.hpp"
+#include "metrics/metrics.hpp"
 #include "storage/buffer_map_types.hpp"
+#include "storage/trie_pruner/impl/ref_count_store.hpp"
 
 namespace kagome::application {
   class AppConfiguration;
@@ -31,6 +33,10 @@ namespace kagome::crypto {
   class Hasher;
 }
 
+namespace kagome {
+  class PoolHandler;
+}
+
 namespace kagome::storage {
   class SpacedStorage;
 }
@@ -39,13 +45,22 @@ namespace kagome::storage::trie {
   class TrieStorageBackend;
   class TrieSerializer;
   class Codec;
+  struct OpaqueTrieNode;
 }  // namespace kagome::storage::trie
 
 namespace kagome::storage::trie_pruner {
 
   using common::literals::operator""_buf;
 
-  class TriePrunerImpl final : public TriePruner {
+  class TriePrunerThreadPool;
+
+  /**
+   * Finalized and discarded states are queued in database and pruned by
+   * background thread, queue survives restarts.
+   */
+  class TriePrunerImpl final
+      : public TriePruner,
+        public std::enable_shared_from_this<TriePrunerImpl> {
    public:
     enum class Error {
       LAST_PRUNED_BLOCK_IS_LAST_FINALIZED = 1,
@@ -67,9 +82,11 @@ namespace kagome::storage::trie_pruner {
         std::shared_ptr<const storage::trie::Codec> codec,
         std::shared_ptr<storage::SpacedStorage> storage,
         std::shared_ptr<const crypto::Hasher> hasher,
-        std::shared_ptr<const application::AppConfiguration> config);
+        std::shared_ptr<const application::AppConfiguration> config,
+        std::shared_ptr<TriePrunerThreadPool> thread_pool);
 
     bool prepare();
+    bool start();
 
     virtual outcome::result<void> addNewState(
         const storage::trie::RootHash &state_root,
@@ -79,6 +96,11 @@ namespace kagome::storage::trie_pruner {
         const trie::PolkadotTrie &new_trie,
         trie::StateVersion version) override;
 
+    outcome::result<trie::RootHash> storeNewState(
+        trie::PolkadotTrie &new_trie,
+        trie::StateVersion version,
+        trie::TrieSerializer &serializer) override;
+
     virtual outcome::result<void> pruneFinalized(
         const primitives::BlockHeader &state) override;
 
@@ -90,26 +112,32 @@ namespace kagome::storage::trie_pruner {
       return last_pruned_block_;
     }
 
-    size_t getTrackedNodesNum() const {
-      return ref_count_.size();
+    size_t getTrackedNodesNum() {
+      size_t num = 0;
+      forRefCounts([&](const common::Hash256 &, size_t) { ++num; });
+      return num;
     }
 
-    size_t getRefCountOf(const common::Hash256 &node) const {
-      auto it = ref_count_.find(node);
-      return it == ref_count_.end() ? 0 : it->second;
+    size_t getRefCountOf(const common::Hash256 &node) {
+      return ref_counts_.node(node).value_or(0);
     }
 
     template <typename F>
     void forRefCounts(const F &f) {
-      for (auto &[node, count] : ref_count_) {
-        f(node, count);
-      }
+      std::ignore = ref_counts_.forNodes(f);
     }
 
     std::optional<uint32_t> getPruningDepth() const override {
       return pruning_depth_;
     }
 
+    /// Prunes next slice of first queued state, returns false if queue is
+    /// empty. State is dropped from queue after `kMaxPruneAttempts` failures.
+    outcome::result<bool> pruneNext();
+
+    /// Prunes all queued states in current thread
+    outcome::result<void> pruneQueued();
+
     outcome::result<void> recoverState(
         const blockchain::BlockTree &block_tree) override;
 
@@ -121,8 +149,19 @@ namespace kagome::storage::trie_pruner {
         const primitives::BlockHeader &last_pruned_block,
         const blockchain::BlockTree &block_tree);
 
+    struct PruneEntry {
+      common::Hash256 hash;
+      std::shared_ptr<trie::OpaqueTrieNode> node;
+    };
+
+    // prune up to `kPruneSliceNodes` nodes of first queued state
+    outcome::result<void> pruneSlice(uint64_t position,
+                                     const storage::trie::RootHash &state);
+
+    // removes nodes whose ref count becomes zero, leaves not visited
+    // nodes in `queued_nodes`
     outcome::result<void> prune(BufferBatch &node_batch,
-                                const storage::trie::RootHash &state);
+                                std::vector<PruneEntry> &queued_nodes);
 
     outcome::result<storage::trie::RootHash> addNewStateWith(
         const trie::PolkadotTrie &new_trie, trie::StateVersion version);
@@ -130,10 +169,27 @@ namespace kagome::storage::trie_pruner {
     // store the persistent pruner info to the database
     outcome::result<void> savePersistentState() const;
 
+    // write ref count changes, marking counts complete if index is ready
+    outcome::result<void> commitRefCounts();
+    outcome::result<void> setRefCountsInfo();
+
+    // queue state to be pruned in background
+    outcome::result<void> enqueue(const storage::trie::RootHash &state);
+    void schedulePruneNext();
+
+    // nodes removed while holding mutex, so state import doesn't wait for
+    // whole state to be pruned
+    static constexpr size_t kPruneSliceNodes = 4096;
+    static constexpr size_t kMaxPruneAttempts = 3;
+
     mutable std::mutex mutex_;
-    std::unordered_map<common::Hash256, size_t> ref_count_;
-    std::unordered_map<common::Hash256, size_t> value_ref_count_;
-    std::unordered_set<common::Hash256> immortal_nodes_;
+    RefCountStore ref_counts_;
+    // ref counts in database are complete, no need to restore them
+    bool index_ready_{false};
+    size_t backlog_{0};
+    bool prune_scheduled_{false};
+    // failed attempts to prune first queued state
+    size_t prune_attempts_{0};
 
     std::optional<primitives::BlockInfo> last_pruned_block_;
     std::shared_ptr<storage::trie::TrieStorageBackend> node_storage_;
@@ -144,7 +200,14 @@ namespace kagome::storage::trie_pruner {
 
     const std::optional<uint32_t> pruning_depth_{};
     const bool thorough_pruning_{false};
+    std::shared_ptr<PoolHandler> thread_handler_;
     log::Logger logger_ = log::createLogger("TriePruner", "trie_pruner");
+
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    metrics::Gauge *metric_backlog_;
+    metrics::Counter *metric_pruned_states_;
+    metrics::Counter *metric_removed_nodes_;
+    metrics::Counter *metric_skipped_states_;
   };
 
 }  // namespace kagome::storage::trie_pruner
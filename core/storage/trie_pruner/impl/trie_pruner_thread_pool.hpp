@@ -0,0 +1,23 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "injector/inject.hpp"
+#include "utils/thread_pool.hpp"
+#include "utils/watchdog.hpp"
+
+namespace kagome::storage::trie_pruner {
+  /// Removes pruned states in background, so finalization doesn't wait
+  class TriePrunerThreadPool final : public ThreadPool {
+   public:
+    TriePrunerThreadPool(std::shared_ptr<Watchdog> watchdog, Inject)
+        : ThreadPool(std::move(watchdog), "trie_pruner", 1, std::nullopt) {}
+
+    // Ctor for test purposes
+    TriePrunerThreadPool(TestThreadPool test) : ThreadPool{test} {}
+  };
+}  // namespace kagome::storage::trie_pruner
@@ -11,16 +11,13 @@
 #include "common/buffer.hpp"
 #include "primitives/block_header.hpp"
 #include "primitives/block_id.hpp"
+#include "storage/trie/serialization/trie_serializer.hpp"
 #include "storage/trie/types.hpp"
 
 namespace kagome::blockchain {
   class BlockTree;
 }
 
-namespace kagome::storage::trie {
-  class PolkadotTrie;
-}
-
 namespace kagome::storage::trie_pruner {
 
   /**
@@ -52,10 +49,24 @@ namespace kagome::storage::trie_pruner {
     virtual outcome::result<void> addNewState(
         const trie::PolkadotTrie &new_trie, trie::StateVersion version) = 0;
 
+    /**
+     * Register a new trie and store its nodes with \param serializer.
+     * @note Implementations keeping ref counts in the node database write
+     * them in the same batch as the nodes
+     * @return root hash of the stored trie
+     */
+    virtual outcome::result<trie::RootHash> storeNewState(
+        trie::PolkadotTrie &new_trie,
+        trie::StateVersion version,
+        trie::TrieSerializer &serializer) {
+      OUTCOME_TRY(addNewState(new_trie, version));
+      return serializer.storeTrie(new_trie, version);
+    }
+
     /**
      * Prune the trie of a finalized block \param state.
      * Nodes belonging to this trie are deleted if no other trie references
-     * them.
+     * them. Deletion may be deferred to background.
      * @param state header of the block which state is to be pruned.
      */
     virtual outcome::result<void> pruneFinalized(
@@ -64,7 +75,7 @@ namespace kagome::storage::trie_pruner {
     /**
      * Prune the trie of a discarded block \param state.
      * Nodes belonging to this trie are deleted if no other trie references
-     * them.
+     * them. Deletion may be deferred to background.
      * @param state header of the block which state is to be pruned.
      */
     virtual outcome::result<void> pruneDiscarded(
@@ -4,10 +4,19 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include "application/chain_spec.hpp"
 #include "application/impl/app_configuration_impl.hpp"
+#include "benchmark/approval_benchmark.hpp"
 #include "benchmark/block_execution_benchmark.hpp"
+#include "benchmark/host_benchmark.hpp"
+#include "benchmark/network_benchmark.hpp"
+#include "benchmark/parachain_benchmark.hpp"
+#include "benchmark/runtime_benchmark.hpp"
+#include "benchmark/storage_benchmark.hpp"
+#include "benchmark/trie_commit_benchmark.hpp"
 #include "common/visitor.hpp"
 #include "injector/application_injector.hpp"
+#include "runtime/common/host_api_profiler.hpp"
 #include "runtime/runtime_api/impl/core.hpp"
 
 namespace kagome {
@@ -18,7 +27,8 @@ namespace kagome {
     if (argc == 1) {
       SL_ERROR(logger,
                "Usage: kagome benchmark BENCHMARK-TYPE BENCHMARK-OPTIONS\n"
-               "Available benchmark types are: block");
+               "Available benchmark types are: block, trie-commit, storage, "
+               "runtime, host, parachain, approval, network");
       return -1;
     }
 
@@ -28,6 +38,7 @@ namespace kagome {
       return -1;
     }
     kagome::log::tuneLoggingSystem(app_config->log());
+    runtime::HostApiProfiler::enable(app_config->profileHostApi());
 
     injector::KagomeNodeInjector injector{app_config};
 
@@ -38,7 +49,15 @@ namespace kagome {
     }
     auto &benchmark_config = *config_opt;
 
-    auto block_benchmark = injector.injectBlockBenchmark();
+    auto run_scenario =
+        [&](benchmark::BenchmarkScenario &scenario,
+            const std::optional<filesystem::path> &output)
+        -> outcome::result<void> {
+      SL_INFO(logger, "Run {} benchmark", scenario.name());
+      benchmark::BenchmarkReport report{app_config->nodeVersion()};
+      OUTCOME_TRY(scenario.run(report));
+      return report.write(output);
+    };
 
     auto res = visit_in_place(
         benchmark_config,
@@ -53,9 +72,73 @@ namespace kagome {
                   "Kagome started. Version: {} ",
                   app_config->nodeVersion());
 
+          auto block_benchmark = injector.injectBlockBenchmark();
           OUTCOME_TRY(block_benchmark->run(config_));
 
           return outcome::success();
+        },
+        [&](application::TrieCommitBenchmarkConfig config)
+            -> outcome::result<void> {
+          benchmark::TrieCommitBenchmark scenario{{
+              .keys = config.keys,
+              .times = config.times,
+              .threads = config.threads,
+          }};
+          return run_scenario(scenario, config.output);
+        },
+        [&](application::StorageBenchmarkConfig config)
+            -> outcome::result<void> {
+          // next to the node database, so the same disk is measured
+          auto db_path =
+              app_config->databasePath(injector.injectChainSpec()->id())
+                  .parent_path()
+              / filesystem::unique_path("benchmark-db-%%%%-%%%%");
+          benchmark::StorageBenchmark scenario{{
+              .keys = config.keys,
+              .times = config.times,
+              .db_path = std::move(db_path),
+          }};
+          return run_scenario(scenario, config.output);
+        },
+        [&](application::RuntimeBenchmarkConfig config)
+            -> outcome::result<void> {
+          return run_scenario(*injector.injectRuntimeBenchmark(),
+                              config.output);
+        },
+        [&](application::HostBenchmarkConfig config)
+            -> outcome::result<void> {
+          benchmark::HostBenchmark scenario{{.times = config.times}};
+          return run_scenario(scenario, config.output);
+        },
+        [&](application::ParachainBenchmarkConfig config)
+            -> outcome::result<void> {
+          using benchmark::ParachainBenchmark;
+          ParachainBenchmark scenario{{
+              .validators = config.sweep ? ParachainBenchmark::kSweepValidators
+                                         : std::vector{config.validators},
+              .pov_sizes = config.sweep ? ParachainBenchmark::kSweepPovSizes
+                                        : std::vector{config.pov_size},
+              .times = config.times,
+          }};
+          return run_scenario(scenario, config.output);
+        },
+        [&](application::ApprovalBenchmarkConfig config)
+            -> outcome::result<void> {
+          benchmark::ApprovalBenchmark scenario{{
+              .validators = config.validators,
+              .threads = config.threads,
+              .times = config.times,
+              .traffic = config.traffic,
+          }};
+          return run_scenario(scenario, config.output);
+        },
+        [&](application::NetworkBenchmarkConfig config)
+            -> outcome::result<void> {
+          benchmark::NetworkBenchmark scenario{{
+              .peers = config.peers,
+              .times = config.times,
+          }};
+          return run_scenario(scenario, config.output);
         });
 
     if (res.has_error()) {
@@ -0,0 +1,73 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+#include <boost/asio/post.hpp>
+
+#include "utils/thread_pool.hpp"
+
+namespace kagome {
+  /**
+   * Calls `f(i)` for each `i` in `[0, count)` on at most `max_threads`
+   * threads: the calling one and threads of the `pool`.
+   * Indices are taken one by one, so uneven items are balanced.
+   * The calling thread takes indices too and waits only for calls already
+   * started by the pool, so it neither deadlocks when called from the pool
+   * itself nor waits for a busy pool.
+   * `f` must not throw.
+   */
+  inline void parallelFor(const ThreadPool &pool,
+                          size_t count,
+                          size_t max_threads,
+                          const std::function<void(size_t)> &f) {
+    if (count == 0) {
+      return;
+    }
+    struct State {
+      const std::function<void(size_t)> *f = nullptr;
+      size_t count = 0;
+      std::atomic_size_t next = 0;
+      std::mutex mutex;
+      std::condition_variable cv;
+      size_t done = 0;
+    };
+    auto state = std::make_shared<State>();
+    state->f = &f;
+    state->count = count;
+    // pool task may start after the call returned, it must not touch `f`
+    // unless it took an index
+    auto work = [](State &state) {
+      size_t done = 0;
+      for (auto i = state.next++; i < state.count; i = state.next++) {
+        (*state.f)(i);
+        ++done;
+      }
+      if (done == 0) {
+        return;
+      }
+      std::unique_lock lock{state.mutex};
+      state.done += done;
+      if (state.done == state.count) {
+        state.cv.notify_one();
+      }
+    };
+    auto helpers = std::min(std::max<size_t>(max_threads, 1), count) - 1;
+    for (size_t i = 0; i < helpers; ++i) {
+      boost::asio::post(*pool.io_context(),
+                        [state, work] { work(*state); });
+    }
+    work(*state);
+    std::unique_lock lock{state->mutex};
+    state->cv.wait(lock, [&] { return state->done == state->count; });
+  }
+}  // namespace kagome
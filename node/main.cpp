@@ -24,6 +24,7 @@
 #include "log/configurator.hpp"
 #include "log/logger.hpp"
 #include "parachain/pvf/kagome_pvf_worker.hpp"
+#include "runtime/common/host_api_profiler.hpp"
 
 using kagome::application::AppConfiguration;
 using kagome::application::AppConfigurationImpl;
@@ -44,6 +45,7 @@ namespace {
     }
 
     kagome::log::tuneLoggingSystem(configuration->log());
+    kagome::runtime::HostApiProfiler::enable(configuration->profileHostApi());
 
     auto injector =
         std::make_unique<kagome::injector::KagomeNodeInjector>(configuration);
@@ -0,0 +1,111 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/service/impl/rpc_worker_pool.hpp"
+
+#include <future>
+
+#include <gtest/gtest.h>
+
+#include "mock/core/application/app_configuration_mock.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::Watchdog;
+using kagome::api::RpcWorkerPool;
+using kagome::application::AppConfigurationMock;
+using Lane = RpcWorkerPool::Lane;
+using testing::Return;
+
+class RpcWorkerPoolTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    ON_CALL(app_config, rpcThreads()).WillByDefault(Return(2));
+    ON_CALL(app_config, rpcMaxQueuedRequests()).WillByDefault(Return(1));
+    pool = std::make_shared<RpcWorkerPool>(watchdog, app_config);
+  }
+
+  void TearDown() override {
+    watchdog->stop();
+    pool.reset();
+  }
+
+  AppConfigurationMock app_config;
+  std::shared_ptr<Watchdog> watchdog =
+      std::make_shared<Watchdog>(std::chrono::milliseconds(1));
+  std::shared_ptr<RpcWorkerPool> pool;
+};
+
+/**
+ * @given method names
+ * @when lane is chosen
+ * @then subscriptions and cheap methods are fast, runtime calls are separate
+ */
+TEST_F(RpcWorkerPoolTest, Lanes) {
+  EXPECT_EQ(RpcWorkerPool::lane("chain_subscribeNewHeads"), Lane::Fast);
+  EXPECT_EQ(RpcWorkerPool::lane("state_unsubscribeStorage"), Lane::Fast);
+  EXPECT_EQ(RpcWorkerPool::lane("author_submitAndWatchExtrinsic"), Lane::Fast);
+  EXPECT_EQ(RpcWorkerPool::lane("chain_getHeader"), Lane::Fast);
+  EXPECT_EQ(RpcWorkerPool::lane("state_call"), Lane::Runtime);
+  EXPECT_EQ(RpcWorkerPool::lane("state_getKeysPaged"), Lane::Runtime);
+  EXPECT_EQ(RpcWorkerPool::lane("chain_getBlock"), Lane::Default);
+  EXPECT_EQ(RpcWorkerPool::lane(""), Lane::Default);
+}
+
+/**
+ * @given requests
+ * @when method and busy response are built
+ * @then method is empty for batches, response keeps request id
+ */
+TEST_F(RpcWorkerPoolTest, Requests) {
+  EXPECT_EQ(RpcWorkerPool::method(R"({"id":7,"method":"state_call"})"),
+            "state_call");
+  EXPECT_EQ(RpcWorkerPool::method(R"([{"method":"state_call"}])"), "");
+  EXPECT_EQ(RpcWorkerPool::method("{"), "");
+
+  EXPECT_EQ(RpcWorkerPool::busyResponse(R"({"id":"a","method":"state_call"})"),
+            R"({"jsonrpc":"2.0","id":"a","error":{"code":-32009,)"
+            R"("message":"Server is busy, try again later"}})");
+  EXPECT_EQ(RpcWorkerPool::busyResponse("{"),
+            R"({"jsonrpc":"2.0","id":null,"error":{"code":-32009,)"
+            R"("message":"Server is busy, try again later"}})");
+}
+
+/**
+ * @given runtime method limited to one running and one queued request
+ * @when more requests of the method arrive while the first is running
+ * @then excess request is rejected, other methods are not blocked, queued
+ * request runs after the first one
+ */
+TEST_F(RpcWorkerPoolTest, Limits) {
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  std::promise<void> first_done, second_done, other_done;
+
+  EXPECT_TRUE(pool->execute("state_call", [&, released] {
+    released.wait();
+    first_done.set_value();
+  }));
+  EXPECT_TRUE(pool->execute("state_call", [&] { second_done.set_value(); }));
+  EXPECT_FALSE(pool->execute("state_call", [] { FAIL(); }));
+
+  EXPECT_TRUE(pool->execute("chain_getBlock", [&] { other_done.set_value(); }));
+  other_done.get_future().wait();
+
+  auto second = second_done.get_future();
+  EXPECT_EQ(second.wait_for(std::chrono::milliseconds(10)),
+            std::future_status::timeout);
+  release.set_value();
+  first_done.get_future().wait();
+  second.wait();
+
+  bool fast = false;
+  EXPECT_TRUE(pool->execute("chain_getHeader", [&] { fast = true; }));
+  EXPECT_TRUE(fast);
+}
@@ -18,11 +18,19 @@
 #include "mock/core/runtime/core_mock.hpp"
 #include "mock/core/runtime/metadata_mock.hpp"
 #include "mock/core/runtime/runtime_context_factory_mock.hpp"
+#include "mock/core/storage/trie/serialization/trie_serializer_mock.hpp"
 #include "mock/core/storage/trie/trie_batches_mock.hpp"
 #include "mock/core/storage/trie/trie_storage_mock.hpp"
+#include "mock/core/storage/trie_pruner/trie_pruner_mock.hpp"
 #include "primitives/block_header.hpp"
 #include "runtime/executor.hpp"
 #include "runtime/runtime_context.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/impl/trie_storage_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
 #include "testutil/lazy.hpp"
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
@@ -39,8 +47,18 @@ using kagome::primitives::BlockNumber;
 using kagome::runtime::CoreMock;
 using kagome::runtime::Executor;
 using kagome::runtime::MetadataMock;
+using kagome::storage::InMemorySpacedStorage;
+using kagome::storage::trie::PolkadotCodec;
+using kagome::storage::trie::PolkadotTrie;
+using kagome::storage::trie::PolkadotTrieFactoryImpl;
 using kagome::storage::trie::TrieBatchMock;
+using kagome::storage::trie::TrieSerializer;
+using kagome::storage::trie::TrieSerializerImpl;
+using kagome::storage::trie::TrieSerializerMock;
+using kagome::storage::trie::TrieStorageBackendImpl;
+using kagome::storage::trie::TrieStorageImpl;
 using kagome::storage::trie::TrieStorageMock;
+using kagome::storage::trie_pruner::TriePrunerMock;
 using testing::_;
 using testing::ElementsAre;
 using testing::Return;
@@ -65,6 +83,7 @@ namespace kagome::api {
       api_ = std::make_unique<api::StateApiImpl>(
           block_header_repo_,
           storage_,
+          serializer_,
           block_tree_,
           runtime_core_,
           metadata_,
@@ -75,6 +94,15 @@ namespace kagome::api {
    protected:
     std::shared_ptr<TrieStorageMock> storage_ =
         std::make_shared<TrieStorageMock>();
+    std::shared_ptr<PolkadotTrieFactoryImpl> trie_factory_ =
+        std::make_shared<PolkadotTrieFactoryImpl>();
+    std::shared_ptr<PolkadotCodec> codec_ = std::make_shared<PolkadotCodec>();
+    std::shared_ptr<TrieSerializer> serializer_ =
+        std::make_shared<TrieSerializerImpl>(
+            trie_factory_,
+            codec_,
+            std::make_shared<TrieStorageBackendImpl>(
+                std::make_shared<InMemorySpacedStorage>()));
     std::shared_ptr<BlockHeaderRepositoryMock> block_header_repo_ =
         std::make_shared<BlockHeaderRepositoryMock>();
     std::shared_ptr<BlockTreeMock> block_tree_ =
@@ -135,6 +163,7 @@ namespace kagome::api {
       api_ = std::make_shared<api::StateApiImpl>(
           block_header_repo_,
           storage,
+          std::make_shared<TrieSerializerMock>(),
           block_tree_,
           runtime_core,
           metadata,
@@ -391,36 +420,117 @@ namespace kagome::api {
         .WillOnce(testing::Return(1));
     EXPECT_CALL(*block_header_repo_, getNumberByHash(to))
         .WillOnce(testing::Return(4));
-    for (auto &block_hash : block_range) {
-      primitives::BlockHash state_root;
-      auto s = block_hash.toString() + "_etats";
-      std::copy_if(s.begin(), s.end(), state_root.begin(), [](auto b) {
-        return b != 0;
-      });
-      EXPECT_CALL(*block_header_repo_, getBlockHeader(block_hash))
-          .WillOnce(testing::Return(makeBlockHeaderOfStateRoot(state_root)));
-      EXPECT_CALL(*storage_, getEphemeralBatchAt(state_root))
-          .WillOnce(testing::Invoke([&keys](auto &root) {
-            auto batch = std::make_unique<storage::trie::TrieBatchMock>();
-            for (auto &key : keys) {
-              EXPECT_CALL(*batch, tryGetMock(key.view()))
-                  .WillOnce(testing::Return(common::Buffer(root)));
-            }
-            return batch;
-          }));
+
+    // key1 changes in every block, key2 in the last one, key3 never
+    auto state_pruner = std::make_shared<TriePrunerMock>();
+    ON_CALL(*state_pruner, addNewState(testing::A<const PolkadotTrie &>(), _))
+        .WillByDefault(Return(outcome::success()));
+    std::shared_ptr<storage::trie::TrieStorage> trie =
+        TrieStorageImpl::createEmpty(
+            trie_factory_, codec_, serializer_, state_pruner)
+            .value();
+    auto root = serializer_->getEmptyRootHash();
+    std::vector<storage::trie::RootHash> roots;
+    for (size_t i = 0; i < block_range.size(); ++i) {
+      auto batch = trie->getPersistentBatchAt(root, std::nullopt).value();
+      EXPECT_OUTCOME_TRUE_1(
+          batch->put("key1"_buf, Buffer::fromString(std::to_string(i))));
+      if (i == 0) {
+        EXPECT_OUTCOME_TRUE_1(batch->put("key2"_buf, "old"_buf));
+        EXPECT_OUTCOME_TRUE_1(batch->put("key3"_buf, "same"_buf));
+      } else if (i == block_range.size() - 1) {
+        EXPECT_OUTCOME_TRUE_1(batch->remove("key2"_buf));
+      }
+      root = batch->commit(storage::trie::StateVersion::V0).value();
+      roots.emplace_back(root);
+      EXPECT_CALL(*block_header_repo_, getBlockHeader(block_range[i]))
+          .WillOnce(testing::Return(makeBlockHeaderOfStateRoot(root)));
     }
+    EXPECT_CALL(*storage_, getEphemeralBatchAt(roots.front()))
+        .WillOnce(testing::Invoke(
+            [&](auto &root) { return trie->getEphemeralBatchAt(root); }));
+
+    // WHEN
+    EXPECT_OUTCOME_TRUE(changes, api_->queryStorage(keys, from, to))
+
+    // THEN
+    using Change = StateApiImpl::StorageChangeSet::Change;
+    auto change = [](const Change &change) {
+      return std::make_pair(change.key, change.data);
+    };
+    ASSERT_EQ(changes.size(), block_range.size());
+    for (size_t i = 0; i < changes.size(); ++i) {
+      ASSERT_EQ(changes[i].block, block_range[i]);
+      using Pair = std::pair<Buffer, std::optional<Buffer>>;
+      Pair key1{"key1"_buf, Buffer::fromString(std::to_string(i))};
+      std::vector<Pair> actual;
+      std::ranges::transform(
+          changes[i].changes, std::back_inserter(actual), change);
+      if (i == 0) {
+        EXPECT_THAT(actual,
+                    ElementsAre(key1,
+                                Pair{"key2"_buf, "old"_buf},
+                                Pair{"key3"_buf, "same"_buf}));
+      } else if (i == changes.size() - 1) {
+        EXPECT_THAT(actual, ElementsAre(key1, Pair{"key2"_buf, std::nullopt}));
+      } else {
+        EXPECT_THAT(actual, ElementsAre(key1));
+      }
+    }
+  }
+
+  /**
+   * @given a key which changed in every queried block
+   * @when querying its changes through queryStorage with the key twice
+   * @then the key is reported once for every block
+   */
+  TEST_F(StateApiTest, QueryStorageDeduplicatesKeys) {
+    // GIVEN
+    std::vector<common::Buffer> keys{"key1"_buf, "key1"_buf};
+    primitives::BlockHash from{"from"_hash256};
+    primitives::BlockHash to{"to"_hash256};
+
+    std::vector block_range{from, to};
+    EXPECT_CALL(*block_tree_, getChainByBlocks(from, to))
+        .WillOnce(testing::Return(block_range));
+    EXPECT_CALL(*block_header_repo_, getNumberByHash(from))
+        .WillOnce(testing::Return(1));
+    EXPECT_CALL(*block_header_repo_, getNumberByHash(to))
+        .WillOnce(testing::Return(2));
+
+    auto state_pruner = std::make_shared<TriePrunerMock>();
+    ON_CALL(*state_pruner, addNewState(testing::A<const PolkadotTrie &>(), _))
+        .WillByDefault(Return(outcome::success()));
+    std::shared_ptr<storage::trie::TrieStorage> trie =
+        TrieStorageImpl::createEmpty(
+            trie_factory_, codec_, serializer_, state_pruner)
+            .value();
+    auto root = serializer_->getEmptyRootHash();
+    std::vector<storage::trie::RootHash> roots;
+    for (size_t i = 0; i < block_range.size(); ++i) {
+      auto batch = trie->getPersistentBatchAt(root, std::nullopt).value();
+      EXPECT_OUTCOME_TRUE_1(
+          batch->put("key1"_buf, Buffer::fromString(std::to_string(i))));
+      root = batch->commit(storage::trie::StateVersion::V0).value();
+      roots.emplace_back(root);
+      EXPECT_CALL(*block_header_repo_, getBlockHeader(block_range[i]))
+          .WillOnce(testing::Return(makeBlockHeaderOfStateRoot(root)));
+    }
+    EXPECT_CALL(*storage_, getEphemeralBatchAt(roots.front()))
+        .WillOnce(testing::Invoke(
+            [&](auto &root) { return trie->getEphemeralBatchAt(root); }));
+
     // WHEN
     EXPECT_OUTCOME_TRUE(changes, api_->queryStorage(keys, from, to))
 
     // THEN
-    auto current_block = block_range.begin();
-    for (auto &block_changes : changes) {
-      ASSERT_EQ(*current_block, block_changes.block);
-      ASSERT_THAT(block_changes.changes,
-                  ::testing::Each(::testing::Field(
-                      &StateApiImpl::StorageChangeSet::Change::key,
-                      ContainedIn(keys))));
-      current_block++;
+    ASSERT_EQ(changes.size(), block_range.size());
+    for (size_t i = 0; i < changes.size(); ++i) {
+      ASSERT_EQ(changes[i].block, block_range[i]);
+      ASSERT_EQ(changes[i].changes.size(), 1);
+      EXPECT_EQ(changes[i].changes[0].key, "key1"_buf);
+      EXPECT_EQ(changes[i].changes[0].data,
+                Buffer::fromString(std::to_string(i)));
     }
   }
 
@@ -14,6 +14,7 @@
 #include "api/jrpc/jrpc_server.hpp"
 #include "api/service/impl/api_service_impl.hpp"
 #include "api/service/impl/rpc_thread_pool.hpp"
+#include "api/service/impl/rpc_worker_pool.hpp"
 #include "application/impl/app_state_manager_impl.hpp"
 #include "common/buffer.hpp"
 #include "core/api/client/http_client.hpp"
@@ -40,6 +41,7 @@ using namespace kagome::subscription;
 using namespace kagome::primitives;
 using kagome::Watchdog;
 using kagome::api::RpcThreadPool;
+using kagome::api::RpcWorkerPool;
 using kagome::application::AppConfigurationMock;
 using kagome::application::AppStateManager;
 using kagome::blockchain::BlockTree;
@@ -95,6 +97,8 @@ struct ListenerTest : public ::testing::Test {
     endpoint.port(1024 + rand % (65536 - 1024));  // random non-sudo port
     ON_CALL(app_config, rpcEndpoint()).WillByDefault(ReturnRef(endpoint));
     ON_CALL(app_config, maxWsConnections()).WillByDefault(Return(100));
+    ON_CALL(app_config, rpcThreads()).WillByDefault(Return(2));
+    ON_CALL(app_config, rpcMaxQueuedRequests()).WillByDefault(Return(16));
 
     listener = std::make_shared<ListenerImpl>(
         *app_state_manager, main_context, app_config, session_config);
@@ -111,7 +115,8 @@ struct ListenerTest : public ::testing::Test {
         block_tree,
         trie_storage,
         core,
-        rpc_thread_pool);
+        rpc_thread_pool,
+        std::make_shared<RpcWorkerPool>(watchdog, app_config));
   }
 
   void TearDown() override {
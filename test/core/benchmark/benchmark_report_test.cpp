@@ -0,0 +1,88 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmark/benchmark_report.hpp"
+
+#include <gtest/gtest.h>
+
+#define RAPIDJSON_NO_SIZETYPEDEFINE
+namespace rapidjson {
+  typedef ::std::size_t SizeType;
+}
+#include <rapidjson/document.h>
+
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::benchmark::BenchmarkReport;
+using kagome::benchmark::BenchmarkStats;
+using std::chrono::nanoseconds;
+
+class BenchmarkReportTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  /// 1..100 ns in reverse order
+  static std::vector<nanoseconds> samples() {
+    std::vector<nanoseconds> samples;
+    for (auto i = 100; i > 0; --i) {
+      samples.emplace_back(i);
+    }
+    return samples;
+  }
+};
+
+/**
+ * @given unsorted samples of runs of two operations each
+ * @when stats are computed
+ * @then percentiles are nearest-rank durations per operation
+ */
+TEST_F(BenchmarkReportTest, Stats) {
+  auto stats = BenchmarkStats::of(samples(), 2);
+  EXPECT_EQ(stats.samples, 100);
+  EXPECT_DOUBLE_EQ(stats.min.count(), 0.5);
+  EXPECT_DOUBLE_EQ(stats.avg.count(), 25.25);
+  EXPECT_DOUBLE_EQ(stats.p50.count(), 25);
+  EXPECT_DOUBLE_EQ(stats.p90.count(), 45);
+  EXPECT_DOUBLE_EQ(stats.p99.count(), 49.5);
+  EXPECT_DOUBLE_EQ(stats.max.count(), 50);
+
+  auto single = BenchmarkStats::of({nanoseconds{7}}, 1);
+  EXPECT_DOUBLE_EQ(single.p50.count(), 7);
+  EXPECT_DOUBLE_EQ(single.p99.count(), 7);
+}
+
+/**
+ * @given a report with measurements of two scenarios
+ * @when it is serialized
+ * @then JSON contains an entry per measurement with its stats
+ */
+TEST_F(BenchmarkReportTest, Json) {
+  BenchmarkReport report{"1.0"};
+  report.add("host", "blake2b_256/32", samples());
+  auto noop = []() -> outcome::result<void> { return outcome::success(); };
+  EXPECT_OUTCOME_TRUE_1(report.measure("storage", "trie-get", 3, 10, noop));
+  report.add("storage", "empty", {});
+  ASSERT_EQ(report.entries().size(), 2);
+
+  rapidjson::Document document;
+  document.Parse(report.toJson().c_str());
+  ASSERT_FALSE(document.HasParseError());
+  EXPECT_STREQ(document["version"].GetString(), "1.0");
+  auto &results = document["results"];
+  ASSERT_EQ(results.Size(), 2);
+  auto &host = results[size_t{0}];
+  EXPECT_STREQ(host["scenario"].GetString(), "host");
+  EXPECT_STREQ(host["name"].GetString(), "blake2b_256/32");
+  EXPECT_EQ(host["samples"].GetUint64(), 100);
+  EXPECT_DOUBLE_EQ(host["p90"].GetDouble(), 90);
+  auto &storage = results[size_t{1}];
+  EXPECT_STREQ(storage["scenario"].GetString(), "storage");
+  EXPECT_EQ(storage["samples"].GetUint64(), 3);
+  EXPECT_EQ(storage["ops"].GetUint64(), 10);
+}
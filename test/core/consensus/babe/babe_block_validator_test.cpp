@@ -17,6 +17,7 @@
 #include "mock/core/crypto/vrf_provider_mock.hpp"
 #include "mock/core/runtime/babe_api_mock.hpp"
 #include "testutil/lazy.hpp"
+#include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 #include "testutil/prepare_loggers.hpp"
 #include "testutil/sr25519_utils.hpp"
@@ -363,3 +364,37 @@ TEST_F(BabeBlockValidatorTest, ThresholdGreater) {
                        block_validator->validateHeader(valid_block_.header));
   ASSERT_EQ(err, ValidatingError::INVALID_VRF);
 }
+
+/**
+ * @given header prevalidated against its applied ancestor
+ * @when validating the header
+ * @then seal and VRF are not checked again
+ */
+TEST_F(BabeBlockValidatorTest, Prevalidated) {
+  auto block_copy = valid_block_;
+  auto encoded_block_copy = scale::encode(block_copy.header).value();
+  BlockHash encoded_block_copy_hash{};  // not a real hash, but don't want to
+                                        // actually take it
+  std::copy(encoded_block_copy.begin(),
+            encoded_block_copy.begin() + BlockHash::size(),
+            encoded_block_copy_hash.begin());
+
+  auto [seal, pubkey] = sealBlock(valid_block_, encoded_block_copy_hash);
+  valid_block_.header.hash_opt = "block"_hash256;
+  auto ancestor = block_header_;
+  ancestor.number = block_header_.number - 2;
+  ancestor.hash_opt = "ancestor"_hash256;
+
+  authorities.emplace_back();
+  authorities.emplace_back(Authority{AuthorityId{pubkey}, 42});
+
+  EXPECT_CALL(*hasher, blake2b_256(_))
+      .WillOnce(Return(encoded_block_copy_hash));
+  EXPECT_CALL(*sr25519_provider, verify(_, _, pubkey))
+      .WillOnce(Return(outcome::result<bool>(true)));
+  EXPECT_CALL(*vrf_provider, verifyTranscript(_, _, pubkey, _))
+      .WillOnce(Return(VRFVerifyOutput{.is_valid = true, .is_less = true}));
+
+  block_validator->prevalidateHeader(valid_block_.header, ancestor);
+  EXPECT_OUTCOME_TRUE_1(block_validator->validateHeader(valid_block_.header));
+}
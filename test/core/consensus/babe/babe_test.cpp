@@ -280,6 +280,7 @@ class BabeTest : public testing::Test {
         proposer,
         storage_sub_engine,
         chain_sub_engine,
+        nullptr,
         announce_transmitter,
         babe_api,
         offchain_worker_api,
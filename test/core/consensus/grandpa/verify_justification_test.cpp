@@ -0,0 +1,154 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/grandpa/verify_justification.hpp"
+
+#include <gtest/gtest.h>
+
+#include "consensus/grandpa/voter_set.hpp"
+#include "consensus/grandpa/voting_round_error.hpp"
+#include "core/consensus/grandpa/literals.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "mock/core/consensus/grandpa/chain_mock.hpp"
+#include "mock/core/crypto/ed25519_provider_mock.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+#include "utils/thread_pool.hpp"
+#include "utils/watchdog.hpp"
+
+using kagome::TestThreadPool;
+using kagome::ThreadPool;
+using kagome::Watchdog;
+using kagome::consensus::grandpa::ChainMock;
+using kagome::consensus::grandpa::GrandpaJustification;
+using kagome::consensus::grandpa::Precommit;
+using kagome::consensus::grandpa::SignedPrecommit;
+using kagome::consensus::grandpa::verifyJustification;
+using kagome::consensus::grandpa::VoterSet;
+using kagome::consensus::grandpa::VotingRoundError;
+using kagome::crypto::Ed25519ProviderMock;
+using kagome::crypto::Ed25519Signature;
+using kagome::crypto::HasherImpl;
+using kagome::primitives::BlockInfo;
+using testing::_;
+using testing::Return;
+
+class VerifyJustificationTest : public testing::Test {
+ public:
+  /// enough voters to split signatures between several threads
+  static constexpr size_t kVoters = 100;
+
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    for (size_t i = 0; i < kVoters; ++i) {
+      ASSERT_OUTCOME_SUCCESS_TRY(voters.insert(id(i), 1));
+    }
+    ON_CALL(ed25519, verify(_, _, _)).WillByDefault(Return(true));
+  }
+
+  static kagome::consensus::grandpa::Id id(size_t i) {
+    return makeId("voter" + std::to_string(i));
+  }
+
+  /// justification signed by first `signed_count` voters
+  GrandpaJustification justification(size_t signed_count) {
+    GrandpaJustification justification{
+        .round_number = 7,
+        .block_info = block,
+    };
+    for (size_t i = 0; i < signed_count; ++i) {
+      SignedPrecommit precommit;
+      precommit.message = Precommit{block.number, block.hash};
+      precommit.signature = makeSig("sig" + std::to_string(i));
+      precommit.id = id(i);
+      justification.items.emplace_back(std::move(precommit));
+    }
+    return justification;
+  }
+
+  BlockInfo block{10, "block"_H};
+  VoterSet voters{3};
+  HasherImpl hasher;
+  Ed25519ProviderMock ed25519;
+  ChainMock chain;
+  // pool doesn't run tasks, so signatures are verified by the test thread
+  ThreadPool pool{TestThreadPool{}};
+};
+
+/**
+ * @given justification signed by super-majority of voters
+ * @when justification is verified
+ * @then verification succeeds
+ */
+TEST_F(VerifyJustificationTest, Valid) {
+  ASSERT_OUTCOME_SUCCESS_TRY(
+      verifyJustification(justification(kVoters * 2 / 3 + 1),
+                          voters,
+                          hasher,
+                          ed25519,
+                          chain,
+                          pool));
+}
+
+/**
+ * @given justification with one invalid signature
+ * @when justification is verified
+ * @then verification fails
+ */
+TEST_F(VerifyJustificationTest, InvalidSignature) {
+  auto bad = makeSig("sig" + std::to_string(kVoters - 1));
+  EXPECT_CALL(ed25519, verify(_, _, _)).WillRepeatedly(Return(true));
+  EXPECT_CALL(ed25519, verify(bad, _, _)).WillRepeatedly(Return(false));
+  EXPECT_OUTCOME_ERROR(
+      res,
+      verifyJustification(
+          justification(kVoters), voters, hasher, ed25519, chain, pool),
+      VotingRoundError::INVALID_SIGNATURE);
+}
+
+/**
+ * @given justification signed by less than super-majority of voters
+ * @when justification is verified
+ * @then verification fails
+ */
+TEST_F(VerifyJustificationTest, NotEnoughWeight) {
+  EXPECT_OUTCOME_ERROR(res,
+                       verifyJustification(justification(kVoters * 2 / 3),
+                                           voters,
+                                           hasher,
+                                           ed25519,
+                                           chain,
+                                           pool),
+                       VotingRoundError::NOT_ENOUGH_WEIGHT);
+}
+
+/**
+ * @given justification with invalid signature in the last chunk and pool
+ * running tasks on two threads
+ * @when justification is verified
+ * @then verification fails
+ */
+TEST_F(VerifyJustificationTest, InvalidSignatureOnPool) {
+  auto watchdog = std::make_shared<Watchdog>(std::chrono::milliseconds(1));
+  auto worker_pool =
+      std::make_unique<ThreadPool>(watchdog, "worker", 2, std::nullopt);
+  auto bad = makeSig("sig" + std::to_string(kVoters - 1));
+  EXPECT_CALL(ed25519, verify(_, _, _)).WillRepeatedly(Return(true));
+  EXPECT_CALL(ed25519, verify(bad, _, _)).WillRepeatedly(Return(false));
+  EXPECT_OUTCOME_ERROR(res,
+                       verifyJustification(justification(kVoters),
+                                           voters,
+                                           hasher,
+                                           ed25519,
+                                           chain,
+                                           *worker_pool),
+                       VotingRoundError::INVALID_SIGNATURE);
+  watchdog->stop();
+  worker_pool.reset();
+}
@@ -197,6 +197,7 @@ class BlockExecutorTest : public testing::Test {
                                                offchain_worker_api_,
                                                storage_sub_engine_,
                                                chain_sub_engine_,
+                                               nullptr,
                                                std::move(appender));
 
     app_state_manager.start();
@@ -312,3 +313,68 @@ TEST_F(BlockExecutorTest, JustificationFollowDigests) {
 
   latch.wait();
 }
+
+/**
+ * @given a block being executed
+ * @when its child is submitted
+ * @then the child is queued, its header is prevalidated against the applied
+ * ancestor, and it is executed after the parent
+ */
+TEST_F(BlockExecutorTest, ChildOfApplyingBlockIsQueued) {
+  kagome::primitives::BlockHash grandparent_hash = "grandparent"_hash256;
+  kagome::primitives::BlockHash parent_hash = "parent"_hash256;
+  kagome::primitives::BlockHash child_hash = "child"_hash256;
+  // non-genesis blocks are executed without the last digest (seal)
+  kagome::primitives::Digest digest{kagome::primitives::Seal{}};
+  kagome::primitives::BlockHeader grandparent{
+      40, "genesis"_hash256, {}, {}, digest, grandparent_hash};
+  kagome::primitives::BlockHeader parent{
+      41, grandparent_hash, {}, {}, digest, parent_hash};
+  kagome::primitives::BlockHeader child{
+      42, parent_hash, {}, {}, digest, child_hash};
+
+  ON_CALL(*production_consensus_, getSlot(_)).WillByDefault(Return(0));
+  EXPECT_CALL(*block_tree_, has(grandparent_hash)).WillRepeatedly(Return(true));
+  EXPECT_CALL(*block_tree_, has(parent_hash)).WillRepeatedly(Return(true));
+  EXPECT_CALL(*block_tree_, getBlockBody(_))
+      .WillRepeatedly(Return(BlockTreeError::BODY_NOT_FOUND));
+  EXPECT_CALL(*block_tree_, getBlockHeader(grandparent_hash))
+      .WillRepeatedly(Return(grandparent));
+  EXPECT_CALL(*block_tree_, getBlockHeader(parent_hash))
+      .WillRepeatedly(Return(parent));
+  EXPECT_CALL(*block_tree_, bestBlock())
+      .WillRepeatedly(Return(BlockInfo{40, grandparent_hash}));
+  EXPECT_CALL(*production_consensus_, validateHeader(_))
+      .Times(2)
+      .WillRepeatedly(Return(outcome::success()));
+  EXPECT_CALL(*production_consensus_, prevalidateHeader(child, grandparent))
+      .Times(1);
+  EXPECT_CALL(*block_tree_, addBlock(_))
+      .Times(2)
+      .WillRepeatedly(Return(outcome::success()));
+
+  std::latch child_submitted(1);
+  std::vector<BlockNumber> executed;
+  EXPECT_CALL(*core_, execute_block_ref(_, _))
+      .Times(2)
+      .WillRepeatedly([&](const kagome::primitives::BlockReflection &block,
+                          auto &&) -> outcome::result<void> {
+        if (block.header.number == parent.number) {
+          child_submitted.wait();
+        }
+        executed.emplace_back(block.header.number);
+        return outcome::success();
+      });
+
+  std::latch applied(2);
+  auto callback = [&](outcome::result<void> &&result) {
+    EXPECT_TRUE(result.has_value());
+    applied.count_down();
+  };
+  block_executor_->applyBlock(Block{parent, {}}, std::nullopt, callback);
+  block_executor_->applyBlock(Block{child, {}}, std::nullopt, callback);
+  child_submitted.count_down();
+  applied.wait();
+
+  EXPECT_EQ(executed, (std::vector<BlockNumber>{41, 42}));
+}
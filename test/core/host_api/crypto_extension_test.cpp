@@ -11,6 +11,7 @@
 #include <gtest/gtest.h>
 #include <span>
 
+#include "common/worker_thread_pool.hpp"
 #include "crypto/ecdsa/ecdsa_provider_impl.hpp"
 #include "crypto/ed25519/ed25519_provider_impl.hpp"
 #include "crypto/hasher/hasher_impl.hpp"
@@ -28,9 +29,11 @@
 #include "testutil/runtime/memory.hpp"
 
 using namespace kagome::host_api;
+using kagome::Watchdog;
 using kagome::common::Blob;
 using kagome::common::Buffer;
 using kagome::common::BufferView;
+using kagome::common::WorkerThreadPool;
 using kagome::crypto::BoostRandomGenerator;
 using kagome::crypto::CSPRNG;
 using kagome::crypto::EcdsaKeypair;
@@ -87,6 +90,12 @@ class CryptoExtensionTest : public ::testing::Test {
   using RecoverCompressedPublicKeyReturnValue =
       boost::variant<secp256k1::CompressedPublicKey, Secp256k1VerifyError>;
 
+  void TearDown() override {
+    crypto_ext_.reset();
+    watchdog_->stop();
+    pool_.reset();
+  }
+
   void SetUp() override {
     memory_provider_ = std::make_shared<MemoryProviderMock>();
     EXPECT_CALL(*memory_provider_, getCurrentMemory())
@@ -106,7 +115,8 @@ class CryptoExtensionTest : public ::testing::Test {
                                                     ed25519_provider_,
                                                     secp256k1_provider_,
                                                     hasher_,
-                                                    key_store_);
+                                                    key_store_,
+                                                    pool_);
 
     EXPECT_OUTCOME_TRUE(seed_tmp,
                         kagome::common::Blob<32>::fromHexWithPrefix(seed_hex));
@@ -204,6 +214,10 @@ class CryptoExtensionTest : public ::testing::Test {
   std::shared_ptr<Secp256k1Provider> secp256k1_provider_;
   std::shared_ptr<Hasher> hasher_;
   std::shared_ptr<KeyStoreMock> key_store_;
+  std::shared_ptr<Watchdog> watchdog_ =
+      std::make_shared<Watchdog>(std::chrono::milliseconds(1));
+  std::shared_ptr<WorkerThreadPool> pool_ =
+      std::make_shared<WorkerThreadPool>(watchdog_, 2);
   std::shared_ptr<CryptoExtension> crypto_ext_;
 
   KeyType key_type = KeyTypes::BABE;
@@ -385,6 +399,46 @@ TEST_F(CryptoExtensionTest, Sr25519VerifyFailure) {
             CryptoExtension::kVerifyFail);
 }
 
+/**
+ * @given started batch with more signatures than tasks running at once
+ * @when one of signatures is invalid
+ * @then batch calls succeed and only finish of batch reports failure
+ */
+TEST_F(CryptoExtensionTest, BatchVerifyDeferred) {
+  auto valid = [&] {
+    return crypto_ext_->ext_crypto_ed25519_batch_verify_version_1(
+        memory_[ed25519_signature],
+        memory_[input],
+        memory_[ed25519_keypair.public_key]);
+  };
+  auto count =
+      CryptoExtension::kBatchTaskSize * (CryptoExtension::kMaxBatchTasks + 1)
+      + 1;
+
+  crypto_ext_->ext_crypto_start_batch_verify_version_1();
+  for (size_t i = 0; i < count; ++i) {
+    ASSERT_EQ(valid(), CryptoExtension::kVerifySuccess);
+  }
+  ASSERT_EQ(crypto_ext_->ext_crypto_finish_batch_verify_version_1(),
+            CryptoExtension::kVerifySuccess);
+
+  auto invalid_signature = ed25519_signature;
+  ++invalid_signature[0];
+  crypto_ext_->ext_crypto_start_batch_verify_version_1();
+  for (size_t i = 0; i < count; ++i) {
+    ASSERT_EQ(valid(), CryptoExtension::kVerifySuccess);
+    if (i == 1) {
+      ASSERT_EQ(crypto_ext_->ext_crypto_ed25519_batch_verify_version_1(
+                    memory_[invalid_signature],
+                    memory_[input],
+                    memory_[ed25519_keypair.public_key]),
+                CryptoExtension::kVerifySuccess);
+    }
+  }
+  ASSERT_EQ(crypto_ext_->ext_crypto_finish_batch_verify_version_1(),
+            CryptoExtension::kVerifyFail);
+}
+
 /**
  * @given initialized crypto extensions @and secp256k1 signature and message
  * @when call recovery public secp256k1 uncompressed key
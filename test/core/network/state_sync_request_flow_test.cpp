@@ -0,0 +1,230 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/state_sync_request_flow.hpp"
+
+#include <gtest/gtest.h>
+
+#include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/storage/write_batch_mock.hpp"
+#include "mock/core/storage/trie_pruner/trie_pruner_mock.hpp"
+#include "network/impl/state_protocol_observer_impl.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/impl/trie_storage_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using namespace kagome;
+using namespace storage::trie;
+
+using blockchain::BlockHeaderRepositoryMock;
+using common::Buffer;
+using network::StateProtocolObserverImpl;
+using network::StateSyncRequestFlow;
+using storage::BufferBatch;
+using storage::face::WriteBatchMock;
+using storage::trie_pruner::TriePrunerMock;
+using testing::_;
+using testing::Return;
+
+std::shared_ptr<TrieStorage> makeTrie(
+    std::shared_ptr<TrieStorageBackend> node_backend) {
+  auto trie_factory = std::make_shared<PolkadotTrieFactoryImpl>();
+  auto codec = std::make_shared<PolkadotCodec>();
+  auto serializer =
+      std::make_shared<TrieSerializerImpl>(trie_factory, codec, node_backend);
+  auto state_pruner = std::make_shared<TriePrunerMock>();
+  ON_CALL(*state_pruner, addNewState(testing::A<const PolkadotTrie &>(), _))
+      .WillByDefault(Return(outcome::success()));
+  return TrieStorageImpl::createEmpty(
+             trie_factory, codec, serializer, state_pruner)
+      .value();
+}
+
+std::shared_ptr<TrieStorageBackend> makeBackend() {
+  return std::make_shared<TrieStorageBackendImpl>(
+      std::make_shared<storage::InMemorySpacedStorage>());
+}
+
+/// Node storage failing to commit batches while `fail` is set
+struct FailingBackend : TrieStorageBackendImpl {
+  using TrieStorageBackendImpl::TrieStorageBackendImpl;
+
+  std::unique_ptr<BufferBatch> batch() override {
+    if (not fail) {
+      return TrieStorageBackendImpl::batch();
+    }
+    auto batch = std::make_unique<WriteBatchMock<Buffer, Buffer>>();
+    EXPECT_CALL(*batch, put(_, _))
+        .WillRepeatedly(Return(outcome::success()));
+    EXPECT_CALL(*batch, commit()).WillOnce(Return(std::errc::io_error));
+    return batch;
+  }
+
+  bool fail = false;
+};
+
+class StateSyncRequestFlowTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  /// keys under each child of root, values exceeding response size limit
+  void SetUp() override {
+    auto batch =
+        server_trie_->getPersistentBatchAt(kEmptyRootHash, std::nullopt)
+            .value();
+    for (uint8_t i = 0; i < 16; ++i) {
+      for (uint8_t j = 0; j < 20; ++j) {
+        Buffer key{uint8_t(i << 4), j};
+        Buffer value(20000, uint8_t(i ^ j));
+        EXPECT_OUTCOME_TRUE_1(batch->put(key, value));
+        entries_.emplace_back(std::move(key), std::move(value));
+      }
+    }
+    header_.number = 1;
+    header_.state_root = batch->commit(StateVersion::V0).value();
+    block_ = {1, "1"_hash256};
+    EXPECT_CALL(*headers_, getBlockHeader(block_.hash))
+        .WillRepeatedly(Return(header_));
+  }
+
+  outcome::result<void> respond(StateSyncRequestFlow &flow,
+                                StateSyncRequestFlow::RangeId range) {
+    OUTCOME_TRY(res, observer_.onStateRequest(flow.nextRequest(range)));
+    return flow.onResponse(range, res);
+  }
+
+  std::shared_ptr<BlockHeaderRepositoryMock> headers_ =
+      std::make_shared<BlockHeaderRepositoryMock>();
+  std::shared_ptr<TrieStorage> server_trie_ = makeTrie(makeBackend());
+  StateProtocolObserverImpl observer_{headers_, server_trie_};
+  std::vector<std::pair<Buffer, Buffer>> entries_;
+  primitives::BlockHeader header_;
+  primitives::BlockInfo block_;
+};
+
+/**
+ * @given state larger than single response
+ * @when root node is received
+ * @then rest of state is fetched by concurrent ranges in any order
+ */
+TEST_F(StateSyncRequestFlowTest, ConcurrentRanges) {
+  auto node_db = makeBackend();
+  StateSyncRequestFlow flow{node_db, block_, header_};
+  ASSERT_FALSE(flow.complete());
+
+  auto root_range = flow.takeRange();
+  ASSERT_TRUE(root_range);
+  EXPECT_FALSE(flow.takeRange());
+  EXPECT_OUTCOME_TRUE_1(respond(flow, *root_range));
+  ASSERT_FALSE(flow.complete());
+
+  std::vector<StateSyncRequestFlow::RangeId> ranges;
+  while (auto range = flow.takeRange()) {
+    ranges.emplace_back(*range);
+  }
+  EXPECT_GT(ranges.size(), 1);
+  EXPECT_EQ(flow.fetching(), ranges.size());
+  // root is written when all ranges are complete
+  EXPECT_FALSE(node_db->contains(header_.state_root).value());
+
+  for (size_t i = 0; i < 100 and not flow.complete(); ++i) {
+    std::ranges::reverse(ranges);
+    for (auto range : ranges) {
+      EXPECT_OUTCOME_TRUE_1(respond(flow, range));
+      if (flow.complete()) {
+        break;
+      }
+    }
+    ranges.clear();
+    while (auto range = flow.takeRange()) {
+      ranges.emplace_back(*range);
+    }
+  }
+  ASSERT_TRUE(flow.complete());
+
+  auto trie = makeTrie(node_db);
+  auto batch = trie->getEphemeralBatchAt(header_.state_root).value();
+  for (auto &[key, value] : entries_) {
+    EXPECT_EQ(batch->get(key).value(), value);
+  }
+}
+
+/**
+ * @given state partially fetched before restart
+ * @when new flow is started with same node storage
+ * @then fetched ranges are skipped
+ */
+TEST_F(StateSyncRequestFlowTest, Resume) {
+  auto node_db = makeBackend();
+  size_t ranges_before = 0;
+  {
+    StateSyncRequestFlow flow{node_db, block_, header_};
+    EXPECT_OUTCOME_TRUE_1(respond(flow, *flow.takeRange()));
+    std::vector<StateSyncRequestFlow::RangeId> ranges;
+    while (auto range = flow.takeRange()) {
+      ranges.emplace_back(*range);
+    }
+    ranges_before = ranges.size();
+    ASSERT_GT(ranges_before, 1);
+    // subtree of range fits into response
+    EXPECT_OUTCOME_TRUE_1(respond(flow, ranges.front()));
+  }
+
+  StateSyncRequestFlow flow{node_db, block_, header_};
+  EXPECT_OUTCOME_TRUE_1(respond(flow, *flow.takeRange()));
+  size_t ranges_after = 0;
+  while (flow.takeRange()) {
+    ++ranges_after;
+  }
+  EXPECT_EQ(ranges_after, ranges_before - 1);
+}
+
+/**
+ * @given flow with ranges split from root
+ * @when nodes of response fail to be written
+ * @then flow doesn't advance, and range is fetched completely on retry
+ */
+TEST_F(StateSyncRequestFlowTest, FailedCommit) {
+  auto node_db = std::make_shared<FailingBackend>(
+      std::make_shared<storage::InMemorySpacedStorage>());
+  StateSyncRequestFlow flow{node_db, block_, header_};
+  node_db->fail = true;
+  auto root_range = *flow.takeRange();
+  EXPECT_FALSE(respond(flow, root_range));
+  flow.releaseRange(root_range);
+  EXPECT_EQ(flow.takeRange(), root_range);
+  EXPECT_FALSE(flow.takeRange());
+
+  node_db->fail = false;
+  EXPECT_OUTCOME_TRUE_1(respond(flow, root_range));
+  auto range = flow.takeRange();
+  ASSERT_TRUE(range);
+  node_db->fail = true;
+  EXPECT_FALSE(respond(flow, *range));
+  flow.releaseRange(*range);
+
+  node_db->fail = false;
+  for (size_t i = 0; i < 100 and not flow.complete(); ++i) {
+    while (auto range = flow.takeRange()) {
+      EXPECT_OUTCOME_TRUE_1(respond(flow, *range));
+    }
+  }
+  ASSERT_TRUE(flow.complete());
+
+  auto trie = makeTrie(node_db);
+  auto batch = trie->getEphemeralBatchAt(header_.state_root).value();
+  for (auto &[key, value] : entries_) {
+    EXPECT_EQ(batch->get(key).value(), value);
+  }
+}
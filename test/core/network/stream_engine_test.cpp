@@ -0,0 +1,256 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/stream_engine.hpp"
+
+#include <gtest/gtest.h>
+#include <libp2p/multi/uvarint.hpp>
+
+#include "mock/core/network/protocol_base_mock.hpp"
+#include "mock/core/network/reputation_repository_mock.hpp"
+#include "mock/libp2p/connection/stream_mock.hpp"
+#include "network/types/block_announce.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::network::BlockAnnounce;
+using kagome::network::OutboundPriority;
+using kagome::network::ProtocolBaseMock;
+using kagome::network::ReputationRepositoryMock;
+using kagome::network::ScaleMessageReadWriter;
+using kagome::network::StreamEngine;
+using libp2p::connection::Stream;
+using libp2p::connection::StreamMock;
+using libp2p::peer::PeerId;
+using testing::_;
+using testing::Return;
+using testing::ReturnRef;
+
+/// protocol of the given outbound priority
+struct PriorityProtocolMock : ProtocolBaseMock {
+  explicit PriorityProtocolMock(OutboundPriority priority)
+      : priority{priority} {}
+
+  OutboundPriority outboundPriority() const override {
+    return priority;
+  }
+
+  OutboundPriority priority;
+};
+
+using Message = std::vector<uint8_t>;
+
+class StreamEngineTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    EXPECT_CALL(*protocol_, protocolName())
+        .WillRepeatedly(ReturnRef(protocol_name_));
+    msg_->header.number = 1;
+    auto payload = scale::encode(*msg_).value();
+    libp2p::multi::UVarint length{payload.size()};
+    expected_ = length.toVector();
+    expected_.insert(expected_.end(), payload.begin(), payload.end());
+  }
+
+  std::shared_ptr<PriorityProtocolMock> protocol(OutboundPriority priority) {
+    auto protocol = std::make_shared<PriorityProtocolMock>(priority);
+    EXPECT_CALL(*protocol, protocolName())
+        .WillRepeatedly(ReturnRef(protocol_name_));
+    return protocol;
+  }
+
+  static std::shared_ptr<Message> message(size_t size, uint8_t value) {
+    return std::make_shared<Message>(size, value);
+  }
+
+  static Message encoded(const std::shared_ptr<Message> &msg) {
+    return *ScaleMessageReadWriter::encode(*msg).value();
+  }
+
+  /// completes deferred writes one by one, as they may start next writes
+  void completeWrites() {
+    while (not pending_.empty()) {
+      auto complete = std::move(pending_.front());
+      pending_.erase(pending_.begin());
+      complete();
+    }
+  }
+
+  /// stream to the peer, which records the buffers written to it
+  std::shared_ptr<StreamMock> stream(const PeerId &peer_id) {
+    auto stream = std::make_shared<StreamMock>();
+    EXPECT_CALL(*stream, remotePeerId()).WillRepeatedly(Return(peer_id));
+    EXPECT_CALL(*stream, isClosed()).WillRepeatedly(Return(false));
+    EXPECT_CALL(*stream, writeSome(_, _, _))
+        .WillRepeatedly([this](libp2p::BytesIn in,
+                               size_t bytes,
+                               libp2p::basic::Writer::WriteCallbackFunc cb) {
+          buffers_.emplace_back(in.data());
+          written_.emplace_back(in.begin(), in.begin() + bytes);
+          if (complete_writes_) {
+            cb(bytes);
+          } else {
+            pending_.emplace_back([cb, bytes] { cb(bytes); });
+          }
+        });
+    return stream;
+  }
+
+  std::string protocol_name_ = "/test/1";
+  std::shared_ptr<ProtocolBaseMock> protocol_ =
+      std::make_shared<ProtocolBaseMock>();
+  std::shared_ptr<StreamEngine> engine_ = std::make_shared<StreamEngine>(
+      std::make_shared<ReputationRepositoryMock>());
+  std::shared_ptr<BlockAnnounce> msg_ = std::make_shared<BlockAnnounce>();
+  std::vector<uint8_t> expected_;
+  std::vector<const uint8_t *> buffers_;
+  std::vector<std::vector<uint8_t>> written_;
+  /// writes complete immediately or wait for `completeWrites`
+  bool complete_writes_ = true;
+  std::vector<std::function<void()>> pending_;
+};
+
+/**
+ * @given streams to three peers
+ * @when a message is broadcast
+ * @then each stream is written the same length-prefixed buffer
+ */
+TEST_F(StreamEngineTest, BroadcastSharesEncodedMessage) {
+  for (auto peer_id : {"peer_a"_peerid, "peer_b"_peerid, "peer_c"_peerid}) {
+    engine_->addOutgoing(stream(peer_id), protocol_);
+  }
+
+  engine_->broadcast(protocol_, msg_);
+
+  ASSERT_EQ(written_.size(), 3);
+  for (size_t i = 0; i < written_.size(); ++i) {
+    EXPECT_EQ(buffers_[i], buffers_[0]);
+    EXPECT_EQ(written_[i], expected_);
+  }
+}
+
+/**
+ * @given a peer without an outgoing stream
+ * @when a message is sent @and the stream is opened
+ * @then the deferred message is written to the new stream
+ */
+TEST_F(StreamEngineTest, SendDeferredMessage) {
+  auto peer_id = "peer_a"_peerid;
+  engine_->reserveStreams(peer_id, protocol_);
+  std::function<void(outcome::result<std::shared_ptr<Stream>>)> open;
+  EXPECT_CALL(*protocol_, newOutgoingStream(peer_id, _))
+      .WillOnce([&](const PeerId &, const auto &cb) { open = cb; });
+
+  engine_->send(peer_id, protocol_, msg_);
+  ASSERT_TRUE(open);
+  EXPECT_TRUE(written_.empty());
+
+  open(stream(peer_id));
+  ASSERT_EQ(written_.size(), 1);
+  EXPECT_EQ(written_[0], expected_);
+}
+
+/**
+ * @given a peer with streams of consensus and transactions protocols, which
+ * complete writes later
+ * @when messages of both protocols are sent while a vote is being written
+ * @then transactions wait until queued votes are written
+ */
+TEST_F(StreamEngineTest, ConsensusBeforeTransactions) {
+  auto peer_id = "peer_a"_peerid;
+  auto consensus = protocol(OutboundPriority::Consensus);
+  auto transactions = protocol(OutboundPriority::Transactions);
+  engine_->addOutgoing(stream(peer_id), consensus);
+  engine_->addOutgoing(stream(peer_id), transactions);
+  complete_writes_ = false;
+
+  auto tx_1 = message(10, 1), vote_1 = message(10, 2);
+  auto vote_2 = message(10, 3), tx_2 = message(10, 4);
+  engine_->send(peer_id, transactions, tx_1);
+  engine_->send(peer_id, consensus, vote_1);
+  engine_->send(peer_id, consensus, vote_2);
+  engine_->send(peer_id, transactions, tx_2);
+  ASSERT_EQ(written_.size(), 2);
+
+  completeWrites();
+  EXPECT_EQ(written_,
+            (std::vector<Message>{encoded(tx_1),
+                                  encoded(vote_1),
+                                  encoded(vote_2),
+                                  encoded(tx_2)}));
+}
+
+/**
+ * @given a stream writing a message
+ * @when a message equal to a waiting one is sent
+ * @then it is skipped, the one being written is not compared
+ */
+TEST_F(StreamEngineTest, CoalesceWaitingMessages) {
+  auto peer_id = "peer_a"_peerid;
+  engine_->addOutgoing(stream(peer_id), protocol_);
+  complete_writes_ = false;
+
+  auto msg_1 = message(10, 1), msg_2 = message(10, 2);
+  engine_->send(peer_id, protocol_, msg_1);
+  engine_->send(peer_id, protocol_, msg_2);
+  engine_->send(peer_id, protocol_, message(10, 2));
+  engine_->send(peer_id, protocol_, msg_1);
+
+  completeWrites();
+  EXPECT_EQ(written_,
+            (std::vector<Message>{
+                encoded(msg_1), encoded(msg_2), encoded(msg_1)}));
+}
+
+/**
+ * @given a slow stream of a sync protocol
+ * @when queued messages exceed the limit
+ * @then the oldest waiting messages are dropped
+ */
+TEST_F(StreamEngineTest, DropStaleMessages) {
+  auto peer_id = "peer_a"_peerid;
+  engine_->addOutgoing(stream(peer_id), protocol_);
+  complete_writes_ = false;
+
+  auto size = StreamEngine::outboundQueueLimit(OutboundPriority::Sync) * 3 / 8;
+  std::vector<std::shared_ptr<Message>> msgs;
+  for (uint8_t i = 0; i < 4; ++i) {
+    msgs.emplace_back(message(size, i));
+    engine_->send(peer_id, protocol_, msgs.back());
+  }
+
+  completeWrites();
+  EXPECT_EQ(written_,
+            (std::vector<Message>{encoded(msgs[0]), encoded(msgs[3])}));
+}
+
+/**
+ * @given a slow stream of the transactions protocol
+ * @when queued messages exceed the limit
+ * @then new messages are dropped
+ */
+TEST_F(StreamEngineTest, DropNewTransactions) {
+  auto peer_id = "peer_a"_peerid;
+  auto transactions = protocol(OutboundPriority::Transactions);
+  engine_->addOutgoing(stream(peer_id), transactions);
+  complete_writes_ = false;
+
+  auto size =
+      StreamEngine::outboundQueueLimit(OutboundPriority::Transactions) * 3 / 5;
+  auto tx_1 = message(size, 1), tx_2 = message(size, 2);
+  engine_->send(peer_id, transactions, tx_1);
+  engine_->send(peer_id, transactions, tx_2);
+  completeWrites();
+  EXPECT_EQ(written_, (std::vector<Message>{encoded(tx_1)}));
+
+  engine_->send(peer_id, transactions, tx_2);
+  completeWrites();
+  EXPECT_EQ(written_, (std::vector<Message>{encoded(tx_1), encoded(tx_2)}));
+}
@@ -84,6 +84,7 @@ class SynchronizerTest
 
     EXPECT_CALL(app_config, syncMethod())
         .WillOnce(Return(application::SyncMethod::Full));
+    EXPECT_CALL(app_config, importPipelineDepth()).WillOnce(Return(1));
 
     auto state_pruner =
         std::make_shared<kagome::storage::trie_pruner::TriePrunerMock>();
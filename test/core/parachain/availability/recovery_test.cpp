@@ -8,6 +8,7 @@
 
 #include <gtest/gtest.h>
 
+#include "common/worker_thread_pool.hpp"
 #include "crypto/random_generator/boost_generator.hpp"
 #include "mock/core/application/chain_spec_mock.hpp"
 #include "mock/core/authority_discovery/query_mock.hpp"
@@ -24,10 +25,12 @@
 #include "testutil/prepare_loggers.hpp"
 
 using kagome::Buffer;
+using kagome::TestThreadPool;
 using kagome::application::ChainSpecMock;
 using kagome::authority_discovery::QueryMock;
 using kagome::blockchain::BlockTreeMock;
 using kagome::common::Buffer;
+using kagome::common::WorkerThreadPool;
 using kagome::crypto::BoostRandomGenerator;
 using kagome::crypto::HasherMock;
 using kagome::network::CandidateHash;
@@ -76,7 +79,8 @@ class RecoveryTest : public testing::Test {
     random_generator.fillRandomly(original_data);
 
     original_chunks = toChunks(n_validators, original_available_data).value();
-    receipt.descriptor.erasure_encoding_root = makeTrieProof(original_chunks);
+    receipt.descriptor.erasure_encoding_root =
+        makeTrieProof(original_chunks, *worker_thread_pool);
 
     session = SessionInfo{};
 
@@ -136,7 +140,8 @@ class RecoveryTest : public testing::Test {
                                               av_store,
                                               query_audi,
                                               router,
-                                              peer_manager);
+                                              peer_manager,
+                                              worker_thread_pool);
 
     auto &val_group_0 = session.validator_groups.emplace_back();
     for (size_t i = 0; i < n_validators; ++i) {
@@ -209,6 +214,9 @@ class RecoveryTest : public testing::Test {
   std::shared_ptr<QueryMock> query_audi;
   std::shared_ptr<RouterMock> router;
   std::shared_ptr<PeerManagerMock> peer_manager;
+  // doesn't run tasks, chunks are hashed by the test thread
+  std::shared_ptr<WorkerThreadPool> worker_thread_pool =
+      std::make_shared<WorkerThreadPool>(TestThreadPool{});
 
   std::shared_ptr<testing::MockFunction<void(
       std::optional<outcome::result<AvailableData>>)>>
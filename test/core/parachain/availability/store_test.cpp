@@ -0,0 +1,95 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/availability/store/store_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include "mock/core/clock/clock_mock.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::clock::SystemClockMock;
+using kagome::common::Buffer;
+using kagome::network::ErasureChunk;
+using kagome::parachain::AvailabilityStoreImpl;
+using kagome::storage::InMemorySpacedStorage;
+using testing::Return;
+
+class AvailabilityStoreTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    ON_CALL(*clock, nowUint64()).WillByDefault(Return(1000));
+  }
+
+  std::unique_ptr<AvailabilityStoreImpl> makeStore() {
+    return std::make_unique<AvailabilityStoreImpl>(db, clock);
+  }
+
+  static ErasureChunk chunk(uint32_t index) {
+    return {Buffer(10, uint8_t(index)), index, {}};
+  }
+
+  std::shared_ptr<InMemorySpacedStorage> db =
+      std::make_shared<InMemorySpacedStorage>();
+  std::shared_ptr<SystemClockMock> clock =
+      std::make_shared<SystemClockMock>();
+  kagome::parachain::RelayHash relay1 = "relay1"_hash256;
+  kagome::parachain::RelayHash relay2 = "relay2"_hash256;
+  kagome::parachain::CandidateHash candidate1 = "candidate1"_hash256;
+  kagome::parachain::CandidateHash candidate2 = "candidate2"_hash256;
+};
+
+/**
+ * @given chunks and PoV stored by one store instance
+ * @when store is recreated over the same database
+ * @then data is available, and removed with its relay parent
+ */
+TEST_F(AvailabilityStoreTest, Persistent) {
+  {
+    auto store = makeStore();
+    store->storeData(relay1, candidate1, {chunk(0), chunk(1)}, {}, {});
+    store->putChunk(relay1, candidate2, chunk(2));
+  }
+
+  auto store = makeStore();
+  EXPECT_TRUE(store->hasChunk(candidate1, 1));
+  EXPECT_FALSE(store->hasChunk(candidate1, 2));
+  EXPECT_TRUE(store->hasPov(candidate1));
+  EXPECT_TRUE(store->getPovAndData(candidate1));
+  EXPECT_FALSE(store->hasPov(candidate2));
+  EXPECT_EQ(store->getChunk(candidate2, 2)->chunk, chunk(2).chunk);
+  EXPECT_EQ(store->getChunks(candidate1).size(), 2);
+
+  store->remove(relay1);
+  EXPECT_FALSE(store->hasChunk(candidate1, 1));
+  EXPECT_FALSE(store->hasPov(candidate1));
+  EXPECT_FALSE(store->getChunk(candidate2, 2));
+  EXPECT_TRUE(store->getChunks(candidate1).empty());
+}
+
+/**
+ * @given relay parents stored at different time and not removed
+ * @when other relay parent is removed after prune age
+ * @then only expired relay parents are pruned
+ */
+TEST_F(AvailabilityStoreTest, Prune) {
+  auto store = makeStore();
+  store->putChunk(relay1, candidate1, chunk(0));
+  auto age = AvailabilityStoreImpl::kPruneAge.count();
+  EXPECT_CALL(*clock, nowUint64()).WillRepeatedly(Return(1000 + age / 2));
+  store->putChunk(relay2, candidate2, chunk(0));
+
+  EXPECT_CALL(*clock, nowUint64()).WillRepeatedly(Return(1000 + age));
+  store->remove("other"_hash256);
+  EXPECT_FALSE(store->hasChunk(candidate1, 0));
+  EXPECT_TRUE(store->hasChunk(candidate2, 0));
+}
@@ -0,0 +1,52 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/pvf/pvf_shared_memory.hpp"
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "common/buffer.hpp"
+#include "testutil/outcome.hpp"
+
+using kagome::common::Buffer;
+using kagome::parachain::PvfSharedMemory;
+
+/**
+ * @given shared memory of node and worker opened by inherited descriptor
+ * @when one side writes data larger than mapped before
+ * @then other side reads it after remapping
+ */
+TEST(PvfSharedMemoryTest, WriteRead) {
+  EXPECT_OUTCOME_TRUE(node, PvfSharedMemory::create());
+  auto worker = PvfSharedMemory::open(::dup(node->fd()));
+
+  Buffer args(100, 1);
+  EXPECT_OUTCOME_TRUE_1(node->write(args));
+  EXPECT_OUTCOME_TRUE(read_args, worker->read(args.size()));
+  EXPECT_EQ(read_args, args);
+
+  Buffer result(3 << 20, 2);
+  EXPECT_OUTCOME_TRUE_1(worker->write(result));
+  EXPECT_OUTCOME_TRUE(read_result, node->read(result.size()));
+  EXPECT_EQ(read_result, result);
+
+  EXPECT_EC(node->read(10 << 20), std::errc::invalid_argument);
+}
+
+/**
+ * @given shared memory created by node
+ * @when worker tries to truncate memfd
+ * @then memfd is not shrunk, and it is not inherited by exec
+ */
+TEST(PvfSharedMemoryTest, SealedAndCloseOnExec) {
+  EXPECT_OUTCOME_TRUE(node, PvfSharedMemory::create());
+  EXPECT_OUTCOME_TRUE_1(node->write(Buffer(100, 1)));
+  EXPECT_EQ(::ftruncate(node->fd(), 0), -1);
+  EXPECT_OUTCOME_TRUE_1(node->read(100));
+  EXPECT_EQ(::fcntl(node->fd(), F_GETFD) & FD_CLOEXEC, FD_CLOEXEC);
+}
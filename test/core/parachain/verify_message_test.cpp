@@ -0,0 +1,126 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/approval/verify_message.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "crypto/sr25519/sr25519_provider_impl.hpp"
+#include "testutil/literals.hpp"
+
+using kagome::crypto::SecureCleanGuard;
+using kagome::crypto::Sr25519Keypair;
+using kagome::crypto::Sr25519ProviderImpl;
+using kagome::crypto::Sr25519Seed;
+using kagome::crypto::VRFOutput;
+using kagome::parachain::CandidateHash;
+using kagome::parachain::approval::approvalSigningPayload;
+using kagome::parachain::approval::DelayAssignmentCheck;
+using kagome::parachain::approval::verifyApprovalSignature;
+using kagome::parachain::approval::verifyDelayAssignment;
+namespace sr25519_constants = kagome::crypto::constants::sr25519;
+
+class VerifyMessageTest : public testing::Test {
+ public:
+  void SetUp() override {
+    keypair = sr25519
+                  .generateKeypair(
+                      Sr25519Seed::fromHex(
+                          SecureCleanGuard{std::string(
+                              "31102468cbd502d177793fa523685b248f6bd083d67f7667"
+                              "1e0b86d7fa20c030")})
+                          .value(),
+                      {})
+                  .value();
+    std::memset(story.data, 42, sizeof(story.data));
+  }
+
+  /// Delay assignment cert of `keypair` for core
+  std::pair<VRFOutput, uint32_t> delayCert(uint32_t core) {
+    kagome::common::Blob<sr25519_constants::KEYPAIR_SIZE> keypair_buf;
+    std::ranges::copy(keypair.secret_key.unsafeBytes(), keypair_buf.begin());
+    std::ranges::copy(
+        keypair.public_key,
+        keypair_buf.begin() + kagome::crypto::Sr25519SecretKey::size());
+    VRFCOutput output;
+    VRFCProof proof;
+    uint32_t tranche{};
+    sr25519_relay_vrf_delay_assignments_cert(keypair_buf.data(),
+                                             kDelayTranches,
+                                             kZerothTrancheWidth,
+                                             &story,
+                                             core,
+                                             &output,
+                                             &proof,
+                                             &tranche);
+    VRFOutput vrf;
+    std::copy_n(output.data, sr25519_constants::vrf::OUTPUT_SIZE,
+                vrf.output.begin());
+    std::copy_n(
+        proof.data, sr25519_constants::vrf::PROOF_SIZE, vrf.proof.begin());
+    return {vrf, tranche};
+  }
+
+  static constexpr uint32_t kDelayTranches = 40;
+  static constexpr uint32_t kZerothTrancheWidth = 10;
+
+  Sr25519ProviderImpl sr25519;
+  Sr25519Keypair keypair;
+  ::RelayVRFStory story;
+  CandidateHash candidate1 = "candidate1"_hash256;
+  CandidateHash candidate2 = "candidate2"_hash256;
+};
+
+/**
+ * @given approval of one and of several candidates signed by validator
+ * @when signatures are verified
+ * @then they are valid only for the same candidates and session
+ */
+TEST_F(VerifyMessageTest, ApprovalSignature) {
+  auto sign = [&](const std::vector<CandidateHash> &candidates) {
+    return sr25519.sign(keypair, approvalSigningPayload(candidates, 1))
+        .value();
+  };
+  auto single = sign({candidate1});
+  auto multiple = sign({candidate1, candidate2});
+
+  EXPECT_TRUE(verifyApprovalSignature(
+      sr25519, keypair.public_key, {candidate1}, 1, single));
+  EXPECT_TRUE(verifyApprovalSignature(
+      sr25519, keypair.public_key, {candidate1, candidate2}, 1, multiple));
+  EXPECT_FALSE(verifyApprovalSignature(
+      sr25519, keypair.public_key, {candidate1}, 2, single));
+  EXPECT_FALSE(verifyApprovalSignature(
+      sr25519, keypair.public_key, {candidate2}, 1, single));
+  EXPECT_FALSE(verifyApprovalSignature(
+      sr25519, keypair.public_key, {candidate1}, 1, multiple));
+  EXPECT_FALSE(
+      verifyApprovalSignature(sr25519, keypair.public_key, {}, 1, single));
+}
+
+/**
+ * @given delay assignment cert for a core
+ * @when VRF is verified
+ * @then tranche of cert is returned only for the same core
+ */
+TEST_F(VerifyMessageTest, DelayAssignment) {
+  auto [vrf, tranche] = delayCert(3);
+  DelayAssignmentCheck check{
+      .assignment_key = kagome::runtime::AssignmentId{keypair.public_key},
+      .vrf = vrf,
+      .relay_vrf_story = story,
+      .core_index = 3,
+      .n_delay_tranches = kDelayTranches,
+      .zeroth_delay_tranche_width = kZerothTrancheWidth,
+  };
+  EXPECT_EQ(verifyDelayAssignment(check), tranche);
+
+  check.core_index = 4;
+  EXPECT_EQ(verifyDelayAssignment(check), std::nullopt);
+}
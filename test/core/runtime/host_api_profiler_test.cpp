@@ -0,0 +1,95 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/host_api_profiler.hpp"
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+using kagome::runtime::HostApiProfiler;
+using kagome::runtime::HostMethod;
+using kagome::runtime::profiledHostCall;
+using kagome::runtime::PtrSize;
+
+class HostApiProfilerTest : public testing::Test {
+ public:
+  void TearDown() override {
+    HostApiProfiler::enable(false);
+    HostApiProfiler::reset();
+  }
+
+  /// storage get of 4 bytes key returning 10 bytes value
+  static int64_t storageGet() {
+    return profiledHostCall<HostMethod::ext_storage_get_version_1, int64_t>(
+        [](int64_t key) {
+          EXPECT_EQ(PtrSize{static_cast<uint64_t>(key)}.size, 4);
+          return static_cast<int64_t>(PtrSize{8, 10}.combine());
+        },
+        static_cast<int64_t>(PtrSize{0, 4}.combine()));
+  }
+
+  /// hashing of 32 bytes returning pointer to the hash
+  static int32_t hash() {
+    return profiledHostCall<HostMethod::ext_hashing_blake2_256_version_1,
+                            int32_t>(
+        [](int64_t) { return int32_t{16}; },
+        static_cast<int64_t>(PtrSize{0, 32}.combine()));
+  }
+};
+
+/**
+ * @given disabled profiler
+ * @when host methods are called
+ * @then nothing is recorded
+ */
+TEST_F(HostApiProfilerTest, Disabled) {
+  HostApiProfiler::CallScope scope{"Core_version"};
+  storageGet();
+  EXPECT_TRUE(HostApiProfiler::snapshot().empty());
+}
+
+/**
+ * @given enabled profiler
+ * @when host methods are called within runtime calls
+ * @then calls and bytes are recorded per runtime call and host method
+ */
+TEST_F(HostApiProfilerTest, Enabled) {
+  HostApiProfiler::enable(true);
+  {
+    HostApiProfiler::CallScope scope{"Core_execute_block"};
+    storageGet();
+    storageGet();
+    {
+      HostApiProfiler::CallScope nested{"Core_version"};
+      hash();
+    }
+    // recorded when the runtime call ends
+    EXPECT_EQ(HostApiProfiler::snapshot().size(), 1);
+  }
+  hash();
+
+  auto entries = HostApiProfiler::snapshot();
+  ASSERT_EQ(entries.size(), 3);
+  auto find = [&](std::string_view call, std::string_view method) {
+    auto it = std::ranges::find_if(entries, [&](auto &entry) {
+      return entry.runtime_call == call and entry.method == method;
+    });
+    EXPECT_NE(it, entries.end()) << call << " " << method;
+    return it == entries.end() ? HostApiProfiler::Stats{} : it->stats;
+  };
+  auto get = find("Core_execute_block", "ext_storage_get_version_1");
+  EXPECT_EQ(get.calls, 2);
+  EXPECT_EQ(get.bytes, 2 * (4 + 10));
+  auto nested = find("Core_version", "ext_hashing_blake2_256_version_1");
+  EXPECT_EQ(nested.calls, 1);
+  EXPECT_EQ(nested.bytes, 32);
+  auto unknown = find("unknown", "ext_hashing_blake2_256_version_1");
+  EXPECT_EQ(unknown.calls, 1);
+
+  HostApiProfiler::reset();
+  EXPECT_TRUE(HostApiProfiler::snapshot().empty());
+}
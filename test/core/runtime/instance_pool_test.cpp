@@ -17,12 +17,16 @@
 
 #include "mock/core/application/app_configuration_mock.hpp"
 #include "mock/core/runtime/instrument_wasm.hpp"
+#include "mock/core/runtime/memory_provider_mock.hpp"
 #include "mock/core/runtime/module_factory_mock.hpp"
 #include "mock/core/runtime/module_instance_mock.hpp"
 #include "mock/core/runtime/module_mock.hpp"
+#include "testutil/runtime/memory.hpp"
 
 using kagome::application::AppConfigurationMock;
 using kagome::common::Buffer;
+using kagome::runtime::InstanceEnvironment;
+using kagome::runtime::MemoryProviderMock;
 using kagome::runtime::ModuleFactoryMock;
 using kagome::runtime::ModuleInstanceMock;
 using kagome::runtime::ModuleMock;
@@ -30,6 +34,7 @@ using kagome::runtime::NoopWasmInstrumenter;
 using kagome::runtime::RuntimeContext;
 using kagome::runtime::RuntimeInstancesPool;
 using kagome::runtime::RuntimeInstancesPoolImpl;
+using kagome::runtime::TestMemory;
 using testing::_;
 using testing::Return;
 
@@ -101,3 +106,41 @@ TEST(InstancePoolTest, HeavilyMultithreadedCompilation) {
         {}));
   }
 }
+
+/**
+ * @given an instance with two data segments and a gap between them
+ * @when its memory is reset twice
+ * @then heap base and segments are read only by the first reset, both resets
+ * restore the segments and zero the gap
+ */
+TEST(InstancePoolTest, ResetMemoryFromSnapshot) {
+  testutil::prepareLoggers();
+
+  TestMemory memory;
+  auto memory_provider = std::make_shared<MemoryProviderMock>();
+  EXPECT_CALL(*memory_provider, getCurrentMemory())
+      .WillRepeatedly(Return(std::ref(memory.memory)));
+  EXPECT_CALL(*memory_provider, resetMemory(_))
+      .Times(2)
+      .WillRepeatedly(Return(outcome::success()));
+  InstanceEnvironment env{memory_provider, nullptr, nullptr, nullptr};
+
+  ModuleInstanceMock instance;
+  EXPECT_CALL(instance, getEnvironment())
+      .WillRepeatedly(testing::ReturnRef(env));
+  EXPECT_CALL(instance, getGlobal("__heap_base")).WillOnce(Return(16));
+  static const auto segment1 = "ab"_buf;
+  static const auto segment2 = "cd"_buf;
+  EXPECT_CALL(instance, forDataSegment(_))
+      .Times(2)
+      .WillRepeatedly([](auto &callback) {
+        callback(2, segment1);
+        callback(6, segment2);
+      });
+
+  for (auto i = 0; i < 2; ++i) {
+    memory.m = Buffer{std::vector<uint8_t>(16, 'x')};
+    ASSERT_OUTCOME_SUCCESS_TRY(instance.resetMemory());
+    EXPECT_EQ(memory.m.toString(), std::string("xxab\0\0cdxxxxxxxx", 16));
+  }
+}
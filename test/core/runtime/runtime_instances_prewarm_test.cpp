@@ -0,0 +1,115 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/runtime_instances_prewarm.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common/worker_thread_pool.hpp"
+#include "mock/core/application/app_configuration_mock.hpp"
+#include "mock/core/application/app_state_manager_mock.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/runtime/module_instance_mock.hpp"
+#include "mock/core/runtime/module_repository_mock.hpp"
+#include "mock/core/runtime/runtime_upgrade_tracker_mock.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::TestThreadPool;
+using kagome::application::AppConfigurationMock;
+using kagome::application::StartApp;
+using kagome::blockchain::BlockTreeMock;
+using kagome::common::WorkerThreadPool;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockInfo;
+using kagome::primitives::events::ChainSubscriptionEngine;
+using kagome::runtime::ModuleInstance;
+using kagome::runtime::ModuleInstanceMock;
+using kagome::runtime::ModuleRepositoryMock;
+using kagome::runtime::RuntimeInstancesPrewarm;
+using kagome::runtime::RuntimeUpgradeTrackerMock;
+using testing::_;
+using testing::Return;
+
+class RuntimeInstancesPrewarmTest : public testing::Test {
+ public:
+  static constexpr uint32_t kInstances = 3;
+
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    EXPECT_CALL(app_config_, runtimeInstancesPrewarm())
+        .WillRepeatedly(Return(kInstances));
+    EXPECT_CALL(*block_tree_, bestBlock()).WillRepeatedly(Return(best_));
+    BlockHeader header{best_.number, {}, "state"_hash256, {}, {}};
+    EXPECT_CALL(*block_tree_, getBlockHeader(best_.hash))
+        .WillRepeatedly(Return(header));
+    prewarm_ = std::make_shared<RuntimeInstancesPrewarm>(
+        std::make_shared<StartApp>(),
+        app_config_,
+        worker_thread_pool_,
+        std::make_shared<ChainSubscriptionEngine>(),
+        block_tree_,
+        upgrade_tracker_,
+        module_repo_);
+  }
+
+  /// expects instances to be borrowed together, each one once
+  void expectInstances() {
+    borrowed_.clear();
+    EXPECT_CALL(*module_repo_, getInstanceAt(best_, "state"_hash256))
+        .Times(kInstances)
+        .WillRepeatedly([&](auto &, auto &) {
+          for (auto &weak : borrowed_) {
+            EXPECT_FALSE(weak.expired());
+          }
+          auto instance = std::make_shared<ModuleInstanceMock>();
+          borrowed_.emplace_back(instance);
+          return instance;
+        });
+  }
+
+  BlockInfo best_{10, "best"_hash256};
+  AppConfigurationMock app_config_;
+  WorkerThreadPool worker_thread_pool_{
+      TestThreadPool{std::make_shared<boost::asio::io_context>()}};
+  std::shared_ptr<BlockTreeMock> block_tree_ =
+      std::make_shared<BlockTreeMock>();
+  std::shared_ptr<RuntimeUpgradeTrackerMock> upgrade_tracker_ =
+      std::make_shared<RuntimeUpgradeTrackerMock>();
+  std::shared_ptr<ModuleRepositoryMock> module_repo_ =
+      std::make_shared<ModuleRepositoryMock>();
+  std::vector<std::weak_ptr<ModuleInstance>> borrowed_;
+  std::shared_ptr<RuntimeInstancesPrewarm> prewarm_;
+};
+
+/**
+ * @given best block runtime, pre-warming configured for 3 instances
+ * @when runtime is pre-warmed twice, then after a runtime upgrade
+ * @then 3 instances are borrowed at once and returned to the pool,
+ * repeated pre-warming of the same runtime borrows nothing
+ */
+TEST_F(RuntimeInstancesPrewarmTest, PrewarmsOncePerRuntime) {
+  EXPECT_CALL(*upgrade_tracker_, getLastCodeUpdateState(best_))
+      .WillRepeatedly(Return("code1"_hash256));
+  expectInstances();
+  ASSERT_OUTCOME_SUCCESS_TRY(prewarm_->prewarm());
+  EXPECT_EQ(borrowed_.size(), kInstances);
+  for (auto &weak : borrowed_) {
+    EXPECT_TRUE(weak.expired());
+  }
+  ASSERT_OUTCOME_SUCCESS_TRY(prewarm_->prewarm());
+  testing::Mock::VerifyAndClearExpectations(module_repo_.get());
+
+  EXPECT_CALL(*upgrade_tracker_, getLastCodeUpdateState(best_))
+      .WillRepeatedly(Return("code2"_hash256));
+  expectInstances();
+  ASSERT_OUTCOME_SUCCESS_TRY(prewarm_->prewarm());
+  EXPECT_EQ(borrowed_.size(), kInstances);
+}
@@ -0,0 +1,67 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/runtime_upgrade_precompiler.hpp"
+
+#include <gtest/gtest.h>
+
+#include "mock/core/application/app_state_manager_mock.hpp"
+#include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/runtime/module_repository_mock.hpp"
+#include "runtime/common/precompile_thread_pool.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::TestThreadPool;
+using kagome::application::StartApp;
+using kagome::blockchain::BlockHeaderRepositoryMock;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::events::ChainEventType;
+using kagome::primitives::events::ChainSubscriptionEngine;
+using kagome::runtime::ModuleRepositoryMock;
+using kagome::runtime::PrecompileThreadPool;
+using kagome::runtime::RuntimeUpgradePrecompiler;
+using testing::Return;
+
+/**
+ * @given started precompiler
+ * @when a block setting new runtime code is imported
+ * @then the runtime in the state of the block is precompiled on the
+ * precompile thread
+ */
+TEST(RuntimeUpgradePrecompilerTest, PrecompilesNewRuntime) {
+  testutil::prepareLoggers();
+
+  auto io = std::make_shared<boost::asio::io_context>();
+  PrecompileThreadPool thread_pool{TestThreadPool{io}};
+  auto app_state_manager = std::make_shared<StartApp>();
+  auto chain_sub_engine = std::make_shared<ChainSubscriptionEngine>();
+  auto header_repo = std::make_shared<BlockHeaderRepositoryMock>();
+  auto module_repo = std::make_shared<ModuleRepositoryMock>();
+  auto precompiler =
+      std::make_shared<RuntimeUpgradePrecompiler>(app_state_manager,
+                                                  thread_pool,
+                                                  chain_sub_engine,
+                                                  header_repo,
+                                                  module_repo);
+  app_state_manager->start();
+  io->run();
+
+  auto hash = "upgrade"_hash256;
+  BlockHeader header;
+  header.number = 10;
+  header.state_root = "state"_hash256;
+  header.hash_opt = hash;
+  EXPECT_CALL(*header_repo, getBlockHeader(hash)).WillOnce(Return(header));
+  EXPECT_CALL(*module_repo, precompileAt(header.state_root)).Times(0);
+  chain_sub_engine->notify(ChainEventType::kNewRuntime, hash);
+  testing::Mock::VerifyAndClearExpectations(module_repo.get());
+
+  EXPECT_CALL(*module_repo, precompileAt(header.state_root))
+      .WillOnce(Return(outcome::success()));
+  io->restart();
+  io->run();
+}
@@ -11,6 +11,7 @@
 #include "common/buffer.hpp"
 #include "mock/core/storage/trie_pruner/trie_pruner_mock.hpp"
 #include "runtime/common/runtime_execution_error.hpp"
+#include "scale/scale.hpp"
 #include "storage/in_memory/in_memory_spaced_storage.hpp"
 #include "storage/trie/impl/trie_storage_backend_impl.hpp"
 #include "storage/trie/impl/trie_storage_impl.hpp"
@@ -48,6 +49,11 @@ class TrieStorageProviderTest : public ::testing::Test {
 
     auto state_pruner =
         std::make_shared<kagome::storage::trie_pruner::TriePrunerMock>();
+    ON_CALL(*state_pruner,
+            addNewState(
+                testing::A<const kagome::storage::trie::PolkadotTrie &>(),
+                testing::_))
+        .WillByDefault(testing::Return(outcome::success()));
 
     auto trieDb = kagome::storage::trie::TrieStorageImpl::createEmpty(
                       trie_factory, codec, serializer, state_pruner)
@@ -93,203 +99,187 @@ auto checkBatchValues(const kagome::storage::trie::TrieBatch &batch,
 
 TEST_F(TrieStorageProviderTest, NestedTransactions) {
   /// @given batch with cells A, B, C, D, E with value '-' (means is unchanged)
-  auto batch0 = storage_provider_->getCurrentBatch();
-  ASSERT_OUTCOME_SUCCESS_TRY(batch0->put("A"_buf, "-"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(batch0->put("B"_buf, "-"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(batch0->put("C"_buf, "-"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(batch0->put("D"_buf, "-"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(batch0->put("E"_buf, "-"_buf));
-  checkBatchValues(*batch0, "-----");
+  auto batch = storage_provider_->getCurrentBatch();
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->put("A"_buf, "-"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->put("B"_buf, "-"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->put("C"_buf, "-"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->put("D"_buf, "-"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->put("E"_buf, "-"_buf));
+  checkBatchValues(*batch, "-----");
 
   /// @when 1. start tx 1
   {  // Transaction 1 - will be committed
     ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->startTransaction());
-    auto batch1 = storage_provider_->getCurrentBatch();
 
-    /// @that 1. top level state is not changed, tx1 state like top level state
-    checkBatchValues(*batch0, "-----");
-    checkBatchValues(*batch1, "-----");
+    /// @that 1. state is not changed
+    checkBatchValues(*batch, "-----");
 
     /// @when 2. change one of values
-    ASSERT_OUTCOME_SUCCESS_TRY(batch1->put("A"_buf, "1"_buf));
+    ASSERT_OUTCOME_SUCCESS_TRY(batch->put("A"_buf, "1"_buf));
 
-    /// @that 2. top level state is not changed, tx1 state is changed
-    checkBatchValues(*batch0, "-----");
-    checkBatchValues(*batch1, "1----");
+    /// @that 2. state is changed
+    checkBatchValues(*batch, "1----");
 
     {
       /// @when 3. start tx 2
       ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->startTransaction());
-      auto batch2 = storage_provider_->getCurrentBatch();
 
-      /// @that 3. top level and tx1 state are not changed, tx2 state like tx1
-      /// state
-      checkBatchValues(*batch0, "-----");
-      checkBatchValues(*batch1, "1----");
-      checkBatchValues(*batch2, "1----");
+      /// @that 3. state is not changed
+      checkBatchValues(*batch, "1----");
 
       /// @when 4. change next value
-      ASSERT_OUTCOME_SUCCESS_TRY(batch2->put("B"_buf, "2"_buf));
+      ASSERT_OUTCOME_SUCCESS_TRY(batch->put("B"_buf, "2"_buf));
 
-      /// @that 4. top level and tx1 state are not changed, tx2 state is changed
-      checkBatchValues(*batch0, "-----");
-      checkBatchValues(*batch1, "1----");
-      checkBatchValues(*batch2, "12---");
+      /// @that 4. state is changed
+      checkBatchValues(*batch, "12---");
 
       {
         /// @when 5. start tx 3
         ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->startTransaction());
-        auto batch3 = storage_provider_->getCurrentBatch();
 
-        /// @that 5. top level, tx1, tx2 state are not changed, tx3 state like
-        /// tx2 state
-        checkBatchValues(*batch0, "-----");
-        checkBatchValues(*batch1, "1----");
-        checkBatchValues(*batch2, "12---");
-        checkBatchValues(*batch3, "12---");
+        /// @when 6. change next values, one of them twice
+        ASSERT_OUTCOME_SUCCESS_TRY(batch->put("C"_buf, "3"_buf));
+        ASSERT_OUTCOME_SUCCESS_TRY(batch->put("B"_buf, "3"_buf));
 
-        /// @when 6. change next value
-        ASSERT_OUTCOME_SUCCESS_TRY(batch3->put("C"_buf, "3"_buf));
-
-        /// @that 6. top level, tx1 and tx2 state are not changed, tx3 state is
-        /// changed
-        checkBatchValues(*batch0, "-----");
-        checkBatchValues(*batch1, "1----");
-        checkBatchValues(*batch2, "12---");
-        checkBatchValues(*batch3, "123--");
+        /// @that 6. state is changed
+        checkBatchValues(*batch, "133--");
 
         /// @when 7. commit tx3
         ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->commitTransaction());
 
-        /// @that 7. top level and tx1 state are not changed, tx2 state became
-        /// like tx3
-        checkBatchValues(*batch0, "-----");
-        checkBatchValues(*batch1, "1----");
-        checkBatchValues(*batch2, "123--");
-        checkBatchValues(*batch3, "123--");
+        /// @that 7. tx2 state became like tx3
+        checkBatchValues(*batch, "133--");
       }
 
       /// @when 8. change next value
-      ASSERT_OUTCOME_SUCCESS_TRY(batch2->put("D"_buf, "2"_buf));
+      ASSERT_OUTCOME_SUCCESS_TRY(batch->put("D"_buf, "2"_buf));
 
-      /// @that 8. top level and tx1 state are not changed, tx2 state is changed
-      checkBatchValues(*batch0, "-----");
-      checkBatchValues(*batch1, "1----");
-      checkBatchValues(*batch2, "1232-");
+      /// @that 8. state is changed
+      checkBatchValues(*batch, "1332-");
 
       /// @when 9. rollback tx2
       ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->rollbackTransaction());
 
-      /// @that 9. top level and tx1 state are not changed, tx2 state does not
-      /// matter anymore
-      checkBatchValues(*batch0, "-----");
-      checkBatchValues(*batch1, "1----");
+      /// @that 9. changes of tx2 and tx3 are discarded
+      checkBatchValues(*batch, "1----");
     }
 
     /// @when 10. change next value
-    ASSERT_OUTCOME_SUCCESS_TRY(batch1->put("E"_buf, "1"_buf));
+    ASSERT_OUTCOME_SUCCESS_TRY(batch->put("E"_buf, "1"_buf));
 
-    /// @that 10. top level is not changed, tx1 state is changed
-    checkBatchValues(*batch0, "-----");
-    checkBatchValues(*batch1, "1---1");
+    /// @that 10. state is changed
+    checkBatchValues(*batch, "1---1");
 
-    /// @when 11. commit tx3
+    /// @when 11. commit tx1
     ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->commitTransaction());
 
-    /// @that 11. top level became like tx1 state
-    checkBatchValues(*batch0, "1---1");
-    checkBatchValues(*batch1, "1---1");
+    /// @that 11. state of tx1 is kept
+    checkBatchValues(*batch, "1---1");
   }
+  EXPECT_EQ(storage_provider_->getCurrentBatch(), batch);
 }
 
 TEST_F(TrieStorageProviderTest, ChildTreeTransactions) {
   ASSERT_OUTCOME_SUCCESS(
-      base_batch_1,
-      storage_provider_->getMutableChildBatchAt("child_root_1"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(base_batch_1.get().put("A"_buf, "1"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(base_batch_1.get().put("B"_buf, "2"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(base_batch_1.get().put("C"_buf, "3"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(base_batch_1.get().put("D"_buf, "-"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(base_batch_1.get().put("E"_buf, "-"_buf));
-  checkBatchValues(base_batch_1, "123--");
+      batch_1, storage_provider_->getMutableChildBatchAt("child_root_1"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_1.get().put("A"_buf, "1"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_1.get().put("B"_buf, "2"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_1.get().put("C"_buf, "3"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_1.get().put("D"_buf, "-"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_1.get().put("E"_buf, "-"_buf));
+  checkBatchValues(batch_1, "123--");
 
   ASSERT_OUTCOME_SUCCESS(
-      base_batch_2,
-      storage_provider_->getMutableChildBatchAt("child_root_2"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(base_batch_2.get().put("A"_buf, "4"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(base_batch_2.get().put("B"_buf, "5"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(base_batch_2.get().put("C"_buf, "6"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(base_batch_2.get().put("D"_buf, "-"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(base_batch_2.get().put("E"_buf, "-"_buf));
-  checkBatchValues(base_batch_2, "456--");
+      batch_2, storage_provider_->getMutableChildBatchAt("child_root_2"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_2.get().put("A"_buf, "4"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_2.get().put("B"_buf, "5"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_2.get().put("C"_buf, "6"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_2.get().put("D"_buf, "-"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_2.get().put("E"_buf, "-"_buf));
+  checkBatchValues(batch_2, "456--");
 
   // First transaction
   ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->startTransaction());
-  ASSERT_OUTCOME_SUCCESS(
-      tr1_batch_1,
-      storage_provider_->getMutableChildBatchAt("child_root_1"_buf));
-  ASSERT_OUTCOME_SUCCESS(
-      tr1_batch_2,
-      storage_provider_->getMutableChildBatchAt("child_root_2"_buf));
-  checkBatchValues(tr1_batch_1, "123--");
-  checkBatchValues(tr1_batch_2, "456--");
-
-  ASSERT_OUTCOME_SUCCESS_TRY(tr1_batch_1.get().put("A"_buf, "a"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(tr1_batch_2.get().put("A"_buf, "d"_buf));
-  checkBatchValues(tr1_batch_1, "a23--");
-  checkBatchValues(tr1_batch_2, "d56--");
-  checkBatchValues(base_batch_1, "123--");
-  checkBatchValues(base_batch_2, "456--");
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_1.get().put("A"_buf, "a"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_2.get().put("A"_buf, "d"_buf));
+  checkBatchValues(batch_1, "a23--");
+  checkBatchValues(batch_2, "d56--");
 
   // Nested transaction
   ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->startTransaction());
-  ASSERT_OUTCOME_SUCCESS(
-      tr2_batch_1,
-      storage_provider_->getMutableChildBatchAt("child_root_1"_buf));
-  ASSERT_OUTCOME_SUCCESS(
-      tr2_batch_2,
-      storage_provider_->getMutableChildBatchAt("child_root_2"_buf));
-  checkBatchValues(tr2_batch_1, "a23--");
-  checkBatchValues(tr2_batch_2, "d56--");
-
-  ASSERT_OUTCOME_SUCCESS_TRY(tr2_batch_1.get().put("A"_buf, "0"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(tr2_batch_2.get().put("A"_buf, "1"_buf));
-  checkBatchValues(tr2_batch_1, "023--");
-  checkBatchValues(tr2_batch_2, "156--");
-  checkBatchValues(tr1_batch_1, "a23--");
-  checkBatchValues(tr1_batch_2, "d56--");
-  checkBatchValues(base_batch_1, "123--");
-  checkBatchValues(base_batch_2, "456--");
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_1.get().put("A"_buf, "0"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_2.get().put("A"_buf, "1"_buf));
+  checkBatchValues(batch_1, "023--");
+  checkBatchValues(batch_2, "156--");
 
   ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->commitTransaction());
-  checkBatchValues(tr1_batch_1, "023--");
-  checkBatchValues(tr1_batch_2, "156--");
-  checkBatchValues(base_batch_1, "123--");
-  checkBatchValues(base_batch_2, "456--");
+  checkBatchValues(batch_1, "023--");
+  checkBatchValues(batch_2, "156--");
 
   ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->commitTransaction());
-  checkBatchValues(base_batch_1, "023--");
-  checkBatchValues(base_batch_2, "156--");
+  checkBatchValues(batch_1, "023--");
+  checkBatchValues(batch_2, "156--");
 
   // Second transaction
+  ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->startTransaction());
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_1.get().put("A"_buf, "a"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch_2.get().put("A"_buf, "d"_buf));
+  checkBatchValues(batch_1, "a23--");
+  checkBatchValues(batch_2, "d56--");
+
+  ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->rollbackTransaction());
+  checkBatchValues(batch_1, "023--");
+  checkBatchValues(batch_2, "156--");
+}
+
+/**
+ * @given started transaction
+ * @when child trie is first modified inside it and transaction is rolled back
+ * @then child trie change is discarded
+ */
+TEST_F(TrieStorageProviderTest, ChildTreeCreatedInTransaction) {
   ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->startTransaction());
   ASSERT_OUTCOME_SUCCESS(
-      tr3_batch_1,
-      storage_provider_->getMutableChildBatchAt("child_root_1"_buf));
-  ASSERT_OUTCOME_SUCCESS(
-      tr3_batch_2,
-      storage_provider_->getMutableChildBatchAt("child_root_2"_buf));
-  checkBatchValues(tr3_batch_1, "023--");
-  checkBatchValues(tr3_batch_2, "156--");
-
-  ASSERT_OUTCOME_SUCCESS_TRY(tr3_batch_1.get().put("A"_buf, "a"_buf));
-  ASSERT_OUTCOME_SUCCESS_TRY(tr3_batch_2.get().put("A"_buf, "d"_buf));
-  checkBatchValues(tr3_batch_1, "a23--");
-  checkBatchValues(tr3_batch_2, "d56--");
-  checkBatchValues(base_batch_1, "023--");
-  checkBatchValues(base_batch_2, "156--");
+      batch, storage_provider_->getMutableChildBatchAt("child_root"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch.get().put("A"_buf, "1"_buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->rollbackTransaction());
+  ASSERT_OUTCOME_SUCCESS(contains, batch.get().contains("A"_buf));
+  EXPECT_FALSE(contains);
+}
+
+/**
+ * @given vector value appended in nested transactions
+ * @when transactions are committed and rolled back
+ * @then only items appended in committed transactions are kept
+ */
+TEST_F(TrieStorageProviderTest, AppendTransactions) {
+  auto item = [](uint8_t i) { return Buffer(1, i); };
+  auto append = [&](uint8_t i) {
+    return storage_provider_->getCurrentBatch()->append(
+        "A"_buf, scale::encode(item(i)).value(), 1);
+  };
+  auto expect = [&](std::vector<Buffer> items) {
+    ASSERT_OUTCOME_SUCCESS(
+        value, storage_provider_->getCurrentBatch()->get("A"_buf));
+    EXPECT_EQ(value, Buffer{scale::encode(items).value()});
+  };
 
+  ASSERT_OUTCOME_SUCCESS_TRY(append(1));
+  ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->startTransaction());
+  ASSERT_OUTCOME_SUCCESS_TRY(append(2));
+  ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->startTransaction());
+  ASSERT_OUTCOME_SUCCESS_TRY(append(3));
+  expect({item(1), item(2), item(3)});
+  ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->commitTransaction());
+  ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->startTransaction());
+  ASSERT_OUTCOME_SUCCESS_TRY(append(4));
   ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->rollbackTransaction());
-  checkBatchValues(base_batch_1, "023--");
-  checkBatchValues(base_batch_2, "156--");
+  expect({item(1), item(2), item(3)});
+  ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->commitTransaction());
+  expect({item(1), item(2), item(3)});
+
+  ASSERT_OUTCOME_SUCCESS_TRY(storage_provider_->commit(
+      std::nullopt, kagome::storage::trie::StateVersion::V0));
+  ASSERT_OUTCOME_SUCCESS_TRY(append(5));
+  expect({item(1), item(2), item(3), item(5)});
 }
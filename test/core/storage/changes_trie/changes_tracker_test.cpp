@@ -83,3 +83,25 @@ TEST(ChangesTrieTest, IntegrationWithOverlay) {
 
   // THEN SUCCESS
 }
+
+/**
+ * @given changes tracker
+ * @when entries are changed in the main trie and in a child trie
+ * @then main trie changes exclude child entries, and are unknown once the
+ * same key is changed in both
+ */
+TEST(ChangesTrieTest, MainTrieChanges) {
+  StorageChangesTrackerImpl tracker;
+  tracker.onPut("a"_buf, "1"_buf, true);
+  tracker.onRemove("b"_buf);
+  tracker.onChildPut("c"_buf, "2"_buf, true);
+
+  auto changes = tracker.mainTrieChanges();
+  ASSERT_TRUE(changes);
+  EXPECT_EQ(*changes,
+            (StorageChangesTrackerImpl::Changes{{"a"_buf, "1"_buf},
+                                                {"b"_buf, std::nullopt}}));
+
+  tracker.onChildRemove("a"_buf);
+  EXPECT_EQ(tracker.mainTrieChanges(), std::nullopt);
+}
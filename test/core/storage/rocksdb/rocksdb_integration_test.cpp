@@ -129,3 +129,24 @@ TEST_F(RocksDb_Integration_Test, Iterator) {
     EXPECT_EQ(counter[i], 1);
   }
 }
+
+/**
+ * @given database with some of the keys present
+ * @when read all keys with a single multiGet
+ * @then values are returned in the order of keys, absent keys are nullopt
+ */
+TEST_F(RocksDb_Integration_Test, MultiGet) {
+  Buffer other_key{4, 2};
+  Buffer missing_key{0};
+  ASSERT_OUTCOME_SUCCESS_TRY(db_->put(key_, BufferView{value_}));
+  ASSERT_OUTCOME_SUCCESS_TRY(db_->put(other_key, BufferView{key_}));
+
+  std::vector<BufferView> keys{other_key, missing_key, key_};
+  ASSERT_OUTCOME_SUCCESS(values, db_->multiGet(keys));
+  ASSERT_EQ(values.size(), keys.size());
+  ASSERT_TRUE(values[0]);
+  EXPECT_EQ(*values[0], key_);
+  EXPECT_FALSE(values[1]);
+  ASSERT_TRUE(values[2]);
+  EXPECT_EQ(*values[2], value_);
+}
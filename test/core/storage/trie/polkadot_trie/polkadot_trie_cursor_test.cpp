@@ -8,6 +8,7 @@
 
 #include "storage/trie/polkadot_trie/polkadot_trie_cursor_impl.hpp"
 
+#include <algorithm>
 #include <random>
 
 #include <gtest/gtest.h>
@@ -20,6 +21,7 @@
 
 using kagome::common::Buffer;
 using kagome::common::BufferView;
+using kagome::storage::trie::BranchNode;
 using kagome::storage::trie::PolkadotTrie;
 using kagome::storage::trie::PolkadotTrieCursorImpl;
 using kagome::storage::trie::PolkadotTrieImpl;
@@ -394,3 +396,46 @@ TEST_F(PolkadotTrieCursorTest, Broken) {
       .value();
   ASSERT_EQ(cursor->key().value(), vals[0].first);
 }
+
+/**
+ * @given a trie which counts children of branches it is asked to prefetch
+ * @when a single key is looked up with next() and seekUpperBound()
+ * @then the lookups prefetch nothing, while iterating the rest of the trie
+ * prefetches children of the branches the cursor enters
+ */
+TEST_F(PolkadotTrieCursorTest, PrefetchOnlyWhileIterating) {
+  using RetrieveFunctions = PolkadotTrie::RetrieveFunctions;
+  size_t prefetched = 0;
+  auto trie = PolkadotTrieImpl::createEmpty(RetrieveFunctions{
+      RetrieveFunctions::defaultNodeRetrieve,
+      RetrieveFunctions::defaultValueRetrieve,
+      [&](BranchNode &branch) -> outcome::result<void> {
+        prefetched += std::ranges::count_if(
+            branch.children, [](auto &child) { return child != nullptr; });
+        return outcome::success();
+      }});
+  std::vector<Buffer> keys;
+  for (uint8_t i = 0; i < 4; ++i) {
+    for (uint8_t j = 0; j < 4; ++j) {
+      keys.emplace_back(Buffer{i, j});
+      EXPECT_OUTCOME_TRUE_1(trie->put(keys.back(), BufferView{keys.back()}));
+    }
+  }
+  prefetched = 0;
+
+  PolkadotTrieCursorImpl cursor{trie};
+  EXPECT_OUTCOME_TRUE_1(cursor.next());
+  ASSERT_EQ(cursor.key().value(), keys[0]);
+  EXPECT_EQ(prefetched, 0);
+
+  EXPECT_OUTCOME_TRUE_1(cursor.seekUpperBound(keys[3]));
+  ASSERT_EQ(cursor.key().value(), keys[4]);
+  EXPECT_EQ(prefetched, 0);
+
+  for (size_t i = 5; i < keys.size(); ++i) {
+    EXPECT_OUTCOME_TRUE_1(cursor.next());
+    ASSERT_EQ(cursor.key().value(), keys[i]);
+  }
+  // branches of keys starting with 2 and 3 are entered from above
+  EXPECT_EQ(prefetched, 8);
+}
@@ -351,6 +351,38 @@ TEST_F(TrieTest, ClearPrefix) {
   ASSERT_OUTCOME_IS_FALSE(trie->contains("bat"_buf));
 }
 
+/**
+ * @given a trie which counts children of branches it is asked to prefetch
+ * @when entries with a prefix are cleared with and without limit
+ * @then children are prefetched only when the whole subtree is cleared
+ */
+TEST_F(TrieTest, ClearPrefixPrefetchWithoutLimit) {
+  using RetrieveFunctions = PolkadotTrie::RetrieveFunctions;
+  size_t prefetched = 0;
+  trie = PolkadotTrieImpl::createEmpty(RetrieveFunctions{
+      RetrieveFunctions::defaultNodeRetrieve,
+      RetrieveFunctions::defaultValueRetrieve,
+      [&](BranchNode &branch) -> outcome::result<void> {
+        prefetched += branch.childrenNum();
+        return outcome::success();
+      }});
+  for (uint8_t i = 0; i < 4; ++i) {
+    Buffer key{0x0a, i};
+    ASSERT_OUTCOME_SUCCESS_TRY(trie->put(key, BufferView{key}));
+  }
+  auto on_detach = [](const auto &, auto &&) { return outcome::success(); };
+
+  ASSERT_OUTCOME_SUCCESS_TRY(trie->clearPrefix("0a"_hex2buf, 1, on_detach));
+  ASSERT_OUTCOME_IS_FALSE(trie->contains("0a00"_hex2buf));
+  ASSERT_OUTCOME_IS_TRUE(trie->contains("0a01"_hex2buf));
+  EXPECT_EQ(prefetched, 0);
+
+  ASSERT_OUTCOME_SUCCESS_TRY(
+      trie->clearPrefix("0a"_hex2buf, std::nullopt, on_detach));
+  ASSERT_OUTCOME_IS_FALSE(trie->contains("0a01"_hex2buf));
+  EXPECT_GT(prefetched, 0);
+}
+
 struct DeleteData {
   std::vector<Buffer> data;
   Buffer key;
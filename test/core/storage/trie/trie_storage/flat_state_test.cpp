@@ -0,0 +1,183 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/flat_state.hpp"
+
+#include <gtest/gtest.h>
+
+#include "mock/core/storage/trie_pruner/trie_pruner_mock.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/impl/trie_storage_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::common::Buffer;
+using kagome::primitives::events::ChainSubscriptionEngine;
+using kagome::storage::InMemorySpacedStorage;
+using kagome::storage::Space;
+using kagome::storage::trie_pruner::TriePrunerMock;
+using namespace kagome::storage::trie;
+using testing::_;
+using testing::Return;
+
+class FlatStateTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    auto factory = std::make_shared<PolkadotTrieFactoryImpl>();
+    auto codec = std::make_shared<PolkadotCodec>();
+    serializer = std::make_shared<TrieSerializerImpl>(
+        factory, codec, std::make_shared<TrieStorageBackendImpl>(db));
+    auto state_pruner = std::make_shared<TriePrunerMock>();
+    ON_CALL(*state_pruner, addNewState(testing::A<const PolkadotTrie &>(), _))
+        .WillByDefault(Return(outcome::success()));
+
+    flat_state = std::make_shared<FlatState>(
+        db, serializer, std::make_shared<ChainSubscriptionEngine>());
+    trie_storage = TrieStorageImpl::createEmpty(
+                       factory, codec, serializer, state_pruner, flat_state)
+                       .value();
+    empty_root = serializer->getEmptyRootHash();
+
+    auto batch = trie_storage->getPersistentBatchAt(empty_root, {}).value();
+    for (auto &[key, value] : entries) {
+      EXPECT_OUTCOME_TRUE_1(batch->put(key, Buffer{value}));
+    }
+    root = batch->commit(StateVersion::V1).value();
+  }
+
+  std::optional<Buffer> get(const RootHash &state_root, const Buffer &key) {
+    auto lookup = flat_state->tryGet(state_root, key);
+    if (not lookup or not *lookup) {
+      ADD_FAILURE() << "state is not covered or lookup failed";
+      return std::nullopt;
+    }
+    return lookup->value();
+  }
+
+  const std::vector<std::pair<Buffer, Buffer>> entries{
+      {"a"_buf, "1"_buf},
+      {"ab"_buf, "2"_buf},
+      {"b"_buf, Buffer(64, 3)},
+  };
+
+  std::shared_ptr<InMemorySpacedStorage> db =
+      std::make_shared<InMemorySpacedStorage>();
+  std::shared_ptr<TrieSerializer> serializer;
+  std::shared_ptr<FlatState> flat_state;
+  std::unique_ptr<TrieStorage> trie_storage;
+  RootHash empty_root;
+  RootHash root;
+};
+
+/**
+ * @given a stored state
+ * @when the flat state is rebuilt at the state
+ * @then all entries of the state are read from the flat state
+ */
+TEST_F(FlatStateTest, Rebuild) {
+  EXPECT_FALSE(flat_state->tryGet(root, "a"_buf));
+
+  EXPECT_OUTCOME_TRUE_1(flat_state->rebuild(root));
+  EXPECT_EQ(flat_state->baseRoot(), root);
+  for (auto &[key, value] : entries) {
+    EXPECT_EQ(get(root, key), value);
+  }
+  EXPECT_EQ(get(root, "c"_buf), std::nullopt);
+  EXPECT_FALSE(flat_state->tryGet(empty_root, "a"_buf));
+}
+
+/**
+ * @given the flat state with diffs of unfinalized states
+ * @when one of the states is finalized
+ * @then states are read through the diffs, the flat copy moves to the
+ * finalized state and discarded forks are dropped
+ */
+TEST_F(FlatStateTest, DiffsAndFinalization) {
+  EXPECT_OUTCOME_TRUE_1(flat_state->rebuild(root));
+  auto root1 = "01"_hash256, root2 = "02"_hash256, fork = "03"_hash256;
+  flat_state->onBlockExecuted(
+      1, root, root1, {{"a"_buf, "5"_buf}, {"ab"_buf, std::nullopt}});
+  flat_state->onBlockExecuted(2, root1, root2, {{"c"_buf, "6"_buf}});
+  flat_state->onBlockExecuted(1, root, fork, {{"a"_buf, "7"_buf}});
+
+  EXPECT_EQ(get(root2, "a"_buf), "5"_buf);
+  EXPECT_EQ(get(root2, "ab"_buf), std::nullopt);
+  EXPECT_EQ(get(root2, "c"_buf), "6"_buf);
+  EXPECT_EQ(get(root1, "c"_buf), std::nullopt);
+  EXPECT_EQ(get(fork, "a"_buf), "7"_buf);
+  EXPECT_EQ(get(root, "a"_buf), "1"_buf);
+
+  flat_state->onFinalized(1, root1);
+  EXPECT_EQ(flat_state->baseRoot(), root1);
+  EXPECT_EQ(get(root1, "a"_buf), "5"_buf);
+  EXPECT_EQ(get(root1, "ab"_buf), std::nullopt);
+  EXPECT_EQ(get(root2, "c"_buf), "6"_buf);
+  EXPECT_FALSE(flat_state->tryGet(fork, "a"_buf));
+  EXPECT_FALSE(flat_state->tryGet(root, "a"_buf));
+}
+
+/**
+ * @given the flat state with limited memory for diffs
+ * @when diff of a newer block doesn't fit and an older block is finalized
+ * @then the newer state is not covered, and the flat copy is not rebuilt
+ * until finality passes the dropped diff
+ */
+TEST_F(FlatStateTest, DiffsMemoryLimit) {
+  flat_state = std::make_shared<FlatState>(
+      db, serializer, std::make_shared<ChainSubscriptionEngine>(), 4);
+  EXPECT_OUTCOME_TRUE_1(flat_state->rebuild(root));
+  auto root1 = "01"_hash256, root2 = "02"_hash256, root3 = "03"_hash256;
+  flat_state->onBlockExecuted(1, root, root1, {{"a"_buf, "5"_buf}});
+  flat_state->onBlockExecuted(2, root1, root2, {{"c"_buf, "666"_buf}});
+  flat_state->onBlockExecuted(3, root2, root3, {{"d"_buf, "7"_buf}});
+
+  EXPECT_EQ(get(root1, "a"_buf), "5"_buf);
+  EXPECT_FALSE(flat_state->tryGet(root2, "c"_buf));
+
+  flat_state->onFinalized(1, root1);
+  EXPECT_EQ(flat_state->baseRoot(), root1);
+  EXPECT_EQ(get(root1, "a"_buf), "5"_buf);
+
+  flat_state->onFinalized(2, root2);
+  EXPECT_EQ(flat_state->baseRoot(), std::nullopt);
+  EXPECT_FALSE(flat_state->tryGet(root3, "d"_buf));
+}
+
+/**
+ * @given a trie batch at the state of the flat copy
+ * @when keys are read before and after being modified in the batch
+ * @then unmodified keys are served from the flat state, modified ones from
+ * the trie
+ */
+TEST_F(FlatStateTest, TrieBatchReads) {
+  EXPECT_OUTCOME_TRUE_1(flat_state->rebuild(root));
+  // make the flat copy distinguishable from the trie
+  EXPECT_OUTCOME_TRUE_1(
+      db->getSpace(Space::kFlatState)->put("a"_buf, "flat"_buf));
+
+  auto batch = trie_storage->getEphemeralBatchAt(root).value();
+  EXPECT_OUTCOME_TRUE(flat_value, batch->get("a"_buf));
+  EXPECT_EQ(flat_value, "flat"_buf);
+
+  EXPECT_OUTCOME_TRUE_1(batch->put("a"_buf, "8"_buf));
+  EXPECT_OUTCOME_TRUE(trie_value, batch->get("a"_buf));
+  EXPECT_EQ(trie_value, "8"_buf);
+
+  EXPECT_OUTCOME_TRUE_1(batch->clearPrefix("a"_buf));
+  EXPECT_OUTCOME_TRUE(cleared, batch->tryGet("ab"_buf));
+  EXPECT_EQ(cleared, std::nullopt);
+  EXPECT_OUTCOME_TRUE(untouched, batch->tryGet("b"_buf));
+  EXPECT_EQ(untouched, Buffer(64, 3));
+}
@@ -9,6 +9,7 @@
 
 #include "mock/core/storage/spaced_storage_mock.hpp"
 #include "mock/core/storage/trie_pruner/trie_pruner_mock.hpp"
+#include "scale/scale.hpp"
 #include "storage/changes_trie/impl/storage_changes_tracker_impl.hpp"
 #include "storage/in_memory/in_memory_storage.hpp"
 #include "storage/trie/impl/topper_trie_batch_impl.hpp"
@@ -250,7 +251,7 @@ TEST_F(TrieBatchTest, TopperBatchAtomic) {
   ASSERT_OUTCOME_IS_TRUE(p_batch->contains("678"_buf))
   ASSERT_OUTCOME_IS_TRUE(p_batch->contains("123"_buf))
 
-  ASSERT_OUTCOME_SUCCESS_TRY(t_batch->writeBack())
+  ASSERT_OUTCOME_SUCCESS_TRY(t_batch->apply(*p_batch))
 
   ASSERT_OUTCOME_IS_TRUE(p_batch->contains("345"_buf))
   ASSERT_OUTCOME_IS_TRUE(p_batch->contains("678"_buf))
@@ -260,8 +261,8 @@ TEST_F(TrieBatchTest, TopperBatchAtomic) {
 /**
  * GIVEN a key present in a persistent batch but not present in its child topper
  * batch WHEN issuing a remove of this key from the topper batch THEN the key
- * must be removed from the persistent batch after a writeback of the topper
- * batch
+ * must be removed from the persistent batch after the topper batch is
+ * applied to it
  */
 TEST_F(TrieBatchTest, TopperBatchRemove) {
   std::shared_ptr<TrieBatch> p_batch =
@@ -272,9 +273,54 @@ TEST_F(TrieBatchTest, TopperBatchRemove) {
   auto t_batch = std::make_unique<TopperTrieBatchImpl>(p_batch);
 
   t_batch->remove("102030"_hex2buf).value();
-  t_batch->writeBack().value();
+  t_batch->apply(*p_batch).value();
 
   ASSERT_FALSE(p_batch->contains("102030"_hex2buf).value());
 }
 
 // TODO(Harrm): #595 test clearPrefix
+
+/**
+ * @given vector value in persistent batch and topper batch with nested
+ * transaction
+ * @when items are appended at each level and topper is applied twice
+ * @then each level reads vector with items appended so far, and items are
+ * appended to persistent batch once
+ */
+TEST_F(TrieBatchTest, TopperBatchAppend) {
+  auto vec = [](std::vector<Buffer> items) {
+    return Buffer{scale::encode(items).value()};
+  };
+  auto item = [](uint8_t i) { return Buffer(3, i); };
+  auto key = "0a"_hex2buf;
+  std::shared_ptr<TrieBatch> p_batch =
+      trie->getPersistentBatchAt(empty_hash, std::nullopt).value();
+  ASSERT_OUTCOME_SUCCESS_TRY(
+      p_batch->append(key, scale::encode(item(1)).value(), 1));
+  ASSERT_OUTCOME_SUCCESS_TRY(
+      p_batch->append(key, scale::encode(item(2)).value(), 1));
+
+  auto t_batch = std::make_shared<TopperTrieBatchImpl>(p_batch);
+  ASSERT_OUTCOME_SUCCESS_TRY(
+      t_batch->append(key, scale::encode(item(3)).value(), 1));
+  t_batch->startTransaction();
+  ASSERT_OUTCOME_SUCCESS_TRY(
+      t_batch->append(key, scale::encode(item(4)).value(), 1));
+
+  EXPECT_EQ(t_batch->get(key).value(),
+            vec({item(1), item(2), item(3), item(4)}));
+  EXPECT_EQ(p_batch->get(key).value(), vec({item(1), item(2)}));
+
+  t_batch->commitTransaction();
+  EXPECT_EQ(t_batch->get(key).value(),
+            vec({item(1), item(2), item(3), item(4)}));
+
+  // storage root is calculated mid-block, so changes are applied again
+  ASSERT_OUTCOME_SUCCESS_TRY(t_batch->apply(*p_batch));
+  ASSERT_OUTCOME_SUCCESS_TRY(t_batch->apply(*p_batch));
+  EXPECT_EQ(p_batch->get(key).value(),
+            vec({item(1), item(2), item(3), item(4)}));
+  ASSERT_OUTCOME_SUCCESS_TRY(p_batch->commit(StateVersion::V0));
+  EXPECT_EQ(p_batch->get(key).value(),
+            vec({item(1), item(2), item(3), item(4)}));
+}
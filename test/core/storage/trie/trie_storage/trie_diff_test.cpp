@@ -0,0 +1,115 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/trie_diff.hpp"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "mock/core/storage/trie_pruner/trie_pruner_mock.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/impl/trie_storage_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::common::Buffer;
+using kagome::storage::InMemorySpacedStorage;
+using kagome::storage::trie_pruner::TriePrunerMock;
+using namespace kagome::storage::trie;
+using testing::_;
+using testing::Return;
+
+class TrieDiffTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    auto factory = std::make_shared<PolkadotTrieFactoryImpl>();
+    auto codec = std::make_shared<PolkadotCodec>();
+    serializer = std::make_shared<TrieSerializerImpl>(
+        factory,
+        codec,
+        std::make_shared<TrieStorageBackendImpl>(
+            std::make_shared<InMemorySpacedStorage>()));
+    auto state_pruner = std::make_shared<TriePrunerMock>();
+    ON_CALL(*state_pruner, addNewState(testing::A<const PolkadotTrie &>(), _))
+        .WillByDefault(Return(outcome::success()));
+    trie_storage =
+        TrieStorageImpl::createEmpty(factory, codec, serializer, state_pruner)
+            .value();
+
+    auto batch =
+        trie_storage
+            ->getPersistentBatchAt(serializer->getEmptyRootHash(), {})
+            .value();
+    for (auto i = 0; i < 100; ++i) {
+      EXPECT_OUTCOME_TRUE_1(batch->put(key(i), Buffer(40, uint8_t(i))));
+    }
+    root = batch->commit(StateVersion::V1).value();
+  }
+
+  static Buffer key(int i) {
+    return Buffer::fromString(fmt::format("key{}", i));
+  }
+
+  std::shared_ptr<TrieSerializer> serializer;
+  std::unique_ptr<TrieStorage> trie_storage;
+  RootHash root;
+};
+
+/**
+ * @given two states differing in some keys
+ * @when diff of requested keys is computed
+ * @then only changed keys are returned with new values in order of keys
+ */
+TEST_F(TrieDiffTest, ChangedKeys) {
+  auto batch = trie_storage->getPersistentBatchAt(root, {}).value();
+  EXPECT_OUTCOME_TRUE_1(batch->put(key(5), "five"_buf));
+  EXPECT_OUTCOME_TRUE_1(batch->remove(key(7)));
+  EXPECT_OUTCOME_TRUE_1(batch->put("new"_buf, "value"_buf));
+  // same value is not a change
+  EXPECT_OUTCOME_TRUE_1(batch->put(key(9), Buffer(40, 9)));
+  auto new_root = batch->commit(StateVersion::V1).value();
+
+  std::vector<Buffer> keys{
+      "new"_buf, key(9), key(7), key(1), key(5), "missing"_buf};
+  EXPECT_OUTCOME_TRUE(changes, diffTries(*serializer, root, new_root, keys));
+  ASSERT_EQ(changes.size(), 3);
+  EXPECT_EQ(Buffer{changes[0].key}, "new"_buf);
+  EXPECT_EQ(changes[0].value, "value"_buf);
+  EXPECT_EQ(Buffer{changes[1].key}, key(7));
+  EXPECT_EQ(changes[1].value, std::nullopt);
+  EXPECT_EQ(Buffer{changes[2].key}, key(5));
+  EXPECT_EQ(changes[2].value, "five"_buf);
+
+  EXPECT_OUTCOME_TRUE(same, diffTries(*serializer, root, root, keys));
+  EXPECT_TRUE(same.empty());
+}
+
+/**
+ * @given empty and non-empty states
+ * @when diff is computed in both directions
+ * @then values are added and removed
+ */
+TEST_F(TrieDiffTest, EmptyState) {
+  auto empty = serializer->getEmptyRootHash();
+  std::vector<Buffer> keys{key(1), key(2)};
+
+  EXPECT_OUTCOME_TRUE(added, diffTries(*serializer, empty, root, keys));
+  ASSERT_EQ(added.size(), 2);
+  EXPECT_EQ(added[1].value, Buffer(40, 2));
+
+  EXPECT_OUTCOME_TRUE(removed, diffTries(*serializer, root, empty, keys));
+  ASSERT_EQ(removed.size(), 2);
+  EXPECT_EQ(removed[0].value, std::nullopt);
+}
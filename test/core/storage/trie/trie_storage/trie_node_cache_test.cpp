@@ -0,0 +1,63 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/serialization/trie_node_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+
+using kagome::common::Hash256;
+using kagome::storage::trie::BranchNode;
+using kagome::storage::trie::DummyNode;
+using kagome::storage::trie::KeyNibbles;
+using kagome::storage::trie::LeafNode;
+using kagome::storage::trie::TrieNodeCache;
+
+/**
+ * @given a cache with a branch node
+ * @when the node is retrieved and modified
+ * @then the cached node stays intact and shares dummy children with the copy
+ */
+TEST(TrieNodeCacheTest, GetReturnsPrivateCopy) {
+  TrieNodeCache cache{16};
+  auto hash = "01"_hash256;
+  BranchNode branch{KeyNibbles{"0102"_hex2buf}, "abc"_buf};
+  branch.children[3] = std::make_shared<DummyNode>("02"_hash256);
+  cache.put(hash, branch);
+
+  auto first = std::dynamic_pointer_cast<BranchNode>(cache.get(hash));
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first->getValue().value, "abc"_buf);
+  EXPECT_EQ(first->children[3], branch.children[3]);
+  first->children[3] = std::make_shared<LeafNode>(KeyNibbles{}, "x"_buf);
+  first->setValue({"def"_buf, std::nullopt});
+
+  auto second = std::dynamic_pointer_cast<BranchNode>(cache.get(hash));
+  ASSERT_NE(second, nullptr);
+  EXPECT_NE(second, first);
+  EXPECT_EQ(second->getValue().value, "abc"_buf);
+  EXPECT_EQ(second->children[3], branch.children[3]);
+}
+
+/**
+ * @given a cache with limited capacity
+ * @when more nodes than the capacity are inserted
+ * @then the cache size stays bounded and missing nodes return nullptr
+ */
+TEST(TrieNodeCacheTest, Bounded) {
+  TrieNodeCache cache{16};
+  EXPECT_EQ(cache.get("01"_hash256), nullptr);
+  for (uint8_t i = 0; i < 64; ++i) {
+    Hash256 hash;
+    hash[0] = i;
+    cache.put(hash, LeafNode{KeyNibbles{}, "leaf"_buf});
+  }
+  EXPECT_LE(cache.size(), 16u);
+  Hash256 last;
+  last[0] = 63;
+  EXPECT_NE(cache.get(last), nullptr);
+}
@@ -0,0 +1,93 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common/worker_thread_pool.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::Watchdog;
+using kagome::common::Buffer;
+using kagome::common::WorkerThreadPool;
+using kagome::storage::InMemorySpacedStorage;
+using namespace kagome::storage::trie;
+
+class TrieSerializerTest : public testing::TestWithParam<StateVersion> {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void TearDown() override {
+    watchdog->stop();
+    pool.reset();
+  }
+
+  std::shared_ptr<TrieSerializerImpl> makeSerializer(size_t commit_threads) {
+    return std::make_shared<TrieSerializerImpl>(
+        factory,
+        codec,
+        std::make_shared<TrieStorageBackendImpl>(
+            std::make_shared<InMemorySpacedStorage>()),
+        nullptr,
+        pool,
+        commit_threads);
+  }
+
+  std::shared_ptr<PolkadotTrie> makeTrie() {
+    auto trie = factory->createEmpty();
+    for (uint32_t i = 0; i < 3000; ++i) {
+      Buffer key;
+      key.putUint32(i * 2654435761u).putUint32(i);
+      // long values are hashed in V1
+      EXPECT_OUTCOME_TRUE_1(trie->put(key, Buffer(i % 64 + 1, i % 256)));
+    }
+    return trie;
+  }
+
+  std::shared_ptr<PolkadotTrieFactoryImpl> factory =
+      std::make_shared<PolkadotTrieFactoryImpl>();
+  std::shared_ptr<PolkadotCodec> codec = std::make_shared<PolkadotCodec>();
+  std::shared_ptr<Watchdog> watchdog =
+      std::make_shared<Watchdog>(std::chrono::milliseconds(1));
+  std::shared_ptr<WorkerThreadPool> pool =
+      std::make_shared<WorkerThreadPool>(watchdog, 3);
+};
+
+/**
+ * @given a trie with thousands of dirty nodes
+ * @when it is stored sequentially and with a parallel commit
+ * @then root hashes match and the stored trie can be read back
+ */
+TEST_P(TrieSerializerTest, ParallelCommitMatchesSequential) {
+  auto sequential = makeSerializer(1);
+  auto parallel = makeSerializer(4);
+
+  EXPECT_OUTCOME_TRUE(
+      sequential_root, sequential->storeTrie(*makeTrie(), GetParam()));
+  EXPECT_OUTCOME_TRUE(parallel_root,
+                      parallel->storeTrie(*makeTrie(), GetParam()));
+  EXPECT_EQ(sequential_root, parallel_root);
+
+  EXPECT_OUTCOME_TRUE(stored, parallel->retrieveTrie(parallel_root, nullptr));
+  for (uint32_t i = 0; i < 3000; i += 97) {
+    Buffer key;
+    key.putUint32(i * 2654435761u).putUint32(i);
+    EXPECT_OUTCOME_TRUE(value, stored->get(key));
+    EXPECT_EQ(value, Buffer(i % 64 + 1, i % 256));
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Versions,
+                         TrieSerializerTest,
+                         testing::Values(StateVersion::V0, StateVersion::V1));
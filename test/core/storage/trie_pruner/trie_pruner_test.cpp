@@ -21,11 +21,14 @@
 #include "mock/core/storage/trie/trie_storage_backend_mock.hpp"
 #include "mock/core/storage/write_batch_mock.hpp"
 #include "storage/database_error.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/in_memory/in_memory_storage.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_impl.hpp"
 #include "storage/trie/serialization/polkadot_codec.hpp"
 #include "storage/trie/serialization/trie_serializer_impl.hpp"
 #include "storage/trie_pruner/impl/trie_pruner_impl.hpp"
+#include "storage/trie_pruner/impl/trie_pruner_thread_pool.hpp"
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 #include "testutil/prepare_loggers.hpp"
@@ -112,6 +115,11 @@ class PolkadotTrieMock final : public trie::PolkadotTrie {
     throw std::runtime_error{"Not implemented"};
   }
 
+  outcome::result<void> prefetchChildren(
+      const trie::BranchNode &parent) const override {
+    throw std::runtime_error{"Not implemented"};
+  }
+
   outcome::result<void> retrieveValue(
       trie::ValueAndHash &value) const override {
     throw std::runtime_error{"Not implemented"};
@@ -184,6 +192,8 @@ class TriePrunerTest : public testing::Test {
 
     ON_CALL(*persistent_storage_mock, getSpace(kDefault))
         .WillByDefault(Invoke([this](auto) { return pruner_space; }));
+    ON_CALL(*persistent_storage_mock, getSpace(kTriePruner))
+        .WillByDefault(Return(ref_count_space));
 
     pruner.reset(new TriePrunerImpl(
         std::make_shared<kagome::application::AppStateManagerMock>(),
@@ -192,7 +202,9 @@ class TriePrunerTest : public testing::Test {
         codec_mock,
         persistent_storage_mock,
         hasher,
-        config_mock));
+        config_mock,
+        std::make_shared<trie_pruner::TriePrunerThreadPool>(
+            kagome::TestThreadPool{})));
     ASSERT_TRUE(pruner->prepare());
   }
 
@@ -218,7 +230,9 @@ class TriePrunerTest : public testing::Test {
         codec_mock,
         persistent_storage_mock,
         hasher,
-        config_mock));
+        config_mock,
+        std::make_shared<trie_pruner::TriePrunerThreadPool>(
+            kagome::TestThreadPool{})));
     BOOST_ASSERT(pruner->prepare());
     ASSERT_OUTCOME_SUCCESS_TRY(pruner->recoverState(block_tree));
   }
@@ -263,6 +277,8 @@ class TriePrunerTest : public testing::Test {
   std::shared_ptr<trie::CodecMock> codec_mock;
   std::shared_ptr<crypto::Hasher> hasher;
   std::shared_ptr<testing::NiceMock<BufferStorageMock>> pruner_space;
+  std::shared_ptr<kagome::storage::InMemoryStorage> ref_count_space =
+      std::make_shared<kagome::storage::InMemoryStorage>();
 };
 
 struct NodeRetriever {
@@ -359,6 +375,7 @@ TEST_F(TriePrunerTest, BasicScenario) {
   BlockHeader header1{.number = 1, .state_root = "root1"_hash256};
   primitives::calculateBlockHash(header1, *hasher);
   ASSERT_OUTCOME_SUCCESS_TRY(pruner->pruneFinalized(header1));
+  ASSERT_OUTCOME_SUCCESS_TRY(pruner->pruneQueued());
   ASSERT_EQ(pruner->getTrackedNodesNum(), 3);
 
   EXPECT_CALL(*serializer_mock, retrieveTrie("root2"_hash256, _))
@@ -366,9 +383,80 @@ TEST_F(TriePrunerTest, BasicScenario) {
   BlockHeader header2{.number = 2, .state_root = "root2"_hash256};
   primitives::calculateBlockHash(header2, *hasher);
   ASSERT_OUTCOME_SUCCESS_TRY(pruner->pruneFinalized(header2));
+  ASSERT_OUTCOME_SUCCESS_TRY(pruner->pruneQueued());
   ASSERT_EQ(pruner->getTrackedNodesNum(), 0);
 }
 
+/**
+ * @given queued state which fails to load
+ * @when pruning is retried
+ * @then state is dropped from queue after a few attempts
+ */
+TEST_F(TriePrunerTest, FailingStateIsSkipped) {
+  EXPECT_CALL(*serializer_mock, retrieveTrie("root1"_hash256, _))
+      .Times(3)
+      .WillRepeatedly(Return(DatabaseError::IO_ERROR));
+  EXPECT_CALL(*trie_node_storage_mock, batch()).Times(0);
+
+  BlockHeader header{.number = 1, .state_root = "root1"_hash256};
+  primitives::calculateBlockHash(header, *hasher);
+  ASSERT_OUTCOME_SUCCESS_TRY(pruner->pruneFinalized(header));
+
+  ASSERT_FALSE(pruner->pruneNext().has_value());
+  ASSERT_FALSE(pruner->pruneNext().has_value());
+  ASSERT_OUTCOME_SUCCESS(skipped, pruner->pruneNext());
+  ASSERT_TRUE(skipped);
+  ASSERT_OUTCOME_SUCCESS(pruned, pruner->pruneNext());
+  ASSERT_FALSE(pruned);
+}
+
+/**
+ * @given pruner over storage with batches across spaces
+ * @when new state is stored
+ * @then its nodes and ref counts are written by the same batch
+ */
+TEST_F(TriePrunerTest, StoreNewStateWithRefCounts) {
+  auto config_mock =
+      std::make_shared<kagome::application::AppConfigurationMock>();
+  ON_CALL(*config_mock, statePruningDepth()).WillByDefault(Return(16));
+  ON_CALL(*config_mock, enableThoroughPruning()).WillByDefault(Return(true));
+  auto storage = std::make_shared<InMemorySpacedStorage>();
+  auto spaced_pruner = std::make_shared<TriePrunerImpl>(
+      std::make_shared<kagome::application::AppStateManagerMock>(),
+      trie_node_storage_mock,
+      serializer_mock,
+      codec_mock,
+      storage,
+      hasher,
+      config_mock,
+      std::make_shared<trie_pruner::TriePrunerThreadPool>(
+          kagome::TestThreadPool{}));
+  ASSERT_TRUE(spaced_pruner->prepare());
+
+  ON_CALL(*codec_mock, merkleValue(_, _, _))
+      .WillByDefault(Invoke([](auto &node, auto version, auto) {
+        return trie::MerkleValue::create(
+                   *static_cast<const trie::TrieNode &>(node).getValue().value)
+            .value();
+      }));
+  auto trie = makeTrie({NODE, "root1"_hash256, {}});
+  EXPECT_CALL(*serializer_mock, storeTrie(_, _, _))
+      .WillOnce(Invoke([](auto &, auto, BufferWriteable &batch)
+                           -> outcome::result<trie::RootHash> {
+        OUTCOME_TRY(batch.put("root1"_hash256, "node"_buf));
+        return "root1"_hash256;
+      }));
+
+  ASSERT_OUTCOME_SUCCESS(root,
+                         spaced_pruner->storeNewState(
+                             *trie, trie::StateVersion::V1, *serializer_mock));
+  ASSERT_EQ(root, "root1"_hash256);
+  ASSERT_OUTCOME_SUCCESS(
+      stored, storage->getSpace(kTrieNode)->contains("root1"_hash256));
+  ASSERT_TRUE(stored);
+  ASSERT_EQ(spaced_pruner->getRefCountOf("root1"_hash256), 1);
+}
+
 template <typename RandomDevice>
 Buffer randomBuffer(RandomDevice &rand) {
   Buffer buf;
@@ -569,6 +657,7 @@ TEST_F(TriePrunerTest, RandomTree) {
       BlockHeader header{.number = i - 16, .state_root = root};
       primitives::calculateBlockHash(header, *hasher);
       ASSERT_OUTCOME_SUCCESS_TRY(pruner->pruneFinalized(header));
+      ASSERT_OUTCOME_SUCCESS_TRY(pruner->pruneQueued());
     }
   }
   for (unsigned i = STATES_NUM - 16; i < STATES_NUM; i++) {
@@ -588,6 +677,7 @@ TEST_F(TriePrunerTest, RandomTree) {
     BlockHeader header{.number = i, .state_root = root};
     primitives::calculateBlockHash(header, *hasher);
     ASSERT_OUTCOME_SUCCESS_TRY(pruner->pruneFinalized(header));
+    ASSERT_OUTCOME_SUCCESS_TRY(pruner->pruneQueued());
   }
   for (auto &[hash, node] : node_storage) {
     std::cout << hash << "\n";
@@ -685,6 +775,13 @@ TEST_F(TriePrunerTest, RestoreStateFromGenesis) {
                         *block_tree);
 
   ASSERT_EQ(pruner->getTrackedNodesNum(), 3);
+
+  // ref counts are loaded from database, states are not retrieved again
+  initOnLastPrunedBlock(BlockInfo{3, hash_from_header(headers.at(3))},
+                        *block_tree);
+  ASSERT_EQ(pruner->getTrackedNodesNum(), 3);
+  ASSERT_EQ(pruner->getLastPrunedBlock(),
+            (BlockInfo{3, hash_from_header(headers.at(3))}));
 }
 
 std::shared_ptr<trie::PolkadotTrie> clone(const trie::PolkadotTrie &trie) {
@@ -850,5 +947,6 @@ TEST_F(TriePrunerTest, FastSyncScenario) {
     }
 
     ASSERT_OUTCOME_SUCCESS_TRY(pruner->pruneFinalized(headers[n]));
+    ASSERT_OUTCOME_SUCCESS_TRY(pruner->pruneQueued());
   }
 }
@@ -39,6 +39,7 @@
 #include <kagome/storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp>
 #include <kagome/storage/trie/serialization/trie_serializer_impl.hpp>
 #include <kagome/storage/trie_pruner/impl/trie_pruner_impl.hpp>
+#include <kagome/storage/trie_pruner/impl/trie_pruner_thread_pool.hpp>
 #include <libp2p/crypto/random_generator/boost_generator.hpp>
 #include <libp2p/log/configurator.hpp>
 
@@ -97,7 +98,9 @@ int main() {
           codec,
           database,
           hasher,
-          config);
+          config,
+          std::make_shared<kagome::storage::trie_pruner::TriePrunerThreadPool>(
+              kagome::TestThreadPool{}));
 
   std::shared_ptr<kagome::storage::trie::TrieStorageImpl> trie_storage =
       kagome::storage::trie::TrieStorageImpl::createEmpty(
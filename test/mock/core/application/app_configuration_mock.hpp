@@ -81,6 +81,10 @@ namespace kagome::application {
 
     MOCK_METHOD(uint32_t, maxWsConnections, (), (const, override));
 
+    MOCK_METHOD(uint32_t, rpcThreads, (), (const, override));
+
+    MOCK_METHOD(uint32_t, rpcMaxQueuedRequests, (), (const, override));
+
     MOCK_METHOD(std::chrono::seconds,
                 getRandomWalkInterval,
                 (),
@@ -108,6 +112,8 @@ namespace kagome::application {
 
     MOCK_METHOD(application::SyncMethod, syncMethod, (), (const, override));
 
+    MOCK_METHOD(uint32_t, importPipelineDepth, (), (const, override));
+
     MOCK_METHOD(AppConfiguration::RuntimeExecutionMethod,
                 runtimeExecMethod,
                 (),
@@ -120,6 +126,8 @@ namespace kagome::application {
 
     MOCK_METHOD(bool, purgeWavmCache, (), (const, override));
 
+    MOCK_METHOD(uint32_t, runtimeInstancesPrewarm, (), (const, override));
+
     MOCK_METHOD(uint32_t,
                 parachainRuntimeInstanceCacheSize,
                 (),
@@ -148,6 +156,8 @@ namespace kagome::application {
 
     MOCK_METHOD(bool, disableSecureMode, (), (const, override));
 
+    MOCK_METHOD(bool, profileHostApi, (), (const, override));
+
     MOCK_METHOD(bool, isOffchainIndexingEnabled, (), (const, override));
 
     MOCK_METHOD(std::optional<Subcommand>, subcommand, (), (const, override));
@@ -182,6 +192,12 @@ namespace kagome::application {
 
     MOCK_METHOD(uint32_t, dbCacheSize, (), (const, override));
 
+    MOCK_METHOD(uint32_t, trieNodeCacheSize, (), (const, override));
+
+    MOCK_METHOD(uint32_t, trieCommitThreads, (), (const, override));
+
+    MOCK_METHOD(bool, enableFlatState, (), (const, override));
+
     MOCK_METHOD(std::optional<std::string_view>,
                 devMnemonicPhrase,
                 (),
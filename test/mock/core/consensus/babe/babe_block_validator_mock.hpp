@@ -18,6 +18,12 @@ namespace kagome::consensus::babe {
                 validateHeader,
                 (const primitives::BlockHeader &block_header),
                 (const, override));
+
+    MOCK_METHOD(void,
+                prevalidateHeader,
+                (const primitives::BlockHeader &,
+                 const primitives::BlockHeader &),
+                (const, override));
   };
 
 }  // namespace kagome::consensus::babe
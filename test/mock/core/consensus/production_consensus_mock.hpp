@@ -59,6 +59,12 @@ namespace kagome::consensus {
                 (const primitives::BlockHeader &),
                 (const, override));
 
+    MOCK_METHOD(void,
+                prevalidateHeader,
+                (const primitives::BlockHeader &,
+                 const primitives::BlockHeader &),
+                (const, override));
+
     MOCK_METHOD(outcome::result<void>,
                 reportEquivocation,
                 (const primitives::BlockHash &, const primitives::BlockHash &),
@@ -26,6 +26,11 @@ namespace kagome::runtime {
                 embeddedVersion,
                 (const primitives::BlockHash &),
                 (override));
+
+    MOCK_METHOD(outcome::result<void>,
+                precompileAt,
+                (const storage::trie::RootHash &),
+                (override));
   };
 
 }  // namespace kagome::runtime
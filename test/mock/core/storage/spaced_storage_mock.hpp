@@ -15,6 +15,11 @@ namespace kagome::storage {
   class SpacedStorageMock : public SpacedStorage {
    public:
     MOCK_METHOD(std::shared_ptr<BufferStorage>, getSpace, (Space), (override));
+
+    MOCK_METHOD(std::unique_ptr<BufferSpacedBatch>,
+                createBatch,
+                (),
+                (override));
   };
 
 }  // namespace kagome::storage
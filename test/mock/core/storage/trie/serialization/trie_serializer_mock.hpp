@@ -21,6 +21,11 @@ namespace kagome::storage::trie {
                 (PolkadotTrie &, StateVersion),
                 (override));
 
+    MOCK_METHOD(outcome::result<RootHash>,
+                storeTrie,
+                (PolkadotTrie &, StateVersion, BufferWriteable &),
+                (override));
+
     MOCK_METHOD(outcome::result<std::shared_ptr<PolkadotTrie>>,
                 retrieveTrie,
                 (RootHash, OnNodeLoaded),